@@ -737,6 +737,10 @@
         'libcef/dom_storage_common.h',
         'libcef/dom_storage_context.cc',
         'libcef/dom_storage_context.h',
+        'libcef/dom_storage_database.cc',
+        'libcef/dom_storage_database.h',
+        'libcef/dom_storage_database_area.cc',
+        'libcef/dom_storage_database_area.h',
         'libcef/dom_storage_namespace.cc',
         'libcef/dom_storage_namespace.h',
         'libcef/dom_document_impl.cc',
@@ -756,9 +760,13 @@
         'libcef/request_impl.h',
         'libcef/response_impl.cc',
         'libcef/response_impl.h',
+        'libcef/scheme_handler_cache.cc',
+        'libcef/scheme_handler_cache.h',
         'libcef/scheme_impl.cc',
         'libcef/simple_clipboard_impl.cc',
         'libcef/simple_clipboard_impl.h',
+        'libcef/storage_change_dispatcher.cc',
+        'libcef/storage_change_dispatcher.h',
         'libcef/storage_impl.cc',
         'libcef/stream_impl.cc',
         'libcef/stream_impl.h',
@@ -767,6 +775,10 @@
         'libcef/url_impl.cc',
         'libcef/v8_impl.cc',
         'libcef/v8_impl.h',
+        'libcef/v8_script_cache.cc',
+        'libcef/v8_script_cache.h',
+        'libcef/values_impl.cc',
+        'libcef/values_impl.h',
         'libcef/web_urlrequest_impl.cc',
         'libcef/web_urlrequest_impl.h',
         'libcef/webview_host.cc',
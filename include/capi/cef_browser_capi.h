@@ -206,6 +206,13 @@ typedef struct _cef_browser_t {
   ///
   void (CEF_CALLBACK *close_dev_tools)(struct _cef_browser_t* self);
 
+  ///
+  // Discard the cookie manager that was returned for this browser by
+  // cef_request_tHandler::get_cookie_manager(). The cookie manager is otherwise
+  // cached until the URL of the top-level frame changes.
+  ///
+  void (CEF_CALLBACK *invalidate_cookie_manager)(struct _cef_browser_t* self);
+
   ///
   // Returns true (1) if window rendering is disabled.
   ///
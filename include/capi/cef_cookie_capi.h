@@ -73,6 +73,22 @@ typedef struct _cef_cookie_manager_t {
       const cef_string_t* url, int includeHttpOnly,
       struct _cef_cookie_visitor_t* visitor);
 
+  ///
+  // Visit cookies in pages of up to |page_size| cookies. If |domain| is non-
+  // NULL only cookies for that domain and its subdomains will be included. If
+  // |name| is non-NULL only cookies with that name will be included. Cookies
+  // are ordered by domain, name, path and creation date and each page is
+  // delivered by a separate task on the IO thread. If |cursor| is NULL the
+  // visit starts at the first cookie. To resume a visit at a later time pass
+  // the |next_cursor| value from the last page that was visited. Cookies that
+  // are added or removed in between do not cause other cookies to be skipped or
+  // repeated. Returns false (0) if cookies cannot be accessed or if |cursor| is
+  // invalid.
+  ///
+  int (CEF_CALLBACK *visit_cookie_pages)(struct _cef_cookie_manager_t* self,
+      const cef_string_t* domain, const cef_string_t* name, int page_size,
+      const cef_string_t* cursor, struct _cef_cookie_page_visitor_t* visitor);
+
   ///
   // Sets a cookie given a valid URL and explicit user-provided cookie
   // attributes. This function expects each attribute to be well-formed. It will
@@ -96,6 +112,43 @@ typedef struct _cef_cookie_manager_t {
   int (CEF_CALLBACK *delete_cookies)(struct _cef_cookie_manager_t* self,
       const cef_string_t* url, const cef_string_t* cookie_name);
 
+  ///
+  // Sets multiple cookies for the given valid URL. Each entry in |cookie_lines|
+  // uses the Set-Cookie header format (for example, "name=value; path=/;
+  // expires=Wed, 13-Jan-2021 22:23:01 GMT; HttpOnly"). All cookies are set by a
+  // single task on the IO thread and written to the persistent store together.
+  // Returns false (0) if the URL is invalid or if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *set_cookies)(struct _cef_cookie_manager_t* self,
+      const cef_string_t* url, cef_string_list_t cookie_lines);
+
+  ///
+  // Delete cookies for multiple URLs. For each entry in |urls| this behaves
+  // like calling delete_cookies() with that URL and |cookie_name|. All cookies
+  // are deleted by a single task on the IO thread. Invalid URLs are ignored.
+  // Returns false (0) if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *delete_url_cookies)(struct _cef_cookie_manager_t* self,
+      cef_string_list_t urls, const cef_string_t* cookie_name);
+
+  ///
+  // Serialize all cookies. |handler| will be called on the IO thread with the
+  // serialized data which can later be passed to import_cookies(). Returns
+  // false (0) if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *export_cookies)(struct _cef_cookie_manager_t* self,
+      struct _cef_cookie_export_handler_t* handler);
+
+  ///
+  // Set all cookies from |data| as returned by export_cookies(). Cookie
+  // creation and last access times are not preserved. All cookies are set by a
+  // single task on the IO thread and written to the persistent store together.
+  // Returns false (0) if |data| is not in the expected format or if cookies
+  // cannot be accessed.
+  ///
+  int (CEF_CALLBACK *import_cookies)(struct _cef_cookie_manager_t* self,
+      const cef_string_t* data);
+
   ///
   // Sets the directory path that will be used for storing cookie data. If
   // |path| is NULL data will be stored in memory only. Returns false (0) if
@@ -103,6 +156,17 @@ typedef struct _cef_cookie_manager_t {
   ///
   int (CEF_CALLBACK *set_storage_path)(struct _cef_cookie_manager_t* self,
       const cef_string_t* path);
+
+  ///
+  // Populate |metrics| with information about how cookies were loaded from the
+  // persistent store. Cookies for a domain are loaded on demand when first
+  // accessed while all other cookies are loaded in the background after the
+  // delay specified by CefSettings.cookie_background_load_delay. Returns false
+  // (0) if cookie data is stored in memory only. This function must be called
+  // on the IO thread.
+  ///
+  int (CEF_CALLBACK *get_load_metrics)(struct _cef_cookie_manager_t* self,
+      struct _cef_cookie_load_metrics_t* metrics);
 } cef_cookie_manager_t;
 
 
@@ -119,6 +183,17 @@ CEF_EXPORT cef_cookie_manager_t* cef_cookie_manager_get_global_manager();
 CEF_EXPORT cef_cookie_manager_t* cef_cookie_manager_create_manager(
     const cef_string_t* path);
 
+///
+// Creates a new cookie manager for the cookie partition identified by
+// |partition|. Cookie managers that store data in the same |path| share a
+// single database and commit schedule while the cookies of each partition
+// remain separate. A manager created with cef_cookie_manager_create_manager()
+// uses the NULL partition. If |path| is NULL data will be stored in memory
+// only. Returns NULL if creation fails.
+///
+CEF_EXPORT cef_cookie_manager_t* cef_cookie_manager_create_partitioned_manager(
+    const cef_string_t* path, const cef_string_t* partition);
+
 
 ///
 // Structure to implement for visiting cookie values. The functions of this
@@ -143,6 +218,74 @@ typedef struct _cef_cookie_visitor_t {
 } cef_cookie_visitor_t;
 
 
+///
+// Structure representing a page of cookies. The functions of this structure may
+// be called on any thread.
+///
+typedef struct _cef_cookie_page_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Returns the number of cookies in this page.
+  ///
+  int (CEF_CALLBACK *get_count)(struct _cef_cookie_page_t* self);
+
+  ///
+  // Retrieve the cookie at the specified 0-based |index|. Returns false (0) if
+  // |index| is out of range.
+  ///
+  int (CEF_CALLBACK *get_cookie)(struct _cef_cookie_page_t* self, int index,
+      struct _cef_cookie_t* cookie);
+} cef_cookie_page_t;
+
+
+///
+// Structure to implement for visiting pages of cookies. The functions of this
+// structure will always be called on the IO thread.
+///
+typedef struct _cef_cookie_page_visitor_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called once for each page of cookies. The function will
+  // be called at least once, in which case |page| may be NULL. |next_cursor|
+  // identifies the last cookie in this page and |total| is the total number of
+  // matching cookies. |next_cursor| is NULL for the last page. |page| may be
+  // retained and used on other threads. Return false (0) to stop visiting
+  // cookies.
+  ///
+  int (CEF_CALLBACK *visit)(struct _cef_cookie_page_visitor_t* self,
+      struct _cef_cookie_page_t* page, const cef_string_t* next_cursor,
+      int total);
+} cef_cookie_page_visitor_t;
+
+
+///
+// Structure to implement for receiving exported cookie data. The functions of
+// this structure will always be called on the IO thread.
+///
+typedef struct _cef_cookie_export_handler_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called with the serialized cookie data. |count| is the
+  // number of cookies that were exported.
+  ///
+  void (CEF_CALLBACK *on_cookies_exported)(
+      struct _cef_cookie_export_handler_t* self, const cef_string_t* data,
+      int count);
+} cef_cookie_export_handler_t;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,6 +45,34 @@ extern "C" {
 #include "include/capi/cef_base_capi.h"
 
 
+///
+// Structure to implement for receiving the results of
+// cef_frame_t::evaluate_java_script() and
+// cef_frame_t::execute_java_script_batch(). The functions of this structure
+// will be called on the UI thread.
+///
+typedef struct _cef_java_script_result_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called after the scripts have executed. |results| and |exceptions| contain
+  // one entry for each script in the order that the scripts were executed.
+  // |results| contains the value of each script converted to a simple value,
+  // list or dictionary. Undefined values and values that cannot be converted
+  // are represented as null. |exceptions| contains the message of the exception
+  // thrown by each script or an NULL string if the script completed
+  // successfully.
+  ///
+  void (CEF_CALLBACK *on_complete)(
+      struct _cef_java_script_result_callback_t* self,
+      struct _cef_list_value_t* results,
+      struct _cef_list_value_t* exceptions);
+} cef_java_script_result_callback_t;
+
+
 ///
 // Structure used to represent a frame in the browser window. The functions of
 // this structure may be called on any thread unless otherwise indicated in the
@@ -152,6 +180,27 @@ typedef struct _cef_frame_t {
       const cef_string_t* jsCode, const cef_string_t* scriptUrl,
       int startLine);
 
+  ///
+  // Evaluate a string of JavaScript code in this frame and return the result to
+  // |callback|. The |scriptUrl| and |startLine| parameters have the same
+  // meaning as for execute_java_script(). |callback| is always executed. If
+  // |jsCode| is NULL the result will be null.
+  ///
+  void (CEF_CALLBACK *evaluate_java_script)(struct _cef_frame_t* self,
+      const cef_string_t* jsCode, const cef_string_t* scriptUrl, int startLine,
+      struct _cef_java_script_result_callback_t* callback);
+
+  ///
+  // Execute a list of JavaScript code strings in this frame using a single task
+  // on the UI thread. The scripts are executed in order and an exception in one
+  // script does not prevent the remaining scripts from executing. The
+  // |scriptUrl| parameter is used for error reporting. If |callback| is non-
+  // NULL it will be passed the results of all scripts.
+  ///
+  void (CEF_CALLBACK *execute_java_script_batch)(struct _cef_frame_t* self,
+      cef_string_list_t jsCodes, const cef_string_t* scriptUrl,
+      struct _cef_java_script_result_callback_t* callback);
+
   ///
   // Returns true (1) if this is the main (top-level) frame.
   ///
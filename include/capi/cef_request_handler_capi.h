@@ -144,7 +144,8 @@ typedef struct _cef_request_handler_t {
   // Called on the IO thread to retrieve the cookie manager. |main_url| is the
   // URL of the top-level frame. Cookies managers can be unique per browser or
   // shared across multiple browsers. The global cookie manager will be used if
-  // this function returns NULL.
+  // this function returns NULL. The result is cached until |main_url| changes
+  // or cef_browser_t::invalidate_cookie_manager() is called.
   ///
   struct _cef_cookie_manager_t* (CEF_CALLBACK *get_cookie_manager)(
       struct _cef_request_handler_t* self, struct _cef_browser_t* browser,
@@ -95,14 +95,20 @@ CEF_EXPORT int cef_register_custom_scheme(const cef_string_t* scheme_name,
 ///
 // Register a scheme handler factory for the specified |scheme_name| and
 // optional |domain_name|. An NULL |domain_name| value for a standard scheme
-// will cause the factory to match all domain names. The |domain_name| value
-// will be ignored for non-standard schemes. If |scheme_name| is a built-in
-// scheme and no handler is returned by |factory| then the built-in scheme
-// handler factory will be called. If |scheme_name| is a custom scheme the
-// cef_register_custom_scheme() function should be called for that scheme. This
-// function may be called multiple times to change or remove the factory that
-// matches the specified |scheme_name| and optional |domain_name|. Returns false
-// (0) if an error occurs. This function may be called on any thread.
+// will cause the factory to match all domain names. A |domain_name| value that
+// begins with "*." (for example, "*.example.com") will match all sub-domains of
+// the remaining domain name. The |domain_name| value may be followed by a path
+// prefix (for example, "example.com/assets") in which case the factory will
+// only match URLs whose path begins with the specified path segments. When
+// multiple factories match a request the most specific domain and then the
+// longest path prefix will be used. The |domain_name| value will be ignored for
+// non-standard schemes. If |scheme_name| is a built-in scheme and no handler is
+// returned by |factory| then the built-in scheme handler factory will be
+// called. If |scheme_name| is a custom scheme the cef_register_custom_scheme()
+// function should be called for that scheme. This function may be called
+// multiple times to change or remove the factory that matches the specified
+// |scheme_name| and optional |domain_name|. Returns false (0) if an error
+// occurs. This function may be called on any thread.
 ///
 CEF_EXPORT int cef_register_scheme_handler_factory(
     const cef_string_t* scheme_name, const cef_string_t* domain_name,
@@ -114,6 +120,35 @@ CEF_EXPORT int cef_register_scheme_handler_factory(
 ///
 CEF_EXPORT int cef_clear_scheme_handler_factories();
 
+///
+// Enable or disable cookie handling for requests with the specified
+// |scheme_name| that are handled by a cef_scheme_handler_t. Cookies are enabled
+// by default. When cookies are disabled the cookie store will not be queried
+// before cef_scheme_handler_t::process_request() is called and cookies returned
+// in the response headers will not be saved. Cookies are also skipped for
+// individual requests that do not allow cookies (for example, a
+// cef_web_urlrequest_t without the WUR_FLAG_ALLOW_COOKIES flag). Returns false
+// (0) on error. This function may be called on any thread.
+///
+CEF_EXPORT int cef_set_scheme_cookies_enabled(const cef_string_t* scheme_name,
+    int enabled);
+
+///
+// Enable or disable HTTP caching of responses for requests with the specified
+// |scheme_name| that are handled by a cef_scheme_handler_t. Caching is disabled
+// by default. When caching is enabled successful GET responses will be stored
+// in the HTTP cache subject to the Cache-Control and Expires headers returned
+// from cef_scheme_handler_t::get_response_headers(). Fresh cached responses
+// will be returned without calling cef_scheme_handler_t::process_request().
+// Stale cached responses that include an ETag or Last-Modified header will be
+// revalidated by adding If-None-Match or If-Modified-Since headers to the
+// request. Return a 304 status from
+// cef_scheme_handler_t::get_response_headers() to use the cached response.
+// Returns false (0) on error. This function may be called on any thread.
+///
+CEF_EXPORT int cef_set_scheme_cache_enabled(const cef_string_t* scheme_name,
+    int enabled);
+
 ///
 // Structure that creates cef_scheme_handler_t instances. The functions of this
 // structure will always be called on the IO thread.
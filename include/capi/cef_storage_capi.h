@@ -57,6 +57,18 @@ CEF_EXPORT int cef_visit_storage(enum cef_storage_type_t type,
     const cef_string_t* origin, const cef_string_t* key,
     struct _cef_storage_visitor_t* visitor);
 
+///
+// Visit storage of the specified type in batches of up to |batch_size|
+// key/value pairs. If |origin| is non-NULL only data matching that origin will
+// be visited. A snapshot of the matching data is taken when visiting begins and
+// each batch is delivered in a separate task so that the UI thread is not
+// blocked while visiting large amounts of data. Returns false (0) if the
+// storage cannot be accessed.
+///
+CEF_EXPORT int cef_visit_storage_batches(enum cef_storage_type_t type,
+    const cef_string_t* origin, int batch_size,
+    struct _cef_storage_batch_visitor_t* visitor);
+
 ///
 // Sets storage of the specified type, origin, key and value. Returns false (0)
 // if storage cannot be accessed. This function must be called on the UI thread.
@@ -75,6 +87,34 @@ CEF_EXPORT int cef_set_storage(enum cef_storage_type_t type,
 CEF_EXPORT int cef_delete_storage(enum cef_storage_type_t type,
     const cef_string_t* origin, const cef_string_t* key);
 
+///
+// Sets multiple storage values of the specified type and origin. |keys| and
+// |values| must have the same size. All values are set by a single task on the
+// UI thread. Returns false (0) if the arguments are invalid or if storage
+// cannot be accessed.
+///
+CEF_EXPORT int cef_set_storage_items(enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys,
+    cef_string_list_t values);
+
+///
+// Retrieves multiple storage values of the specified type and origin. The pairs
+// that exist for |keys| are delivered to |visitor| in a single batch. The
+// visitor will not be called if none of the keys exist. Returns false (0) if
+// storage cannot be accessed.
+///
+CEF_EXPORT int cef_get_storage_items(enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys,
+    struct _cef_storage_batch_visitor_t* visitor);
+
+///
+// Deletes multiple storage values of the specified type and origin. All values
+// are deleted by a single task on the UI thread. Returns false (0) if storage
+// cannot be accessed.
+///
+CEF_EXPORT int cef_delete_storage_items(enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys);
+
 ///
 // Sets the directory path that will be used for storing data of the specified
 // type. Currently only the ST_LOCALSTORAGE type is supported by this function.
@@ -85,6 +125,38 @@ CEF_EXPORT int cef_delete_storage(enum cef_storage_type_t type,
 CEF_EXPORT int cef_set_storage_path(enum cef_storage_type_t type,
     const cef_string_t* path);
 
+///
+// Register an observer that will be notified when storage values are changed.
+// Returns an identifier that can be passed to cef_remove_storage_observer() or
+// 0 if the storage cannot be accessed.
+///
+CEF_EXPORT int cef_add_storage_observer(
+    struct _cef_storage_observer_t* observer);
+
+///
+// Unregister the observer identified by |observer_id|, which was returned by
+// cef_add_storage_observer(). If this function is called on the UI thread the
+// observer will not be notified after it returns. Returns false (0) if the
+// storage cannot be accessed.
+///
+CEF_EXPORT int cef_remove_storage_observer(int observer_id);
+
+///
+// Returns the approximate number of bytes held in memory by storage of the
+// specified type. This function must be called on the UI thread.
+///
+CEF_EXPORT int64 cef_get_storage_memory_usage(enum cef_storage_type_t type);
+
+///
+// Writes any pending changes for storage of the specified type to disk.
+// Currently only the ST_LOCALSTORAGE type is supported by this function. This
+// is only necessary when CefSettings.consolidated_local_storage is true (1). If
+// |task| is non-NULL it will be executed on the FILE thread after the changes
+// have been written. Returns false (0) if the storage cannot be accessed.
+///
+CEF_EXPORT int cef_flush_storage(enum cef_storage_type_t type,
+    struct _cef_task_t* task);
+
 ///
 // Structure to implement for visiting storage. The functions of this structure
 // will always be called on the UI thread.
@@ -109,6 +181,110 @@ typedef struct _cef_storage_visitor_t {
 } cef_storage_visitor_t;
 
 
+///
+// Structure to implement for visiting storage in batches. The functions of this
+// structure will always be called on the UI thread.
+///
+typedef struct _cef_storage_batch_visitor_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called once for each batch of key/value data pairs from
+  // a single origin. |keys| and |values| have the same size. |count| is the
+  // 0-based index of the first pair in the batch. |total| is the total number
+  // of pairs. Return false (0) to stop visiting batches. This function may
+  // never be called if no data is found.
+  ///
+  int (CEF_CALLBACK *visit)(struct _cef_storage_batch_visitor_t* self,
+      enum cef_storage_type_t type, const cef_string_t* origin,
+      cef_string_list_t keys, cef_string_list_t values, int count, int total);
+} cef_storage_batch_visitor_t;
+
+
+///
+// Structure representing a list of storage changes. The functions of this
+// structure may be called on any thread.
+///
+typedef struct _cef_storage_changes_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Returns the number of changes.
+  ///
+  int (CEF_CALLBACK *get_count)(struct _cef_storage_changes_t* self);
+
+  ///
+  // Returns the storage type for the change at |index|.
+  ///
+  enum cef_storage_type_t (CEF_CALLBACK *get_storage_type)(
+      struct _cef_storage_changes_t* self, int index);
+
+  ///
+  // Returns the type of the change at |index|.
+  ///
+  enum cef_storage_change_type_t (CEF_CALLBACK *get_change_type)(
+      struct _cef_storage_changes_t* self, int index);
+
+  ///
+  // Returns the origin for the change at |index|.
+  ///
+  // The resulting string must be freed by calling cef_string_userfree_free().
+  cef_string_userfree_t (CEF_CALLBACK *get_origin)(
+      struct _cef_storage_changes_t* self, int index);
+
+  ///
+  // Returns the key for the change at |index|. The key will be NULL for
+  // SCT_CLEAR changes.
+  ///
+  // The resulting string must be freed by calling cef_string_userfree_free().
+  cef_string_userfree_t (CEF_CALLBACK *get_key)(
+      struct _cef_storage_changes_t* self, int index);
+
+  ///
+  // Returns the value before the change at |index|. The value will be NULL if
+  // the key did not previously exist or for SCT_CLEAR changes. A key that did
+  // not exist cannot be distinguished from a key with an NULL value.
+  ///
+  // The resulting string must be freed by calling cef_string_userfree_free().
+  cef_string_userfree_t (CEF_CALLBACK *get_old_value)(
+      struct _cef_storage_changes_t* self, int index);
+
+  ///
+  // Returns the value after the change at |index|. The value will be NULL for
+  // SCT_REMOVE and SCT_CLEAR changes.
+  ///
+  // The resulting string must be freed by calling cef_string_userfree_free().
+  cef_string_userfree_t (CEF_CALLBACK *get_new_value)(
+      struct _cef_storage_changes_t* self, int index);
+} cef_storage_changes_t;
+
+
+///
+// Structure to implement for observing storage changes. The functions of this
+// structure will always be called on the UI thread.
+///
+typedef struct _cef_storage_observer_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called with the changes made to storage values. Changes made during a
+  // single task on the UI thread are delivered together in the order that they
+  // occurred.
+  ///
+  void (CEF_CALLBACK *on_storage_changed)(struct _cef_storage_observer_t* self,
+      struct _cef_storage_changes_t* changes);
+} cef_storage_observer_t;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -104,6 +104,56 @@ extern "C" {
 CEF_EXPORT int cef_register_extension(const cef_string_t* extension_name,
     const cef_string_t* javascript_code, struct _cef_v8handler_t* handler);
 
+///
+// Retrieve statistics for the V8 heap. The heap is shared by all V8 contexts;
+// use cef_v8context_t::get_tracked_object_count() and
+// cef_v8context_t::get_externally_allocated_memory() for per-context values.
+// This function should only be called on the UI thread.
+///
+CEF_EXPORT int cef_get_v8heap_statistics(cef_v8heap_statistics_t* statistics);
+
+///
+// Register a handler that will be notified after V8 garbage collections.
+// Returns an identifier that can be passed to cef_remove_v8gchandler() or 0 on
+// failure. The same handler may be registered multiple times and each
+// registration receives a unique identifier. This function may be called on any
+// thread.
+///
+CEF_EXPORT int cef_add_v8gchandler(struct _cef_v8gchandler_t* handler);
+
+///
+// Unregister a handler using the identifier returned by cef_add_v8gchandler().
+// This function may be called on any thread.
+///
+CEF_EXPORT int cef_remove_v8gchandler(int handler_id);
+
+///
+// Notify V8 that the application is idle so that it can perform garbage
+// collection and other cleanup work. |hint| is the amount of work to perform,
+// from 1 to 1000; a larger value may result in a longer pause. Returns true (1)
+// if V8 has no further cleanup work to perform and the function does not need
+// to be called again until script has executed. This function should only be
+// called on the UI thread.
+///
+CEF_EXPORT int cef_v8idle_notification(int hint);
+
+///
+// Notify V8 that the system is running low on memory. V8 will perform a full
+// garbage collection and release as much memory as possible. This function may
+// be called on any thread.
+///
+CEF_EXPORT void cef_v8low_memory_notification();
+
+///
+// Retrieve statistics for the cache of precompiled script data used by
+// cef_frame_t::execute_java_script(). Values are cumulative for the lifespan of
+// the application; compare the values before and after a frame loads to
+// determine the compile time for that frame. This function should only be
+// called on the UI thread.
+///
+CEF_EXPORT int cef_get_v8script_cache_statistics(
+    cef_v8script_cache_statistics_t* statistics);
+
 ///
 // Structure that encapsulates a V8 context handle.
 ///
@@ -151,6 +201,22 @@ typedef struct _cef_v8context_t {
   ///
   int (CEF_CALLBACK *is_same)(struct _cef_v8context_t* self,
       struct _cef_v8context_t* that);
+
+  ///
+  // Returns the number of V8 objects in this context that currently hold
+  // references to native handlers, accessors, user data or byte array buffers.
+  // These references are released when the V8 object is garbage collected or
+  // when the context is released, whichever comes first.
+  ///
+  int (CEF_CALLBACK *get_tracked_object_count)(struct _cef_v8context_t* self);
+
+  ///
+  // Returns the total number of bytes reported via
+  // cef_v8value_t::adjust_externally_allocated_memory() for tracked objects in
+  // this context.
+  ///
+  int (CEF_CALLBACK *get_externally_allocated_memory)(
+      struct _cef_v8context_t* self);
 } cef_v8context_t;
 
 
@@ -194,6 +260,83 @@ typedef struct _cef_v8handler_t {
 } cef_v8handler_t;
 
 
+///
+// Structure used to complete an asynchronous V8 function call. The functions of
+// this structure may be called on any thread.
+///
+typedef struct _cef_v8async_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Complete the call successfully. The JavaScript callback function will be
+  // executed on the UI thread with null as the first argument followed by the
+  // elements of |results|, converted as described for
+  // cef_v8value_t::cef_v8value_create_from_list().
+  ///
+  void (CEF_CALLBACK *success)(struct _cef_v8async_callback_t* self,
+      struct _cef_list_value_t* results);
+
+  ///
+  // Complete the call with an error. The JavaScript callback function will be
+  // executed on the UI thread with an Error object created from |exception| as
+  // the only argument.
+  ///
+  void (CEF_CALLBACK *failure)(struct _cef_v8async_callback_t* self,
+      const cef_string_t* exception);
+} cef_v8async_callback_t;
+
+
+///
+// Structure that should be implemented to handle asynchronous V8 function
+// calls. The functions of this structure will be called on a worker thread and
+// multiple calls may execute at the same time.
+///
+typedef struct _cef_v8async_handler_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Handle execution of the function identified by |name|. |arguments| is the
+  // list of arguments passed to the function, excluding the callback function,
+  // converted as described for cef_v8value_t::get_list_value(). Execute
+  // |callback| exactly once, on any thread, when execution is complete. The
+  // call fails if |callback| is released without being executed.
+  ///
+  void (CEF_CALLBACK *execute)(struct _cef_v8async_handler_t* self,
+      const cef_string_t* name, struct _cef_list_value_t* arguments,
+      struct _cef_v8async_callback_t* callback);
+} cef_v8async_handler_t;
+
+
+///
+// Structure that should be implemented to receive notification of V8 garbage
+// collections. The functions of this structure will be called on the UI thread.
+///
+typedef struct _cef_v8gchandler_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called after V8 has completed one or more garbage collections. Collections
+  // that complete before a pending notification is delivered are combined into
+  // a single notification. |full| is true (1) if any of the collections was a
+  // full mark-sweep-compact collection and false (0) if only the young
+  // generation was collected. |pause_time| is the total time in milliseconds
+  // that script execution was paused. |statistics| describes the heap after
+  // collection.
+  ///
+  void (CEF_CALLBACK *on_garbage_collection)(struct _cef_v8gchandler_t* self,
+      int full, double pause_time, const cef_v8heap_statistics_t* statistics);
+} cef_v8gchandler_t;
+
+
 ///
 // Structure that should be implemented to handle V8 accessor calls. Accessor
 // identifiers are registered by calling cef_v8value_t::set_value_byaccessor().
@@ -229,6 +372,26 @@ typedef struct _cef_v8accessor_t {
 } cef_v8accessor_t;
 
 
+///
+// Structure that should be implemented to release the memory backing a byte
+// array created with cef_v8value_t::cef_v8value_create_byte_array(). The
+// functions of this structure will always be called on the UI thread.
+///
+typedef struct _cef_v8byte_array_release_handler_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called after the byte array backed by |buffer| has been garbage collected
+  // or the V8 context has been destroyed. |buffer| will no longer be accessed.
+  ///
+  void (CEF_CALLBACK *release_buffer)(
+      struct _cef_v8byte_array_release_handler_t* self, void* buffer);
+} cef_v8byte_array_release_handler_t;
+
+
 ///
 // Structure representing a V8 exception.
 ///
@@ -292,6 +455,89 @@ typedef struct _cef_v8exception_t {
 } cef_v8exception_t;
 
 
+///
+// Structure representing an interned V8 property name. Create a property name
+// once and pass it to the cef_v8value_t functions that accept a
+// cef_v8property_name_t to avoid converting the same name to a new V8 string on
+// every property access. A property name can be used with objects in any V8
+// context. The functions of this structure should only be called on the UI
+// thread.
+///
+typedef struct _cef_v8property_name_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Returns the property name.
+  ///
+  // The resulting string must be freed by calling cef_string_userfree_free().
+  cef_string_userfree_t (CEF_CALLBACK *get_name)(
+      struct _cef_v8property_name_t* self);
+} cef_v8property_name_t;
+
+
+///
+// Create a new cef_v8property_name_t object for |name|. Names are interned by
+// V8 so creating the same name more than once is cheap but unnecessary.
+///
+CEF_EXPORT cef_v8property_name_t* cef_v8property_name_create(
+    const cef_string_t* name);
+
+
+///
+// Structure representing a reusable template for native functions. Functions
+// created from a template share a single V8 function template and handler
+// registration so creating them is much cheaper than calling
+// cef_v8value_t::cef_v8value_create_function(). A template creates one function
+// object per V8 context; repeated calls to get_function() in the same context
+// return the same function object. Properties assigned to that object are
+// therefore visible everywhere the function is used. Call
+// cef_v8value_t::cef_v8value_create_function() instead if each use requires a
+// separate function object. The functions of this structure should only be
+// called on the UI thread.
+///
+typedef struct _cef_v8function_template_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Returns the function name.
+  ///
+  // The resulting string must be freed by calling cef_string_userfree_free().
+  cef_string_userfree_t (CEF_CALLBACK *get_name)(
+      struct _cef_v8function_template_t* self);
+
+  ///
+  // Returns the function handler.
+  ///
+  struct _cef_v8handler_t* (CEF_CALLBACK *get_handler)(
+      struct _cef_v8function_template_t* self);
+
+  ///
+  // Returns the function for the current V8 context. The same function object
+  // is returned each time this function is called in the same context. This
+  // function should only be called from within the scope of a
+  // cef_v8context_tHandler, cef_v8handler_t or cef_v8accessor_t callback, or in
+  // combination with calling enter() and exit() on a stored cef_v8context_t
+  // reference.
+  ///
+  struct _cef_v8value_t* (CEF_CALLBACK *get_function)(
+      struct _cef_v8function_template_t* self);
+} cef_v8function_template_t;
+
+
+///
+// Create a new cef_v8function_template_t object for functions named |name| that
+// are handled by |handler|.
+///
+CEF_EXPORT cef_v8function_template_t* cef_v8function_template_create(
+    const cef_string_t* name, cef_v8handler_t* handler);
+
+
 ///
 // Structure representing a V8 value. The functions of this structure should
 // only be called on the UI thread.
@@ -347,6 +593,13 @@ typedef struct _cef_v8value_t {
   ///
   int (CEF_CALLBACK *is_array)(struct _cef_v8value_t* self);
 
+  ///
+  // True if the value type is byte array. This includes values created with
+  // cef_v8value_create_byte_array() and JavaScript Uint8Array, Int8Array and
+  // Uint8ClampedArray objects.
+  ///
+  int (CEF_CALLBACK *is_byte_array)(struct _cef_v8value_t* self);
+
   ///
   // True if the value type is function.
   ///
@@ -407,6 +660,13 @@ typedef struct _cef_v8value_t {
   ///
   int (CEF_CALLBACK *has_value_byindex)(struct _cef_v8value_t* self, int index);
 
+  ///
+  // Returns true (1) if the object has a value with the specified property
+  // name.
+  ///
+  int (CEF_CALLBACK *has_value_byname)(struct _cef_v8value_t* self,
+      struct _cef_v8property_name_t* name);
+
   ///
   // Delete the value with the specified identifier.
   ///
@@ -431,6 +691,12 @@ typedef struct _cef_v8value_t {
   struct _cef_v8value_t* (CEF_CALLBACK *get_value_byindex)(
       struct _cef_v8value_t* self, int index);
 
+  ///
+  // Returns the value with the specified property name.
+  ///
+  struct _cef_v8value_t* (CEF_CALLBACK *get_value_byname)(
+      struct _cef_v8value_t* self, struct _cef_v8property_name_t* name);
+
   ///
   // Associate a value with the specified identifier.
   ///
@@ -444,6 +710,13 @@ typedef struct _cef_v8value_t {
   int (CEF_CALLBACK *set_value_byindex)(struct _cef_v8value_t* self, int index,
       struct _cef_v8value_t* value);
 
+  ///
+  // Associate a value with the specified property name.
+  ///
+  int (CEF_CALLBACK *set_value_byname)(struct _cef_v8value_t* self,
+      struct _cef_v8property_name_t* name, struct _cef_v8value_t* value,
+      enum cef_v8_propertyattribute_t attribute);
+
   ///
   // Register an identifier whose access will be forwarded to the
   // cef_v8accessor_t instance passed to
@@ -487,6 +760,17 @@ typedef struct _cef_v8value_t {
   int (CEF_CALLBACK *adjust_externally_allocated_memory)(
       struct _cef_v8value_t* self, int change_in_bytes);
 
+  ///
+  // Returns the contents of this object converted to a new dictionary value in
+  // a single call. Nested objects are converted to dictionaries, arrays to
+  // lists and Date values to the number of milliseconds since the epoch.
+  // Function and undefined values are omitted. Returns NULL if the object
+  // contains a cycle, is nested too deeply or a property getter throws an
+  // exception.
+  ///
+  struct _cef_dictionary_value_t* (CEF_CALLBACK *get_dictionary_value)(
+      struct _cef_v8value_t* self);
+
 
   // ARRAY METHODS - These functions are only available on arrays.
 
@@ -495,6 +779,31 @@ typedef struct _cef_v8value_t {
   ///
   int (CEF_CALLBACK *get_array_length)(struct _cef_v8value_t* self);
 
+  ///
+  // Returns the contents of this array converted to a new list value in a
+  // single call. Elements are converted as described for get_dictionary_value()
+  // except that function and undefined elements become null. Returns NULL if
+  // the array contains a cycle, is nested too deeply or a property getter
+  // throws an exception.
+  ///
+  struct _cef_list_value_t* (CEF_CALLBACK *get_list_value)(
+      struct _cef_v8value_t* self);
+
+
+  // BYTE ARRAY METHODS - These functions are only available on byte arrays.
+
+  ///
+  // Returns a pointer to the memory backing the byte array. The memory is not
+  // copied and may be read or modified directly. It remains valid for as long
+  // as a reference to this object is held.
+  ///
+  void* (CEF_CALLBACK *get_byte_array_data)(struct _cef_v8value_t* self);
+
+  ///
+  // Returns the number of bytes in the byte array.
+  ///
+  int (CEF_CALLBACK *get_byte_array_length)(struct _cef_v8value_t* self);
+
 
   // FUNCTION METHODS - These functions are only available on functions.
 
@@ -598,15 +907,70 @@ CEF_EXPORT cef_v8value_t* cef_v8value_create_object_with_accessor(
 ///
 CEF_EXPORT cef_v8value_t* cef_v8value_create_array();
 
+///
+// Create a new cef_v8value_t object of type byte array whose elements are the
+// |length| bytes starting at |buffer|. JavaScript reads and writes the memory
+// directly without copying it. The memory must remain valid until
+// |release_handler| is executed, or for the lifetime of the V8 context if
+// |release_handler| is NULL. |buffer| may be NULL if |length| is 0. This
+// function should only be called from within the scope of a
+// cef_v8context_tHandler, cef_v8handler_t or cef_v8accessor_t callback, or in
+// combination with calling enter() and exit() on a stored cef_v8context_t
+// reference.
+///
+CEF_EXPORT cef_v8value_t* cef_v8value_create_byte_array(void* buffer,
+    int length, cef_v8byte_array_release_handler_t* release_handler);
+
 ///
 // Create a new cef_v8value_t object of type function. This function should only
 // be called from within the scope of a cef_v8context_tHandler, cef_v8handler_t
 // or cef_v8accessor_t callback, or in combination with calling enter() and
-// exit() on a stored cef_v8context_t reference.
+// exit() on a stored cef_v8context_t reference. Each call returns a new
+// function object that V8 retains until the context is released. Use
+// cef_v8function_template_t when the same function is created repeatedly.
 ///
 CEF_EXPORT cef_v8value_t* cef_v8value_create_function(const cef_string_t* name,
     cef_v8handler_t* handler);
 
+///
+// Create a new cef_v8value_t object of type function that executes |handler|
+// asynchronously. When the function is called its arguments are converted to a
+// cef_list_value_t on the UI thread and |handler| is executed on a worker
+// thread. If the last argument is a function it is not passed to |handler|.
+// Instead it is called in the original context when execution completes, with
+// an error or null as the first argument followed by the results. The function
+// itself returns undefined. This function should only be called from within the
+// scope of a cef_v8context_tHandler, cef_v8handler_t or cef_v8accessor_t
+// callback, or in combination with calling enter() and exit() on a stored
+// cef_v8context_t reference.
+///
+CEF_EXPORT cef_v8value_t* cef_v8value_create_async_function(
+    const cef_string_t* name, cef_v8async_handler_t* handler);
+
+///
+// Create a new cef_v8value_t object of type object from the contents of |value|
+// in a single call. Nested dictionaries are converted to objects and nested
+// lists are converted to arrays. Returns NULL if |value| contains a cycle or is
+// nested too deeply. This function should only be called from within the scope
+// of a cef_v8context_tHandler, cef_v8handler_t or cef_v8accessor_t callback, or
+// in combination with calling enter() and exit() on a stored cef_v8context_t
+// reference.
+///
+CEF_EXPORT cef_v8value_t* cef_v8value_create_from_dictionary(
+    struct _cef_dictionary_value_t* value);
+
+///
+// Create a new cef_v8value_t object of type array from the contents of |value|
+// in a single call. Nested dictionaries are converted to objects and nested
+// lists are converted to arrays. Returns NULL if |value| contains a cycle or is
+// nested too deeply. This function should only be called from within the scope
+// of a cef_v8context_tHandler, cef_v8handler_t or cef_v8accessor_t callback, or
+// in combination with calling enter() and exit() on a stored cef_v8context_t
+// reference.
+///
+CEF_EXPORT cef_v8value_t* cef_v8value_create_from_list(
+    struct _cef_list_value_t* value);
+
 
 #ifdef __cplusplus
 }
@@ -238,6 +238,14 @@ class CefBrowser : public virtual CefBase {
   /*--cef()--*/
   virtual void CloseDevTools() =0;
 
+  ///
+  // Discard the cookie manager that was returned for this browser by
+  // CefRequestHandler::GetCookieManager(). The cookie manager is otherwise
+  // cached until the URL of the top-level frame changes.
+  ///
+  /*--cef()--*/
+  virtual void InvalidateCookieManager() =0;
+
   ///
   // Returns true if window rendering is disabled.
   ///
@@ -38,8 +38,11 @@
 #define CEF_INCLUDE_CEF_COOKIE_H_
 #pragma once
 
+#include <vector>
 #include "include/cef_base.h"
 
+class CefCookieExportHandler;
+class CefCookiePageVisitor;
 class CefCookieVisitor;
 
 
@@ -64,6 +67,19 @@ class CefCookieManager : public virtual CefBase {
   /*--cef(optional_param=path)--*/
   static CefRefPtr<CefCookieManager> CreateManager(const CefString& path);
 
+  ///
+  // Creates a new cookie manager for the cookie partition identified by
+  // |partition|. Cookie managers that store data in the same |path| share a
+  // single database and commit schedule while the cookies of each partition
+  // remain separate. A manager created with CreateManager() uses the empty
+  // partition. If |path| is empty data will be stored in memory only. Returns
+  // NULL if creation fails.
+  ///
+  /*--cef(optional_param=path,optional_param=partition)--*/
+  static CefRefPtr<CefCookieManager> CreatePartitionedManager(
+      const CefString& path,
+      const CefString& partition);
+
   ///
   // Visit all cookies. The returned cookies are ordered by longest path, then
   // by earliest creation date. Returns false if cookies cannot be accessed.
@@ -82,6 +98,25 @@ class CefCookieManager : public virtual CefBase {
   virtual bool VisitUrlCookies(const CefString& url, bool includeHttpOnly,
                                CefRefPtr<CefCookieVisitor> visitor) =0;
 
+  ///
+  // Visit cookies in pages of up to |page_size| cookies. If |domain| is
+  // non-empty only cookies for that domain and its subdomains will be included.
+  // If |name| is non-empty only cookies with that name will be included.
+  // Cookies are ordered by domain, name, path and creation date and each page
+  // is delivered by a separate task on the IO thread. If |cursor| is empty the
+  // visit starts at the first cookie. To resume a visit at a later time pass
+  // the |next_cursor| value from the last page that was visited. Cookies that
+  // are added or removed in between do not cause other cookies to be skipped
+  // or repeated. Returns false if cookies cannot be accessed or if |cursor| is
+  // invalid.
+  ///
+  /*--cef(optional_param=domain,optional_param=name,optional_param=cursor)--*/
+  virtual bool VisitCookiePages(const CefString& domain,
+                                const CefString& name,
+                                int page_size,
+                                const CefString& cursor,
+                                CefRefPtr<CefCookiePageVisitor> visitor) =0;
+
   ///
   // Sets a cookie given a valid URL and explicit user-provided cookie
   // attributes. This function expects each attribute to be well-formed. It will
@@ -106,6 +141,46 @@ class CefCookieManager : public virtual CefBase {
   virtual bool DeleteCookies(const CefString& url,
                              const CefString& cookie_name) =0;
 
+  ///
+  // Sets multiple cookies for the given valid URL. Each entry in
+  // |cookie_lines| uses the Set-Cookie header format (for example,
+  // "name=value; path=/; expires=Wed, 13-Jan-2021 22:23:01 GMT; HttpOnly").
+  // All cookies are set by a single task on the IO thread and written to the
+  // persistent store together. Returns false if the URL is invalid or if
+  // cookies cannot be accessed.
+  ///
+  /*--cef()--*/
+  virtual bool SetCookies(const CefString& url,
+                          const std::vector<CefString>& cookie_lines) =0;
+
+  ///
+  // Delete cookies for multiple URLs. For each entry in |urls| this behaves
+  // like calling DeleteCookies() with that URL and |cookie_name|. All cookies
+  // are deleted by a single task on the IO thread. Invalid URLs are ignored.
+  // Returns false if cookies cannot be accessed.
+  ///
+  /*--cef(optional_param=cookie_name)--*/
+  virtual bool DeleteUrlCookies(const std::vector<CefString>& urls,
+                                const CefString& cookie_name) =0;
+
+  ///
+  // Serialize all cookies. |handler| will be called on the IO thread with the
+  // serialized data which can later be passed to ImportCookies(). Returns
+  // false if cookies cannot be accessed.
+  ///
+  /*--cef()--*/
+  virtual bool ExportCookies(CefRefPtr<CefCookieExportHandler> handler) =0;
+
+  ///
+  // Set all cookies from |data| as returned by ExportCookies(). Cookie
+  // creation and last access times are not preserved. All cookies are set by
+  // a single task on the IO thread and written to the persistent store
+  // together. Returns false if |data| is not in the expected format or if
+  // cookies cannot be accessed.
+  ///
+  /*--cef()--*/
+  virtual bool ImportCookies(const CefString& data) =0;
+
   ///
   // Sets the directory path that will be used for storing cookie data. If
   // |path| is empty data will be stored in memory only. Returns false if
@@ -113,6 +188,17 @@ class CefCookieManager : public virtual CefBase {
   ///
   /*--cef(optional_param=path)--*/
   virtual bool SetStoragePath(const CefString& path) =0;
+
+  ///
+  // Populate |metrics| with information about how cookies were loaded from the
+  // persistent store. Cookies for a domain are loaded on demand when first
+  // accessed while all other cookies are loaded in the background after the
+  // delay specified by CefSettings.cookie_background_load_delay. Returns false
+  // if cookie data is stored in memory only. This method must be called on the
+  // IO thread.
+  ///
+  /*--cef()--*/
+  virtual bool GetLoadMetrics(CefCookieLoadMetrics& metrics) =0;
 };
 
 
@@ -135,4 +221,63 @@ class CefCookieVisitor : public virtual CefBase {
                      bool& deleteCookie) =0;
 };
 
+
+///
+// Class representing a page of cookies. The methods of this class may be
+// called on any thread.
+///
+/*--cef(source=library)--*/
+class CefCookiePage : public virtual CefBase {
+ public:
+  ///
+  // Returns the number of cookies in this page.
+  ///
+  /*--cef()--*/
+  virtual int GetCount() =0;
+
+  ///
+  // Retrieve the cookie at the specified 0-based |index|. Returns false if
+  // |index| is out of range.
+  ///
+  /*--cef()--*/
+  virtual bool GetCookie(int index, CefCookie& cookie) =0;
+};
+
+
+///
+// Interface to implement for visiting pages of cookies. The methods of this
+// class will always be called on the IO thread.
+///
+/*--cef(source=client)--*/
+class CefCookiePageVisitor : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called once for each page of cookies. The method will
+  // be called at least once, in which case |page| may be empty. |next_cursor|
+  // identifies the last cookie in this page and |total| is the total number of
+  // matching cookies. |next_cursor| is empty for the last page. |page| may be
+  // retained and used on other threads. Return false to stop visiting cookies.
+  ///
+  /*--cef(optional_param=next_cursor)--*/
+  virtual bool Visit(CefRefPtr<CefCookiePage> page,
+                     const CefString& next_cursor,
+                     int total) =0;
+};
+
+
+///
+// Interface to implement for receiving exported cookie data. The methods of
+// this class will always be called on the IO thread.
+///
+/*--cef(source=client)--*/
+class CefCookieExportHandler : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called with the serialized cookie data. |count| is the
+  // number of cookies that were exported.
+  ///
+  /*--cef()--*/
+  virtual void OnCookiesExported(const CefString& data, int count) =0;
+};
+
 #endif  // CEF_INCLUDE_CEF_COOKIE_H_
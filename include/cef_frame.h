@@ -42,10 +42,35 @@
 #include "include/cef_dom.h"
 #include "include/cef_request.h"
 #include "include/cef_stream.h"
+#include "include/cef_values.h"
+#include <vector>
 
 class CefBrowser;
 class CefV8Context;
 
+///
+// Interface to implement for receiving the results of
+// CefFrame::EvaluateJavaScript() and CefFrame::ExecuteJavaScriptBatch(). The
+// methods of this class will be called on the UI thread.
+///
+/*--cef(source=client)--*/
+class CefJavaScriptResultCallback : public virtual CefBase {
+ public:
+  ///
+  // Called after the scripts have executed. |results| and |exceptions| contain
+  // one entry for each script in the order that the scripts were executed.
+  // |results| contains the value of each script converted to a simple value,
+  // list or dictionary. Undefined values and values that cannot be converted
+  // are represented as null. |exceptions| contains the message of the
+  // exception thrown by each script or an empty string if the script completed
+  // successfully.
+  ///
+  /*--cef()--*/
+  virtual void OnComplete(CefRefPtr<CefListValue> results,
+                          CefRefPtr<CefListValue> exceptions) =0;
+};
+
+
 ///
 // Class used to represent a frame in the browser window. The methods of this
 // class may be called on any thread unless otherwise indicated in the comments.
@@ -155,6 +180,32 @@ class CefFrame : public virtual CefBase {
                                  const CefString& scriptUrl,
                                  int startLine) =0;
 
+  ///
+  // Evaluate a string of JavaScript code in this frame and return the result
+  // to |callback|. The |scriptUrl| and |startLine| parameters have the same
+  // meaning as for ExecuteJavaScript(). |callback| is always executed. If
+  // |jsCode| is empty the result will be null.
+  ///
+  /*--cef(optional_param=jsCode,optional_param=scriptUrl)--*/
+  virtual void EvaluateJavaScript(
+      const CefString& jsCode,
+      const CefString& scriptUrl,
+      int startLine,
+      CefRefPtr<CefJavaScriptResultCallback> callback) =0;
+
+  ///
+  // Execute a list of JavaScript code strings in this frame using a single task
+  // on the UI thread. The scripts are executed in order and an exception in one
+  // script does not prevent the remaining scripts from executing. The
+  // |scriptUrl| parameter is used for error reporting. If |callback| is
+  // non-NULL it will be passed the results of all scripts.
+  ///
+  /*--cef(optional_param=scriptUrl,optional_param=callback)--*/
+  virtual void ExecuteJavaScriptBatch(
+      const std::vector<CefString>& jsCodes,
+      const CefString& scriptUrl,
+      CefRefPtr<CefJavaScriptResultCallback> callback) =0;
+
   ///
   // Returns true if this is the main (top-level) frame.
   ///
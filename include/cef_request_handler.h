@@ -160,7 +160,8 @@ class CefRequestHandler : public virtual CefBase {
   // Called on the IO thread to retrieve the cookie manager. |main_url| is the
   // URL of the top-level frame. Cookies managers can be unique per browser or
   // shared across multiple browsers. The global cookie manager will be used if
-  // this method returns NULL.
+  // this method returns NULL. The result is cached until |main_url| changes or
+  // CefBrowser::InvalidateCookieManager() is called.
   ///
   /*--cef()--*/
   virtual CefRefPtr<CefCookieManager> GetCookieManager(
@@ -100,8 +100,14 @@ bool CefRegisterCustomScheme(const CefString& scheme_name,
 ///
 // Register a scheme handler factory for the specified |scheme_name| and
 // optional |domain_name|. An empty |domain_name| value for a standard scheme
-// will cause the factory to match all domain names. The |domain_name| value
-// will be ignored for non-standard schemes. If |scheme_name| is a built-in
+// will cause the factory to match all domain names. A |domain_name| value that
+// begins with "*." (for example, "*.example.com") will match all sub-domains
+// of the remaining domain name. The |domain_name| value may be followed by a
+// path prefix (for example, "example.com/assets") in which case the factory
+// will only match URLs whose path begins with the specified path segments.
+// When multiple factories match a request the most specific domain and then
+// the longest path prefix will be used. The |domain_name| value will be
+// ignored for non-standard schemes. If |scheme_name| is a built-in
 // scheme and no handler is returned by |factory| then the built-in scheme
 // handler factory will be called. If |scheme_name| is a custom scheme the
 // CefRegisterCustomScheme() function should be called for that scheme.
@@ -121,6 +127,34 @@ bool CefRegisterSchemeHandlerFactory(const CefString& scheme_name,
 /*--cef()--*/
 bool CefClearSchemeHandlerFactories();
 
+///
+// Enable or disable cookie handling for requests with the specified
+// |scheme_name| that are handled by a CefSchemeHandler. Cookies are enabled by
+// default. When cookies are disabled the cookie store will not be queried
+// before CefSchemeHandler::ProcessRequest() is called and cookies returned in
+// the response headers will not be saved. Cookies are also skipped for
+// individual requests that do not allow cookies (for example, a
+// CefWebURLRequest without the WUR_FLAG_ALLOW_COOKIES flag). Returns false on
+// error. This function may be called on any thread.
+///
+/*--cef()--*/
+bool CefSetSchemeCookiesEnabled(const CefString& scheme_name, bool enabled);
+
+///
+// Enable or disable HTTP caching of responses for requests with the specified
+// |scheme_name| that are handled by a CefSchemeHandler. Caching is disabled by
+// default. When caching is enabled successful GET responses will be stored in
+// the HTTP cache subject to the Cache-Control and Expires headers returned
+// from CefSchemeHandler::GetResponseHeaders(). Fresh cached responses will be
+// returned without calling CefSchemeHandler::ProcessRequest(). Stale cached
+// responses that include an ETag or Last-Modified header will be revalidated
+// by adding If-None-Match or If-Modified-Since headers to the request. Return
+// a 304 status from CefSchemeHandler::GetResponseHeaders() to use the cached
+// response. Returns false on error. This function may be called on any thread.
+///
+/*--cef()--*/
+bool CefSetSchemeCacheEnabled(const CefString& scheme_name, bool enabled);
+
 
 ///
 // Class that creates CefSchemeHandler instances. The methods of this class will
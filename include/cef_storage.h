@@ -38,11 +38,16 @@
 #define CEF_INCLUDE_CEF_STORAGE_H_
 #pragma once
 
+#include <vector>
 #include "include/cef_base.h"
+#include "include/cef_task.h"
 
+class CefStorageBatchVisitor;
+class CefStorageObserver;
 class CefStorageVisitor;
 
 typedef cef_storage_type_t CefStorageType;
+typedef cef_storage_change_type_t CefStorageChangeType;
 
 ///
 // Visit storage of the specified type. If |origin| is non-empty only data
@@ -57,6 +62,19 @@ bool CefVisitStorage(CefStorageType type, const CefString& origin,
                      const CefString& key,
                      CefRefPtr<CefStorageVisitor> visitor);
 
+///
+// Visit storage of the specified type in batches of up to |batch_size|
+// key/value pairs. If |origin| is non-empty only data matching that origin
+// will be visited. A snapshot of the matching data is taken when visiting
+// begins and each batch is delivered in a separate task so that the UI thread
+// is not blocked while visiting large amounts of data. Returns false if the
+// storage cannot be accessed.
+///
+/*--cef(optional_param=origin)--*/
+bool CefVisitStorageBatches(CefStorageType type, const CefString& origin,
+                            int batch_size,
+                            CefRefPtr<CefStorageBatchVisitor> visitor);
+
 ///
 // Sets storage of the specified type, origin, key and value. Returns false if
 // storage cannot be accessed. This method must be called on the UI thread.
@@ -76,6 +94,37 @@ bool CefSetStorage(CefStorageType type, const CefString& origin,
 bool CefDeleteStorage(CefStorageType type, const CefString& origin,
                       const CefString& key);
 
+///
+// Sets multiple storage values of the specified type and origin. |keys| and
+// |values| must have the same size. All values are set by a single task on the
+// UI thread. Returns false if the arguments are invalid or if storage cannot be
+// accessed.
+///
+/*--cef()--*/
+bool CefSetStorageItems(CefStorageType type, const CefString& origin,
+                        const std::vector<CefString>& keys,
+                        const std::vector<CefString>& values);
+
+///
+// Retrieves multiple storage values of the specified type and origin. The
+// pairs that exist for |keys| are delivered to |visitor| in a single batch.
+// The visitor will not be called if none of the keys exist. Returns false if
+// storage cannot be accessed.
+///
+/*--cef()--*/
+bool CefGetStorageItems(CefStorageType type, const CefString& origin,
+                        const std::vector<CefString>& keys,
+                        CefRefPtr<CefStorageBatchVisitor> visitor);
+
+///
+// Deletes multiple storage values of the specified type and origin. All values
+// are deleted by a single task on the UI thread. Returns false if storage
+// cannot be accessed.
+///
+/*--cef()--*/
+bool CefDeleteStorageItems(CefStorageType type, const CefString& origin,
+                           const std::vector<CefString>& keys);
+
 ///
 // Sets the directory path that will be used for storing data of the specified
 // type. Currently only the ST_LOCALSTORAGE type is supported by this method.
@@ -86,6 +135,40 @@ bool CefDeleteStorage(CefStorageType type, const CefString& origin,
 /*--cef(optional_param=path)--*/
 bool CefSetStoragePath(CefStorageType type, const CefString& path);
 
+///
+// Register an observer that will be notified when storage values are changed.
+// Returns an identifier that can be passed to CefRemoveStorageObserver() or 0
+// if the storage cannot be accessed.
+///
+/*--cef()--*/
+int CefAddStorageObserver(CefRefPtr<CefStorageObserver> observer);
+
+///
+// Unregister the observer identified by |observer_id|, which was returned by
+// CefAddStorageObserver(). If this function is called on the UI thread the
+// observer will not be notified after it returns. Returns false if the storage
+// cannot be accessed.
+///
+/*--cef()--*/
+bool CefRemoveStorageObserver(int observer_id);
+
+///
+// Returns the approximate number of bytes held in memory by storage of the
+// specified type. This method must be called on the UI thread.
+///
+/*--cef()--*/
+int64 CefGetStorageMemoryUsage(CefStorageType type);
+
+///
+// Writes any pending changes for storage of the specified type to disk.
+// Currently only the ST_LOCALSTORAGE type is supported by this method. This is
+// only necessary when CefSettings.consolidated_local_storage is true. If
+// |task| is non-empty it will be executed on the FILE thread after the changes
+// have been written. Returns false if the storage cannot be accessed.
+///
+/*--cef(optional_param=task)--*/
+bool CefFlushStorage(CefStorageType type, CefRefPtr<CefTask> task);
+
 
 ///
 // Interface to implement for visiting storage. The methods of this class will
@@ -107,4 +190,98 @@ class CefStorageVisitor : public virtual CefBase {
                      int total, bool& deleteData) =0;
 };
 
+
+///
+// Interface to implement for visiting storage in batches. The methods of this
+// class will always be called on the UI thread.
+///
+/*--cef(source=client)--*/
+class CefStorageBatchVisitor : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called once for each batch of key/value data pairs
+  // from a single origin. |keys| and |values| have the same size. |count| is
+  // the 0-based index of the first pair in the batch. |total| is the total
+  // number of pairs. Return false to stop visiting batches. This method may
+  // never be called if no data is found.
+  ///
+  /*--cef()--*/
+  virtual bool Visit(CefStorageType type, const CefString& origin,
+                     const std::vector<CefString>& keys,
+                     const std::vector<CefString>& values, int count,
+                     int total) =0;
+};
+
+
+///
+// Class representing a list of storage changes. The methods of this class may
+// be called on any thread.
+///
+/*--cef(source=library)--*/
+class CefStorageChanges : public virtual CefBase {
+ public:
+  ///
+  // Returns the number of changes.
+  ///
+  /*--cef()--*/
+  virtual int GetCount() =0;
+
+  ///
+  // Returns the storage type for the change at |index|.
+  ///
+  /*--cef(default_retval=ST_LOCALSTORAGE)--*/
+  virtual CefStorageType GetStorageType(int index) =0;
+
+  ///
+  // Returns the type of the change at |index|.
+  ///
+  /*--cef(default_retval=SCT_SET)--*/
+  virtual CefStorageChangeType GetChangeType(int index) =0;
+
+  ///
+  // Returns the origin for the change at |index|.
+  ///
+  /*--cef()--*/
+  virtual CefString GetOrigin(int index) =0;
+
+  ///
+  // Returns the key for the change at |index|. The key will be empty for
+  // SCT_CLEAR changes.
+  ///
+  /*--cef()--*/
+  virtual CefString GetKey(int index) =0;
+
+  ///
+  // Returns the value before the change at |index|. The value will be empty if
+  // the key did not previously exist or for SCT_CLEAR changes. A key that did
+  // not exist cannot be distinguished from a key with an empty value.
+  ///
+  /*--cef()--*/
+  virtual CefString GetOldValue(int index) =0;
+
+  ///
+  // Returns the value after the change at |index|. The value will be empty for
+  // SCT_REMOVE and SCT_CLEAR changes.
+  ///
+  /*--cef()--*/
+  virtual CefString GetNewValue(int index) =0;
+};
+
+
+///
+// Interface to implement for observing storage changes. The methods of this
+// class will always be called on the UI thread.
+///
+/*--cef(source=client)--*/
+class CefStorageObserver : public virtual CefBase {
+ public:
+  ///
+  // Called with the changes made to storage values. Changes made during a
+  // single task on the UI thread are delivered together in the order that they
+  // occurred.
+  ///
+  /*--cef()--*/
+  virtual void OnStorageChanged(CefRefPtr<CefStorageChanges> changes) =0;
+};
+
 #endif  // CEF_INCLUDE_CEF_STORAGE_H_
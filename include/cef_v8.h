@@ -42,9 +42,15 @@
 #include "include/cef_base.h"
 #include "include/cef_browser.h"
 #include "include/cef_frame.h"
+#include "include/cef_values.h"
 #include <vector>
 
+class CefV8AsyncCallback;
+class CefV8ByteArrayReleaseHandler;
+class CefV8FunctionTemplate;
+class CefV8GCHandler;
 class CefV8Handler;
+class CefV8PropertyName;
 class CefV8Value;
 
 
@@ -112,6 +118,61 @@ bool CefRegisterExtension(const CefString& extension_name,
                           const CefString& javascript_code,
                           CefRefPtr<CefV8Handler> handler);
 
+///
+// Retrieve statistics for the V8 heap. The heap is shared by all V8 contexts;
+// use CefV8Context::GetTrackedObjectCount() and
+// CefV8Context::GetExternallyAllocatedMemory() for per-context values. This
+// function should only be called on the UI thread.
+///
+/*--cef()--*/
+bool CefGetV8HeapStatistics(CefV8HeapStatistics& statistics);
+
+///
+// Register a handler that will be notified after V8 garbage collections.
+// Returns an identifier that can be passed to CefRemoveV8GCHandler() or 0 on
+// failure. The same handler may be registered multiple times and each
+// registration receives a unique identifier. This function may be called on
+// any thread.
+///
+/*--cef()--*/
+int CefAddV8GCHandler(CefRefPtr<CefV8GCHandler> handler);
+
+///
+// Unregister a handler using the identifier returned by CefAddV8GCHandler().
+// This function may be called on any thread.
+///
+/*--cef()--*/
+bool CefRemoveV8GCHandler(int handler_id);
+
+///
+// Notify V8 that the application is idle so that it can perform garbage
+// collection and other cleanup work. |hint| is the amount of work to perform,
+// from 1 to 1000; a larger value may result in a longer pause. Returns true if
+// V8 has no further cleanup work to perform and the function does not need to
+// be called again until script has executed. This function should only be
+// called on the UI thread.
+///
+/*--cef()--*/
+bool CefV8IdleNotification(int hint);
+
+///
+// Notify V8 that the system is running low on memory. V8 will perform a full
+// garbage collection and release as much memory as possible. This function may
+// be called on any thread.
+///
+/*--cef()--*/
+void CefV8LowMemoryNotification();
+
+///
+// Retrieve statistics for the cache of precompiled script data used by
+// CefFrame::ExecuteJavaScript(). Values are cumulative for the lifespan of the
+// application; compare the values before and after a frame loads to determine
+// the compile time for that frame. This function should only be called on the
+// UI thread.
+///
+/*--cef()--*/
+bool CefGetV8ScriptCacheStatistics(CefV8ScriptCacheStatistics& statistics);
+
 
 ///
 // Class that encapsulates a V8 context handle.
@@ -178,6 +239,23 @@ class CefV8Context : public virtual CefBase {
   ///
   /*--cef()--*/
   virtual bool IsSame(CefRefPtr<CefV8Context> that) =0;
+
+  ///
+  // Returns the number of V8 objects in this context that currently hold
+  // references to native handlers, accessors, user data or byte array buffers.
+  // These references are released when the V8 object is garbage collected or
+  // when the context is released, whichever comes first.
+  ///
+  /*--cef()--*/
+  virtual int GetTrackedObjectCount() =0;
+
+  ///
+  // Returns the total number of bytes reported via
+  // CefV8Value::AdjustExternallyAllocatedMemory() for tracked objects in this
+  // context.
+  ///
+  /*--cef()--*/
+  virtual int GetExternallyAllocatedMemory() =0;
 };
 
 
@@ -205,6 +283,73 @@ class CefV8Handler : public virtual CefBase {
                        CefString& exception) =0;
 };
 
+///
+// Class used to complete an asynchronous V8 function call. The methods of this
+// class may be called on any thread.
+///
+/*--cef(source=library)--*/
+class CefV8AsyncCallback : public virtual CefBase {
+ public:
+  ///
+  // Complete the call successfully. The JavaScript callback function will be
+  // executed on the UI thread with null as the first argument followed by the
+  // elements of |results|, converted as described for
+  // CefV8Value::CreateFromList().
+  ///
+  /*--cef(optional_param=results)--*/
+  virtual void Success(CefRefPtr<CefListValue> results) =0;
+
+  ///
+  // Complete the call with an error. The JavaScript callback function will be
+  // executed on the UI thread with an Error object created from |exception| as
+  // the only argument.
+  ///
+  /*--cef()--*/
+  virtual void Failure(const CefString& exception) =0;
+};
+
+///
+// Interface that should be implemented to handle asynchronous V8 function
+// calls. The methods of this class will be called on a worker thread and
+// multiple calls may execute at the same time.
+///
+/*--cef(source=client)--*/
+class CefV8AsyncHandler : public virtual CefBase {
+ public:
+  ///
+  // Handle execution of the function identified by |name|. |arguments| is the
+  // list of arguments passed to the function, excluding the callback function,
+  // converted as described for CefV8Value::GetListValue(). Execute |callback|
+  // exactly once, on any thread, when execution is complete. The call fails if
+  // |callback| is released without being executed.
+  ///
+  /*--cef()--*/
+  virtual void Execute(const CefString& name,
+                       CefRefPtr<CefListValue> arguments,
+                       CefRefPtr<CefV8AsyncCallback> callback) =0;
+};
+
+///
+// Interface that should be implemented to receive notification of V8 garbage
+// collections. The methods of this class will be called on the UI thread.
+///
+/*--cef(source=client)--*/
+class CefV8GCHandler : public virtual CefBase {
+ public:
+  ///
+  // Called after V8 has completed one or more garbage collections. Collections
+  // that complete before a pending notification is delivered are combined into
+  // a single notification. |full| is true if any of the collections was a full
+  // mark-sweep-compact collection and false if only the young generation was
+  // collected. |pause_time| is the total time in milliseconds that script
+  // execution was paused. |statistics| describes the heap after collection.
+  ///
+  /*--cef()--*/
+  virtual void OnGarbageCollection(bool full,
+                                   double pause_time,
+                                   const CefV8HeapStatistics& statistics) =0;
+};
+
 ///
 // Interface that should be implemented to handle V8 accessor calls. Accessor
 // identifiers are registered by calling CefV8Value::SetValue(). The methods
@@ -240,6 +385,22 @@ class CefV8Accessor : public virtual CefBase {
                    CefString& exception) =0;
 };
 
+///
+// Interface that should be implemented to release the memory backing a byte
+// array created with CefV8Value::CreateByteArray(). The methods of this class
+// will always be called on the UI thread.
+///
+/*--cef(source=client)--*/
+class CefV8ByteArrayReleaseHandler : public virtual CefBase {
+ public:
+  ///
+  // Called after the byte array backed by |buffer| has been garbage collected
+  // or the V8 context has been destroyed. |buffer| will no longer be accessed.
+  ///
+  /*--cef()--*/
+  virtual void ReleaseBuffer(void* buffer) =0;
+};
+
 ///
 // Class representing a V8 exception.
 ///
@@ -301,6 +462,77 @@ class CefV8Exception : public virtual CefBase {
   virtual int GetEndColumn() =0;
 };
 
+///
+// Class representing an interned V8 property name. Create a property name once
+// and pass it to the CefV8Value methods that accept a CefV8PropertyName to
+// avoid converting the same name to a new V8 string on every property access.
+// A property name can be used with objects in any V8 context. The methods of
+// this class should only be called on the UI thread.
+///
+/*--cef(source=library)--*/
+class CefV8PropertyName : public virtual CefBase {
+ public:
+  ///
+  // Create a new CefV8PropertyName object for |name|. Names are interned by
+  // V8 so creating the same name more than once is cheap but unnecessary.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefV8PropertyName> Create(const CefString& name);
+
+  ///
+  // Returns the property name.
+  ///
+  /*--cef()--*/
+  virtual CefString GetName() =0;
+};
+
+///
+// Class representing a reusable template for native functions. Functions
+// created from a template share a single V8 function template and handler
+// registration so creating them is much cheaper than calling
+// CefV8Value::CreateFunction(). A template creates one function object per V8
+// context; repeated calls to GetFunction() in the same context return the same
+// function object. Properties assigned to that object are therefore visible
+// everywhere the function is used. Call CefV8Value::CreateFunction() instead
+// if each use requires a separate function object. The methods of this class
+// should only be called on the UI thread.
+///
+/*--cef(source=library)--*/
+class CefV8FunctionTemplate : public virtual CefBase {
+ public:
+  ///
+  // Create a new CefV8FunctionTemplate object for functions named |name| that
+  // are handled by |handler|.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefV8FunctionTemplate> Create(
+      const CefString& name,
+      CefRefPtr<CefV8Handler> handler);
+
+  ///
+  // Returns the function name.
+  ///
+  /*--cef()--*/
+  virtual CefString GetName() =0;
+
+  ///
+  // Returns the function handler.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefV8Handler> GetHandler() =0;
+
+  ///
+  // Returns the function for the current V8 context. The same function object
+  // is returned each time this method is called in the same context. This
+  // method should only be called from within the scope of a
+  // CefV8ContextHandler, CefV8Handler or CefV8Accessor callback, or in
+  // combination with calling Enter() and Exit() on a stored CefV8Context
+  // reference.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefV8Value> GetFunction() =0;
+};
+
 ///
 // Class representing a V8 value. The methods of this class should only be
 // called on the UI thread.
@@ -366,14 +598,70 @@ class CefV8Value : public virtual CefBase {
   /*--cef()--*/
   static CefRefPtr<CefV8Value> CreateArray();
   ///
+  // Create a new CefV8Value object of type byte array whose elements are the
+  // |length| bytes starting at |buffer|. JavaScript reads and writes the memory
+  // directly without copying it. The memory must remain valid until
+  // |release_handler| is executed, or for the lifetime of the V8 context if
+  // |release_handler| is NULL. |buffer| may be NULL if |length| is 0. This
+  // method should only be called from within the scope of a
+  // CefV8ContextHandler, CefV8Handler or CefV8Accessor callback, or in
+  // combination with calling Enter() and Exit() on a stored CefV8Context
+  // reference.
+  ///
+  /*--cef(optional_param=buffer,optional_param=release_handler)--*/
+  static CefRefPtr<CefV8Value> CreateByteArray(
+      void* buffer, int length,
+      CefRefPtr<CefV8ByteArrayReleaseHandler> release_handler);
+  ///
   // Create a new CefV8Value object of type function. This method should only be
   // called from within the scope of a CefV8ContextHandler, CefV8Handler or
   // CefV8Accessor callback, or in combination with calling Enter() and Exit()
-  // on a stored CefV8Context reference.
+  // on a stored CefV8Context reference. Each call returns a new function
+  // object that V8 retains until the context is released. Use
+  // CefV8FunctionTemplate when the same function is created repeatedly.
   ///
   /*--cef()--*/
   static CefRefPtr<CefV8Value> CreateFunction(const CefString& name,
                                               CefRefPtr<CefV8Handler> handler);
+  ///
+  // Create a new CefV8Value object of type function that executes |handler|
+  // asynchronously. When the function is called its arguments are converted
+  // to a CefListValue on the UI thread and |handler| is executed on a worker
+  // thread. If the last argument is a function it is not passed to |handler|.
+  // Instead it is called in the original context when execution completes,
+  // with an error or null as the first argument followed by the results. The
+  // function itself returns undefined. This method should only be called from
+  // within the scope of a CefV8ContextHandler, CefV8Handler or CefV8Accessor
+  // callback, or in combination with calling Enter() and Exit() on a stored
+  // CefV8Context reference.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefV8Value> CreateAsyncFunction(
+      const CefString& name,
+      CefRefPtr<CefV8AsyncHandler> handler);
+  ///
+  // Create a new CefV8Value object of type object from the contents of |value|
+  // in a single call. Nested dictionaries are converted to objects and nested
+  // lists are converted to arrays. Returns NULL if |value| contains a cycle or
+  // is nested too deeply. This method should only be called from within the
+  // scope of a CefV8ContextHandler, CefV8Handler or CefV8Accessor callback, or
+  // in combination with calling Enter() and Exit() on a stored CefV8Context
+  // reference.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefV8Value> CreateFromDictionary(
+      CefRefPtr<CefDictionaryValue> value);
+  ///
+  // Create a new CefV8Value object of type array from the contents of |value|
+  // in a single call. Nested dictionaries are converted to objects and nested
+  // lists are converted to arrays. Returns NULL if |value| contains a cycle or
+  // is nested too deeply. This method should only be called from within the
+  // scope of a CefV8ContextHandler, CefV8Handler or CefV8Accessor callback, or
+  // in combination with calling Enter() and Exit() on a stored CefV8Context
+  // reference.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefV8Value> CreateFromList(CefRefPtr<CefListValue> value);
 
   ///
   // True if the value type is undefined.
@@ -421,6 +709,13 @@ class CefV8Value : public virtual CefBase {
   /*--cef()--*/
   virtual bool IsArray() =0;
   ///
+  // True if the value type is byte array. This includes values created with
+  // CreateByteArray() and JavaScript Uint8Array, Int8Array and
+  // Uint8ClampedArray objects.
+  ///
+  /*--cef()--*/
+  virtual bool IsByteArray() =0;
+  ///
   // True if the value type is function.
   ///
   /*--cef()--*/
@@ -479,6 +774,11 @@ class CefV8Value : public virtual CefBase {
   ///
   /*--cef(capi_name=has_value_byindex,index_param=index)--*/
   virtual bool HasValue(int index) =0;
+  ///
+  // Returns true if the object has a value with the specified property name.
+  ///
+  /*--cef(capi_name=has_value_byname)--*/
+  virtual bool HasValue(CefRefPtr<CefV8PropertyName> name) =0;
 
   ///
   // Delete the value with the specified identifier.
@@ -501,6 +801,12 @@ class CefV8Value : public virtual CefBase {
   ///
   /*--cef(capi_name=get_value_byindex,index_param=index)--*/
   virtual CefRefPtr<CefV8Value> GetValue(int index) =0;
+  ///
+  // Returns the value with the specified property name.
+  ///
+  /*--cef(capi_name=get_value_byname)--*/
+  virtual CefRefPtr<CefV8Value> GetValue(
+      CefRefPtr<CefV8PropertyName> name) =0;
 
   ///
   // Associate a value with the specified identifier.
@@ -513,6 +819,13 @@ class CefV8Value : public virtual CefBase {
   ///
   /*--cef(capi_name=set_value_byindex,index_param=index)--*/
   virtual bool SetValue(int index, CefRefPtr<CefV8Value> value) =0;
+  ///
+  // Associate a value with the specified property name.
+  ///
+  /*--cef(capi_name=set_value_byname)--*/
+  virtual bool SetValue(CefRefPtr<CefV8PropertyName> name,
+                        CefRefPtr<CefV8Value> value,
+                        PropertyAttribute attribute) =0;
 
   ///
   // Register an identifier whose access will be forwarded to the CefV8Accessor
@@ -555,6 +868,17 @@ class CefV8Value : public virtual CefBase {
   /*--cef()--*/
   virtual int AdjustExternallyAllocatedMemory(int change_in_bytes) =0;
 
+  ///
+  // Returns the contents of this object converted to a new dictionary value
+  // in a single call. Nested objects are converted to dictionaries, arrays to
+  // lists and Date values to the number of milliseconds since the epoch.
+  // Function and undefined values are omitted. Returns NULL if the object
+  // contains a cycle, is nested too deeply or a property getter throws an
+  // exception.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefDictionaryValue> GetDictionaryValue() =0;
+
 
   // ARRAY METHODS - These methods are only available on arrays.
 
@@ -564,6 +888,33 @@ class CefV8Value : public virtual CefBase {
   /*--cef()--*/
   virtual int GetArrayLength() =0;
 
+  ///
+  // Returns the contents of this array converted to a new list value in a
+  // single call. Elements are converted as described for GetDictionaryValue()
+  // except that function and undefined elements become null. Returns NULL if
+  // the array contains a cycle, is nested too deeply or a property getter
+  // throws an exception.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefListValue> GetListValue() =0;
+
+
+  // BYTE ARRAY METHODS - These methods are only available on byte arrays.
+
+  ///
+  // Returns a pointer to the memory backing the byte array. The memory is not
+  // copied and may be read or modified directly. It remains valid for as long
+  // as a reference to this object is held.
+  ///
+  /*--cef()--*/
+  virtual void* GetByteArrayData() =0;
+
+  ///
+  // Returns the number of bytes in the byte array.
+  ///
+  /*--cef()--*/
+  virtual int GetByteArrayLength() =0;
+
 
   // FUNCTION METHODS - These methods are only available on functions.
 
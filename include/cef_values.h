@@ -0,0 +1,323 @@
+// Copyright (c) 2012 Marshall A. Greenblatt. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//    * Neither the name of Google Inc. nor the name Chromium Embedded
+// Framework nor the names of its contributors may be used to endorse
+// or promote products derived from this software without specific prior
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// ---------------------------------------------------------------------------
+//
+// The contents of this file must follow a specific format in order to
+// support the CEF translator tool. See the translator.README.txt file in the
+// tools directory for more information.
+//
+
+#ifndef CEF_INCLUDE_CEF_VALUES_H_
+#define CEF_INCLUDE_CEF_VALUES_H_
+#pragma once
+
+#include <vector>
+#include "include/cef_base.h"
+
+class CefDictionaryValue;
+class CefListValue;
+
+typedef cef_value_type_t CefValueType;
+
+///
+// Class representing a dictionary value. Dictionary and list values may be
+// shared between multiple containers. The methods of this class may be called
+// on any thread but the object must not be modified on multiple threads at the
+// same time.
+///
+/*--cef(source=library)--*/
+class CefDictionaryValue : public virtual CefBase {
+ public:
+  typedef std::vector<CefString> KeyList;
+
+  ///
+  // Creates a new empty dictionary value.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefDictionaryValue> Create();
+
+  ///
+  // Returns the number of values.
+  ///
+  /*--cef()--*/
+  virtual int GetSize() =0;
+
+  ///
+  // Removes all values.
+  ///
+  /*--cef()--*/
+  virtual void Clear() =0;
+
+  ///
+  // Returns true if the current dictionary has a value for the given key.
+  ///
+  /*--cef()--*/
+  virtual bool HasKey(const CefString& key) =0;
+
+  ///
+  // Reads all keys for this dictionary into the specified vector.
+  ///
+  /*--cef()--*/
+  virtual bool GetKeys(KeyList& keys) =0;
+
+  ///
+  // Removes the value at the specified key. Returns true if the value was
+  // removed successfully.
+  ///
+  /*--cef()--*/
+  virtual bool Remove(const CefString& key) =0;
+
+  ///
+  // Returns the value type for the specified key.
+  ///
+  /*--cef(default_retval=VTYPE_INVALID)--*/
+  virtual CefValueType GetType(const CefString& key) =0;
+
+  ///
+  // Returns the value at the specified key as type bool.
+  ///
+  /*--cef()--*/
+  virtual bool GetBool(const CefString& key) =0;
+
+  ///
+  // Returns the value at the specified key as type int.
+  ///
+  /*--cef()--*/
+  virtual int GetInt(const CefString& key) =0;
+
+  ///
+  // Returns the value at the specified key as type double.
+  ///
+  /*--cef()--*/
+  virtual double GetDouble(const CefString& key) =0;
+
+  ///
+  // Returns the value at the specified key as type string.
+  ///
+  /*--cef()--*/
+  virtual CefString GetString(const CefString& key) =0;
+
+  ///
+  // Returns the value at the specified key as type dictionary.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefDictionaryValue> GetDictionary(const CefString& key) =0;
+
+  ///
+  // Returns the value at the specified key as type list.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefListValue> GetList(const CefString& key) =0;
+
+  ///
+  // Sets the value at the specified key as type null. Returns true if the
+  // value was set successfully.
+  ///
+  /*--cef()--*/
+  virtual bool SetNull(const CefString& key) =0;
+
+  ///
+  // Sets the value at the specified key as type bool. Returns true if the
+  // value was set successfully.
+  ///
+  /*--cef()--*/
+  virtual bool SetBool(const CefString& key, bool value) =0;
+
+  ///
+  // Sets the value at the specified key as type int. Returns true if the
+  // value was set successfully.
+  ///
+  /*--cef()--*/
+  virtual bool SetInt(const CefString& key, int value) =0;
+
+  ///
+  // Sets the value at the specified key as type double. Returns true if the
+  // value was set successfully.
+  ///
+  /*--cef()--*/
+  virtual bool SetDouble(const CefString& key, double value) =0;
+
+  ///
+  // Sets the value at the specified key as type string. Returns true if the
+  // value was set successfully.
+  ///
+  /*--cef(optional_param=value)--*/
+  virtual bool SetString(const CefString& key, const CefString& value) =0;
+
+  ///
+  // Sets the value at the specified key as type dictionary. Returns true if
+  // the value was set successfully.
+  ///
+  /*--cef()--*/
+  virtual bool SetDictionary(const CefString& key,
+                             CefRefPtr<CefDictionaryValue> value) =0;
+
+  ///
+  // Sets the value at the specified key as type list. Returns true if the
+  // value was set successfully.
+  ///
+  /*--cef()--*/
+  virtual bool SetList(const CefString& key, CefRefPtr<CefListValue> value) =0;
+};
+
+
+///
+// Class representing a list value. Dictionary and list values may be shared
+// between multiple containers. The methods of this class may be called on any
+// thread but the object must not be modified on multiple threads at the same
+// time.
+///
+/*--cef(source=library)--*/
+class CefListValue : public virtual CefBase {
+ public:
+  ///
+  // Creates a new empty list value.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefListValue> Create();
+
+  ///
+  // Sets the number of values. If the number of values is expanded all
+  // new value slots will default to type null. Returns true on success.
+  ///
+  /*--cef()--*/
+  virtual bool SetSize(int size) =0;
+
+  ///
+  // Returns the number of values.
+  ///
+  /*--cef()--*/
+  virtual int GetSize() =0;
+
+  ///
+  // Removes all values.
+  ///
+  /*--cef()--*/
+  virtual void Clear() =0;
+
+  ///
+  // Removes the value at the specified index.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool Remove(int index) =0;
+
+  ///
+  // Returns the value type at the specified index.
+  ///
+  /*--cef(default_retval=VTYPE_INVALID,index_param=index)--*/
+  virtual CefValueType GetType(int index) =0;
+
+  ///
+  // Returns the value at the specified index as type bool.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool GetBool(int index) =0;
+
+  ///
+  // Returns the value at the specified index as type int.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual int GetInt(int index) =0;
+
+  ///
+  // Returns the value at the specified index as type double.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual double GetDouble(int index) =0;
+
+  ///
+  // Returns the value at the specified index as type string.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual CefString GetString(int index) =0;
+
+  ///
+  // Returns the value at the specified index as type dictionary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual CefRefPtr<CefDictionaryValue> GetDictionary(int index) =0;
+
+  ///
+  // Returns the value at the specified index as type list.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual CefRefPtr<CefListValue> GetList(int index) =0;
+
+  ///
+  // Sets the value at the specified index as type null. Returns true if the
+  // value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool SetNull(int index) =0;
+
+  ///
+  // Sets the value at the specified index as type bool. Returns true if the
+  // value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool SetBool(int index, bool value) =0;
+
+  ///
+  // Sets the value at the specified index as type int. Returns true if the
+  // value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool SetInt(int index, int value) =0;
+
+  ///
+  // Sets the value at the specified index as type double. Returns true if the
+  // value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool SetDouble(int index, double value) =0;
+
+  ///
+  // Sets the value at the specified index as type string. Returns true if the
+  // value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(optional_param=value,index_param=index)--*/
+  virtual bool SetString(int index, const CefString& value) =0;
+
+  ///
+  // Sets the value at the specified index as type dictionary. Returns true if
+  // the value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool SetDictionary(int index, CefRefPtr<CefDictionaryValue> value) =0;
+
+  ///
+  // Sets the value at the specified index as type list. Returns true if the
+  // value was set successfully. The list will be expanded if necessary.
+  ///
+  /*--cef(index_param=index)--*/
+  virtual bool SetList(int index, CefRefPtr<CefListValue> value) =0;
+};
+
+#endif  // CEF_INCLUDE_CEF_VALUES_H_
@@ -78,6 +78,32 @@ enum cef_log_severity_t {
   LOGSEVERITY_DISABLE = 99
 };
 
+///
+// SQLite journal modes. See the SQLite documentation for PRAGMA journal_mode
+// for details.
+///
+enum cef_database_journal_mode_t {
+  // Use the SQLite default (DELETE).
+  DATABASE_JOURNAL_MODE_DEFAULT = 0,
+  DATABASE_JOURNAL_MODE_TRUNCATE,
+  DATABASE_JOURNAL_MODE_PERSIST,
+  // Write-ahead logging. Readers do not block writers and commits require
+  // fewer disk syncs.
+  DATABASE_JOURNAL_MODE_WAL
+};
+
+///
+// SQLite synchronous levels. See the SQLite documentation for PRAGMA
+// synchronous for details.
+///
+enum cef_database_synchronous_t {
+  // Use the SQLite default (FULL).
+  DATABASE_SYNCHRONOUS_DEFAULT = 0,
+  DATABASE_SYNCHRONOUS_OFF,
+  DATABASE_SYNCHRONOUS_NORMAL,
+  DATABASE_SYNCHRONOUS_FULL
+};
+
 ///
 // Initialization settings. Specify NULL or 0 to get the recommended default
 // values.
@@ -158,12 +184,67 @@ typedef struct _cef_settings_t {
   ///
   unsigned int session_storage_quota;
 
+  ///
+  // Set to true (1) to store localStorage data for all origins in a single
+  // database instead of one file per origin. Changes are written to the
+  // database in batches on a background thread. Data stored using one format
+  // is not visible when using the other.
+  ///
+  bool consolidated_local_storage;
+
+  ///
+  // Maximum number of bytes that localStorage data loaded from disk may hold in
+  // memory across all origins. When the limit is exceeded the least recently
+  // used origins are unloaded and will be reloaded from disk on demand. Specify
+  // 0 for no limit. Default value is 0.
+  ///
+  unsigned int local_storage_memory_limit;
+
+  ///
+  // Maximum delay in milliseconds before pending cookie changes are written to
+  // the cookie database. Default value is 30 seconds.
+  ///
+  unsigned int cookie_commit_interval;
+
+  ///
+  // Number of pending cookie changes that will cause the changes to be written
+  // to the cookie database immediately. Default value is 512.
+  ///
+  unsigned int cookie_commit_batch_size;
+
+  ///
+  // SQLite journal mode for the cookie database.
+  ///
+  cef_database_journal_mode_t cookie_journal_mode;
+
+  ///
+  // SQLite synchronous level for the cookie database.
+  ///
+  cef_database_synchronous_t cookie_synchronous;
+
+  ///
+  // Delay in milliseconds before all cookies are loaded from the cookie
+  // database in the background. Cookies for a domain that are requested before
+  // then will be loaded on demand. Specify 0 to start loading all cookies
+  // immediately.
+  ///
+  unsigned int cookie_background_load_delay;
+
   ///
   // Custom flags that will be used when initializing the V8 JavaScript engine.
   // The consequences of using custom flags may not be well tested.
   ///
   cef_string_t javascript_flags;
 
+  ///
+  // Set to true (1) to store precompiled data for scripts executed using
+  // CefFrame::ExecuteJavaScript() in the |cache_path| directory so that it can
+  // be reused across sessions. Precompiled data is always cached in memory.
+  // The stored data is limited to 16MB and the least recently used scripts are
+  // removed at startup. This value is ignored if |cache_path| is empty.
+  ///
+  bool persistent_script_cache;
+
 #if defined(OS_WIN)
   ///
   // Set to true (1) to use the system proxy resolver on Windows when
@@ -547,6 +628,42 @@ typedef struct _cef_cookie_t {
   cef_time_t expires;
 } cef_cookie_t;
 
+///
+// Cookie database load metrics.
+///
+typedef struct _cef_cookie_load_metrics_t {
+  ///
+  // True if all cookies have been loaded from the database.
+  ///
+  bool load_complete;
+
+  ///
+  // Time in milliseconds spent opening and initializing the database.
+  ///
+  int64 database_open_time;
+
+  ///
+  // Time in milliseconds from the start of loading until all cookies were
+  // loaded. Only valid if |load_complete| is true.
+  ///
+  int64 total_load_time;
+
+  ///
+  // Number of domain keys (eTLD+1) loaded on demand.
+  ///
+  int priority_key_count;
+
+  ///
+  // Number of domain keys (eTLD+1) loaded in the background.
+  ///
+  int background_key_count;
+
+  ///
+  // Number of cookies loaded from the database.
+  ///
+  int cookie_count;
+} cef_cookie_load_metrics_t;
+
 ///
 // Storage types.
 ///
@@ -555,6 +672,26 @@ enum cef_storage_type_t {
   ST_SESSIONSTORAGE,
 };
 
+///
+// Storage change types.
+///
+enum cef_storage_change_type_t {
+  ///
+  // A value was added or modified.
+  ///
+  SCT_SET = 0,
+
+  ///
+  // A value was removed.
+  ///
+  SCT_REMOVE,
+
+  ///
+  // All values for the origin were removed.
+  ///
+  SCT_CLEAR
+};
+
 ///
 // Mouse button types.
 ///
@@ -678,6 +815,99 @@ enum cef_v8_propertyattribute_t {
   V8_PROPERTY_ATTRIBUTE_DONTDELETE = 1 << 2   // Not configurable
 };
 
+///
+// V8 heap statistics. The V8 heap is shared by all V8 contexts.
+///
+typedef struct _cef_v8heap_statistics_t {
+  ///
+  // Total size of the heap in bytes.
+  ///
+  size_t total_heap_size;
+
+  ///
+  // Size of the executable portion of the heap in bytes.
+  ///
+  size_t total_heap_size_executable;
+
+  ///
+  // Size of the heap that is currently in use in bytes.
+  ///
+  size_t used_heap_size;
+
+  ///
+  // Maximum size that the heap can grow to in bytes.
+  ///
+  size_t heap_size_limit;
+
+  ///
+  // Number of garbage collections that have completed.
+  ///
+  int gc_count;
+
+  ///
+  // Number of full (mark-sweep-compact) garbage collections that have
+  // completed.
+  ///
+  int full_gc_count;
+
+  ///
+  // Total time in milliseconds that script execution has been paused for
+  // garbage collection.
+  ///
+  double gc_pause_time;
+} cef_v8heap_statistics_t;
+
+///
+// Statistics for the cache of precompiled script data used by
+// CefFrame::ExecuteJavaScript().
+///
+typedef struct _cef_v8script_cache_statistics_t {
+  ///
+  // Number of scripts that were compiled using cached precompiled data.
+  ///
+  int hit_count;
+
+  ///
+  // Number of scripts that were precompiled because no cached data existed.
+  ///
+  int miss_count;
+
+  ///
+  // Number of entries currently held in memory.
+  ///
+  int entry_count;
+
+  ///
+  // Size of the precompiled data currently held in memory in bytes.
+  ///
+  size_t data_size;
+
+  ///
+  // Total time in milliseconds spent compiling scripts, including the time
+  // spent generating precompiled data.
+  ///
+  double compile_time;
+
+  ///
+  // Total time in milliseconds spent generating precompiled data.
+  ///
+  double precompile_time;
+} cef_v8script_cache_statistics_t;
+
+///
+// Value types for CefDictionaryValue and CefListValue entries.
+///
+enum cef_value_type_t {
+  VTYPE_INVALID = 0,
+  VTYPE_NULL,
+  VTYPE_BOOL,
+  VTYPE_INT,
+  VTYPE_DOUBLE,
+  VTYPE_STRING,
+  VTYPE_DICTIONARY,
+  VTYPE_LIST
+};
+
 ///
 // Structure representing menu information.
 ///
@@ -193,6 +193,43 @@ struct CefPrintOptionsTraits {
 typedef CefStructBase<CefPrintOptionsTraits> CefPrintOptions;
 
 
+struct CefV8HeapStatisticsTraits {
+  typedef cef_v8heap_statistics_t struct_type;
+
+  static inline void init(struct_type* s) {}
+  static inline void clear(struct_type* s) {}
+
+  static inline void set(const struct_type* src, struct_type* target,
+      bool copy) {
+    *target = *src;
+  }
+};
+
+///
+// Class representing V8 heap statistics.
+///
+typedef CefStructBase<CefV8HeapStatisticsTraits> CefV8HeapStatistics;
+
+
+struct CefV8ScriptCacheStatisticsTraits {
+  typedef cef_v8script_cache_statistics_t struct_type;
+
+  static inline void init(struct_type* s) {}
+  static inline void clear(struct_type* s) {}
+
+  static inline void set(const struct_type* src, struct_type* target,
+      bool copy) {
+    *target = *src;
+  }
+};
+
+///
+// Class representing statistics for the precompiled script cache.
+///
+typedef CefStructBase<CefV8ScriptCacheStatisticsTraits>
+    CefV8ScriptCacheStatistics;
+
+
 
 struct CefPopupFeaturesTraits {
   typedef cef_popup_features_t struct_type;
@@ -286,8 +323,16 @@ struct CefSettingsTraits {
     target->graphics_implementation = src->graphics_implementation;
     target->local_storage_quota = src->local_storage_quota;
     target->session_storage_quota = src->session_storage_quota;
+    target->consolidated_local_storage = src->consolidated_local_storage;
+    target->local_storage_memory_limit = src->local_storage_memory_limit;
+    target->cookie_commit_interval = src->cookie_commit_interval;
+    target->cookie_commit_batch_size = src->cookie_commit_batch_size;
+    target->cookie_journal_mode = src->cookie_journal_mode;
+    target->cookie_synchronous = src->cookie_synchronous;
+    target->cookie_background_load_delay = src->cookie_background_load_delay;
     cef_string_set(src->javascript_flags.str, src->javascript_flags.length,
         &target->javascript_flags, copy);
+    target->persistent_script_cache = src->persistent_script_cache;
 
 #if defined(OS_WIN)
     target->auto_detect_proxy_settings_enabled =
@@ -534,6 +579,25 @@ struct CefCookieTraits {
 typedef CefStructBase<CefCookieTraits> CefCookie;
 
 
+struct CefCookieLoadMetricsTraits {
+  typedef cef_cookie_load_metrics_t struct_type;
+
+  static inline void init(struct_type* s) {}
+
+  static inline void clear(struct_type* s) {}
+
+  static inline void set(const struct_type* src, struct_type* target,
+      bool copy) {
+    *target = *src;
+  }
+};
+
+///
+// Class representing cookie database load metrics.
+///
+typedef CefStructBase<CefCookieLoadMetricsTraits> CefCookieLoadMetrics;
+
+
 struct CefMenuInfoTraits {
   typedef cef_menu_info_t struct_type;
 
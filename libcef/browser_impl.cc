@@ -5,13 +5,16 @@
 
 #include "libcef/browser_impl.h"
 #include "libcef/browser_devtools_scheme_handler.h"
+#include "libcef/browser_webcookiejar_impl.h"
 #include "libcef/browser_webkit_glue.h"
 #include "libcef/browser_zoom_map.h"
 #include "libcef/cef_context.h"
+#include "libcef/cookie_manager_impl.h"
 #include "libcef/dom_document_impl.h"
 #include "libcef/request_impl.h"
 #include "libcef/stream_impl.h"
 #include "libcef/v8_impl.h"
+#include "libcef/values_impl.h"
 
 #include "base/bind.h"
 #include "base/file_path.h"
@@ -169,6 +172,7 @@ CefBrowserImpl::CefBrowserImpl(const CefWindowInfo& windowInfo,
     can_go_forward_(false),
     has_document_(false),
     is_dropping_(false),
+    cookie_manager_valid_(false),
     unique_id_(0)
 #if defined(OS_WIN)
     , opener_was_disabled_by_modal_loop_(false),
@@ -346,6 +350,19 @@ void CefBrowserImpl::CloseDevTools() {
       base::Bind(&CefBrowserImpl::UIT_CloseDevTools, this));
 }
 
+void CefBrowserImpl::InvalidateCookieManager() {
+  // Discard document.cookie snapshots that were read using the old manager.
+  BrowserWebCookieJarImpl::InvalidateBrowser(this);
+
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    cookie_manager_ = NULL;
+    cookie_manager_valid_ = false;
+  } else {
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(&CefBrowserImpl::InvalidateCookieManager, this));
+  }
+}
+
 bool CefBrowserImpl::GetSize(PaintElementType type, int& width, int& height) {
   if (!CefThread::CurrentlyOn(CefThread::UI)) {
     NOTREACHED() << "called on invalid thread";
@@ -584,6 +601,17 @@ void CefBrowserImpl::ExecuteJavaScript(CefRefPtr<CefFrame> frame,
                  scriptUrl, startLine));
 }
 
+void CefBrowserImpl::EvaluateJavaScript(
+    CefRefPtr<CefFrame> frame,
+    const std::vector<CefString>& jsCodes,
+    const CefString& scriptUrl,
+    int startLine,
+    CefRefPtr<CefJavaScriptResultCallback> callback) {
+  CefThread::PostTask(CefThread::UI, FROM_HERE,
+      base::Bind(&CefBrowserImpl::UIT_EvaluateJavaScript, this, frame, jsCodes,
+                 scriptUrl, startLine, callback));
+}
+
 CefRefPtr<CefFrame> CefBrowserImpl::GetParent(CefRefPtr<CefFrame> frame) {
   // Verify that this method is being called on the UI thread.
   if (!CefThread::CurrentlyOn(CefThread::UI)) {
@@ -897,12 +925,49 @@ void CefBrowserImpl::UIT_ExecuteJavaScript(CefRefPtr<CefFrame> frame,
   REQUIRE_UIT();
 
   WebFrame* web_frame = UIT_GetWebFrame(frame);
-  if (web_frame) {
+  if (web_frame &&
+      !CefV8ExecuteScript(web_frame, js_code, script_url, start_line)) {
     web_frame->executeScript(WebScriptSource(string16(js_code),
         WebURL(GURL(std::string(script_url))), start_line));
   }
 }
 
+void CefBrowserImpl::UIT_EvaluateJavaScript(
+    CefRefPtr<CefFrame> frame,
+    const std::vector<CefString>& js_codes,
+    const CefString& script_url,
+    int start_line,
+    CefRefPtr<CefJavaScriptResultCallback> callback) {
+  REQUIRE_UIT();
+
+  WebFrame* web_frame = UIT_GetWebFrame(frame);
+
+  if (!callback.get()) {
+    // Nobody will see the results so don't convert them.
+    if (web_frame) {
+      CefV8EvaluateScripts(web_frame, js_codes, script_url, start_line, NULL,
+                           NULL);
+    }
+    return;
+  }
+
+  CefRefPtr<CefListValueImpl> results = new CefListValueImpl();
+  CefRefPtr<CefListValueImpl> exceptions = new CefListValueImpl();
+
+  if (!web_frame ||
+      !CefV8EvaluateScripts(web_frame, js_codes, script_url, start_line,
+                            results.get(), exceptions.get())) {
+    // The scripts could not be executed.
+    int size = static_cast<int>(js_codes.size());
+    for (int i = 0; i < size; ++i) {
+      results->SetNull(i);
+      exceptions->SetString(i, "Frame has no script context");
+    }
+  }
+
+  callback->OnComplete(results.get(), exceptions.get());
+}
+
 void CefBrowserImpl::UIT_GoBackOrForward(int offset) {
   REQUIRE_UIT();
   nav_controller_->GoToOffset(offset);
@@ -1563,6 +1628,37 @@ GURL CefBrowserImpl::pending_url() {
   return pending_url_;
 }
 
+net::CookieStore* CefBrowserImpl::GetCookieStore() {
+  REQUIRE_IOT();
+
+  GURL url = pending_url();
+  if (!cookie_manager_valid_ || url != cookie_manager_url_) {
+    // Get the manager from the handler.
+    cookie_manager_ = NULL;
+    if (client_.get()) {
+      CefRefPtr<CefRequestHandler> handler = client_->GetRequestHandler();
+      if (handler.get())
+        cookie_manager_ = handler->GetCookieManager(this, url.spec());
+    }
+    cookie_manager_url_ = url;
+    cookie_manager_valid_ = true;
+  }
+
+  net::CookieStore* cookie_store = NULL;
+  if (cookie_manager_.get()) {
+    cookie_store = reinterpret_cast<CefCookieManagerImpl*>(
+        cookie_manager_.get())->cookie_monster();
+  }
+
+  if (!cookie_store) {
+    // Use the global cookie store.
+    cookie_store = _Context->request_context()->cookie_store();
+  }
+
+  DCHECK(cookie_store);
+  return cookie_store;
+}
+
 void CefBrowserImpl::UIT_CreateDevToolsClient(BrowserDevToolsAgent *agent) {
   dev_tools_client_.reset(new BrowserDevToolsClient(this, agent));
 }
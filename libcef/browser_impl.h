@@ -13,6 +13,7 @@
 
 #include "include/cef_browser.h"
 #include "include/cef_client.h"
+#include "include/cef_cookie.h"
 #include "include/cef_frame.h"
 
 #include "libcef/webview_host.h"
@@ -33,6 +34,9 @@
 namespace base {
 class WaitableEvent;
 }
+namespace net {
+class CookieStore;
+}
 namespace WebKit {
 class WebView;
 }
@@ -98,6 +102,7 @@ class CefBrowserImpl : public CefBrowser {
   virtual void ClearHistory() OVERRIDE;
   virtual void ShowDevTools() OVERRIDE;
   virtual void CloseDevTools() OVERRIDE;
+  virtual void InvalidateCookieManager() OVERRIDE;
   virtual bool IsWindowRenderingDisabled() OVERRIDE;
   virtual bool GetSize(PaintElementType type, int& width, int& height) OVERRIDE;
   virtual void SetSize(PaintElementType type, int width, int height) OVERRIDE;
@@ -141,6 +146,11 @@ class CefBrowserImpl : public CefBrowser {
                          const CefString& jsCode,
                          const CefString& scriptUrl,
                          int startLine);
+  void EvaluateJavaScript(CefRefPtr<CefFrame> frame,
+                          const std::vector<CefString>& jsCodes,
+                          const CefString& scriptUrl,
+                          int startLine,
+                          CefRefPtr<CefJavaScriptResultCallback> callback);
   CefRefPtr<CefFrame> GetParent(CefRefPtr<CefFrame> frame);
 
   // CefFrames are light-weight objects managed by the browser and loosely
@@ -261,6 +271,11 @@ class CefBrowserImpl : public CefBrowser {
                              const CefString& js_code,
                              const CefString& script_url,
                              int start_line);
+  void UIT_EvaluateJavaScript(CefRefPtr<CefFrame> frame,
+                              const std::vector<CefString>& js_codes,
+                              const CefString& script_url,
+                              int start_line,
+                              CefRefPtr<CefJavaScriptResultCallback> callback);
   void UIT_GoBackOrForward(int offset);
   void UIT_Reload(bool ignoreCache);
   bool UIT_Navigate(const BrowserNavigationEntry& entry,
@@ -360,6 +375,10 @@ class CefBrowserImpl : public CefBrowser {
     return request_context_proxy_;
   }
 
+  // Returns the cookie store for this browser. Must be called on the IO
+  // thread.
+  net::CookieStore* GetCookieStore();
+
   static bool ImplementsThreadSafeReferenceCounting() { return true; }
 
  protected:
@@ -399,6 +418,12 @@ class CefBrowserImpl : public CefBrowser {
   // True if a drop action is occuring.
   bool is_dropping_;
 
+  // Cookie manager returned by the client for |cookie_manager_url_|. Only
+  // accessed on the IO thread.
+  CefRefPtr<CefCookieManager> cookie_manager_;
+  GURL cookie_manager_url_;
+  bool cookie_manager_valid_;
+
 #if defined(OS_WIN)
   // Context object used to manage printing.
   printing::PrintingContext print_context_;
@@ -470,6 +495,20 @@ class CefFrameImpl : public CefFrame {
                                  int startLine) OVERRIDE {
     return browser_->ExecuteJavaScript(this, jsCode, scriptUrl, startLine);
   }
+  virtual void EvaluateJavaScript(
+      const CefString& jsCode,
+      const CefString& scriptUrl,
+      int startLine,
+      CefRefPtr<CefJavaScriptResultCallback> callback) OVERRIDE {
+    return browser_->EvaluateJavaScript(this,
+        std::vector<CefString>(1, jsCode), scriptUrl, startLine, callback);
+  }
+  virtual void ExecuteJavaScriptBatch(
+      const std::vector<CefString>& jsCodes,
+      const CefString& scriptUrl,
+      CefRefPtr<CefJavaScriptResultCallback> callback) OVERRIDE {
+    return browser_->EvaluateJavaScript(this, jsCodes, scriptUrl, 1, callback);
+  }
   virtual bool IsMain() OVERRIDE { return name_.empty(); }
   virtual bool IsFocused() OVERRIDE;
   virtual CefString GetName() OVERRIDE { return name_; }
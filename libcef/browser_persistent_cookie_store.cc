@@ -17,6 +17,7 @@
 #include "base/callback.h"
 #include "base/file_path.h"
 #include "base/file_util.h"
+#include "base/lazy_instance.h"
 #include "base/logging.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
@@ -33,6 +34,13 @@
 
 using base::Time;
 
+namespace {
+
+// Guards BrowserPersistentCookieStore::backend_map_.
+base::LazyInstance<base::Lock> g_backend_map_lock = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
 // This class is designed to be shared between any calling threads and the
 // database thread. It batches operations and commits them on a timer.
 //
@@ -54,34 +62,72 @@ using base::Time;
 // Subsequent to loading, mutations may be queued by any thread using
 // AddCookie, UpdateCookieAccessTime, and DeleteCookie. These are flushed to
 // disk on the DB thread every 30 seconds, 512 operations, or call to Flush(),
-// whichever occurs first.
+// whichever occurs first. The interval and batch size are configurable.
+//
+// A single Backend is shared by all BrowserPersistentCookieStore objects that
+// use the same database path. Each store represents a cookie partition and
+// every row in the database is tagged with the partition key of its store.
+// Loading is tracked separately for each partition while pending operations
+// for all partitions are committed together. Session cookie restoration is
+// selected by each store when it loads and local state is cleared separately
+// for each partition when the last store for that partition is destroyed.
+//
+// If a background load delay is configured, ChainLoadCookies() is not started
+// until the delay expires so that startup work on the DB thread is not
+// competing with the chain load. Domain keys requested by the CookieMonster in
+// the meantime are still loaded immediately via LoadCookiesForKey.
 class BrowserPersistentCookieStore::Backend
     : public base::RefCountedThreadSafe<BrowserPersistentCookieStore::Backend> {
  public:
-  Backend(const FilePath& path, bool restore_old_session_cookies)
+  Backend(const FilePath& path,
+          int commit_interval_ms,
+          size_t commit_batch_size,
+          cef_database_journal_mode_t journal_mode,
+          cef_database_synchronous_t synchronous,
+          int background_load_delay_ms)
       : path_(path),
         db_(NULL),
         num_pending_(0),
-        clear_local_state_on_exit_(false),
+        cleared_partition_(false),
         initialized_(false),
-        restore_old_session_cookies_(restore_old_session_cookies) {
+        commit_interval_ms_(commit_interval_ms),
+        commit_batch_size_(commit_batch_size),
+        journal_mode_(journal_mode),
+        synchronous_(synchronous),
+        background_load_delay_ms_(background_load_delay_ms) {
   }
 
-  // Creates or loads the SQLite database.
-  void Load(const LoadedCallback& loaded_callback);
+  // Register a store for |partition|.
+  void AddPartitionStore(const std::string& partition);
+
+  // Unregister a store for |partition|. The cookies in |partition| are deleted
+  // if this is the last store and clearing of local state was requested.
+  void RemovePartitionStore(const std::string& partition);
+
+  // Creates or loads the SQLite database and loads the cookies for
+  // |partition|. Session cookies are only loaded if
+  // |restore_old_session_cookies| is true.
+  void Load(const std::string& partition,
+            bool restore_old_session_cookies,
+            const LoadedCallback& loaded_callback);
 
-  // Loads cookies for the domain key (eTLD+1).
-  void LoadCookiesForKey(const std::string& domain,
+  // Loads cookies in |partition| for the domain key (eTLD+1).
+  void LoadCookiesForKey(const std::string& partition,
+      bool restore_old_session_cookies,
+      const std::string& domain,
       const LoadedCallback& loaded_callback);
 
   // Batch a cookie addition.
-  void AddCookie(const net::CookieMonster::CanonicalCookie& cc);
+  void AddCookie(const std::string& partition,
+                 const net::CookieMonster::CanonicalCookie& cc);
 
   // Batch a cookie access time update.
-  void UpdateCookieAccessTime(const net::CookieMonster::CanonicalCookie& cc);
+  void UpdateCookieAccessTime(const std::string& partition,
+                              const net::CookieMonster::CanonicalCookie& cc);
 
   // Batch a cookie deletion.
-  void DeleteCookie(const net::CookieMonster::CanonicalCookie& cc);
+  void DeleteCookie(const std::string& partition,
+                    const net::CookieMonster::CanonicalCookie& cc);
 
   // Commit pending operations as soon as possible.
   void Flush(const base::Closure& callback);
@@ -90,7 +136,12 @@ class BrowserPersistentCookieStore::Backend
   // before the object is destructed.
   void Close();
 
-  void SetClearLocalStateOnExit(bool clear_local_state);
+  // Delete the cookies in |partition| when its last store is destroyed.
+  void SetClearLocalStateOnExit(const std::string& partition,
+                                bool clear_local_state);
+
+  // Returns the load metrics for |partition|.
+  void GetLoadMetrics(const std::string& partition, LoadMetrics* metrics);
 
  private:
   friend class base::RefCountedThreadSafe<
@@ -105,6 +156,9 @@ class BrowserPersistentCookieStore::Backend
   // Database upgrade statements.
   bool EnsureDatabaseVersion();
 
+  // Apply the configured journal mode and synchronous level.
+  void SetDatabasePragmas();
+
   class PendingOperation {
    public:
     typedef enum {
@@ -114,52 +168,112 @@ class BrowserPersistentCookieStore::Backend
     } OperationType;
 
     PendingOperation(OperationType op,
+                     const std::string& partition,
                      const net::CookieMonster::CanonicalCookie& cc)
-        : op_(op), cc_(cc) { }
+        : op_(op), partition_(partition), cc_(cc) { }
 
     OperationType op() const { return op_; }
+    const std::string& partition() const { return partition_; }
     const net::CookieMonster::CanonicalCookie& cc() const { return cc_; }
 
    private:
     OperationType op_;
+    std::string partition_;
     net::CookieMonster::CanonicalCookie cc_;
   };
 
+  // Load state for a single partition.
+  struct Partition {
+    Partition()
+        : initialized(false),
+          store_count(0),
+          clear_local_state_on_exit(false) {}
+
+    // Map of domain keys(eTLD+1) to domains/hosts that are to be loaded from
+    // DB. Only accessed on the DB thread.
+    std::map<std::string, std::set<std::string> > keys_to_load;
+
+    // True if |keys_to_load| has been populated. Only accessed on the DB
+    // thread.
+    bool initialized;
+
+    // Temporary buffer for cookies loaded from DB. Accumulates cookies to
+    // reduce the number of messages sent to the IO thread. Sent back in
+    // response to individual load requests for domain keys or when all loading
+    // completes. Guarded by |lock_|.
+    std::vector<net::CookieMonster::CanonicalCookie*> cookies;
+
+    // Time that the full load was requested. Guarded by |lock_|.
+    base::TimeTicks load_start;
+
+    // Load metrics, excluding the database open time. Guarded by |lock_|.
+    LoadMetrics metrics;
+
+    // Number of stores using this partition. Guarded by |lock_|.
+    int store_count;
+
+    // True if the cookies in this partition should be deleted when the last
+    // store is destroyed. Guarded by |lock_|.
+    bool clear_local_state_on_exit;
+  };
+
  private:
   // Creates or loads the SQLite database on DB thread.
-  void LoadAndNotifyOnDBThread(const LoadedCallback& loaded_callback);
+  void LoadAndNotifyOnDBThread(const std::string& partition,
+                               bool restore_old_session_cookies,
+                               const LoadedCallback& loaded_callback);
 
   // Loads cookies for the domain key (eTLD+1) on DB thread.
-  void LoadKeyAndNotifyOnDBThread(const std::string& domains,
+  void LoadKeyAndNotifyOnDBThread(const std::string& partition,
+      bool restore_old_session_cookies,
+      const std::string& domains,
       const LoadedCallback& loaded_callback);
 
   // Notifies the CookieMonster when loading completes for a specific domain key
   // or for all domain keys. Triggers the callback and passes it all cookies
   // that have been loaded from DB since last IO notification.
   void NotifyOnIOThread(
+      const std::string& partition,
       const LoadedCallback& loaded_callback,
       bool load_success);
 
   // Initialize the data base.
   bool InitializeDatabase();
 
+  // Build the map of domain keys to load for |partition|.
+  bool InitializePartition(const std::string& partition);
+
+  // Returns the load state for |partition|, creating it if necessary. The
+  // returned object remains valid for the lifespan of this object.
+  Partition* GetPartition(const std::string& partition);
+
   // Loads cookies for the next domain key from the DB, then either reschedules
   // itself or schedules the provided callback to run on the IO thread (if all
   // domains are loaded).
-  void ChainLoadCookies(const LoadedCallback& loaded_callback);
+  void ChainLoadCookies(const std::string& partition,
+                        bool restore_old_session_cookies,
+                        const LoadedCallback& loaded_callback);
 
-  // Load all cookies for a set of domains/hosts
-  bool LoadCookiesForDomains(const std::set<std::string>& key);
+  // Load all cookies in |partition| for a set of domains/hosts. |priority| is
+  // true if the domains were requested on demand.
+  bool LoadCookiesForDomains(const std::string& partition,
+                             bool restore_old_session_cookies,
+                             const std::set<std::string>& key,
+                             bool priority);
 
   // Batch a cookie operation (add or delete)
   void BatchOperation(PendingOperation::OperationType op,
+                      const std::string& partition,
                       const net::CookieMonster::CanonicalCookie& cc);
   // Commit our pending operations to the database.
   void Commit();
   // Close() executed on the background thread.
   void InternalBackgroundClose();
 
-  void DeleteSessionCookies();
+  void DeleteSessionCookies(const std::string& partition);
+
+  // Commit pending operations and delete all cookies in |partition|.
+  void ClearPartitionOnDBThread(const std::string& partition);
 
   FilePath path_;
   scoped_ptr<sql::Connection> db_;
@@ -168,29 +282,41 @@ class BrowserPersistentCookieStore::Backend
   typedef std::list<PendingOperation*> PendingOperationsList;
   PendingOperationsList pending_;
   PendingOperationsList::size_type num_pending_;
-  // True if the persistent store should be deleted upon destruction.
-  bool clear_local_state_on_exit_;
-  // Guard |cookies_|, |pending_|, |num_pending_|, |clear_local_state_on_exit_|
+  // True if a partition has been cleared. The database file is deleted on
+  // close if no cookies remain. Only accessed on the DB thread.
+  bool cleared_partition_;
+  // Guard |partitions_|, |pending_|, |num_pending_|
   base::Lock lock_;
 
-  // Temporary buffer for cookies loaded from DB. Accumulates cookies to reduce
-  // the number of messages sent to the IO thread. Sent back in response to
-  // individual load requests for domain keys or when all loading completes.
-  std::vector<net::CookieMonster::CanonicalCookie*> cookies_;
-
-  // Map of domain keys(eTLD+1) to domains/hosts that are to be loaded from DB.
-  std::map<std::string, std::set<std::string> > keys_to_load_;
+  // Map of partition key to load state. Entries are never removed.
+  typedef std::map<std::string, Partition> PartitionMap;
+  PartitionMap partitions_;
 
   // Indicates if DB has been initialized.
   bool initialized_;
 
-  // If false, we should filter out session cookies when reading the DB.
-  bool restore_old_session_cookies_;
+  // Commit pending operations after this delay.
+  const int commit_interval_ms_;
+  // Commit right away if we have this many outstanding operations.
+  const size_t commit_batch_size_;
+
+  const cef_database_journal_mode_t journal_mode_;
+  const cef_database_synchronous_t synchronous_;
+
+  // Delay before the background chain load starts.
+  const int background_load_delay_ms_;
+
+  // Time spent initializing the database. Guarded by |lock_|.
+  base::TimeDelta database_open_time_;
+
   DISALLOW_COPY_AND_ASSIGN(Backend);
 };
 
 // Version number of the database.
 //
+// Version 6 adds the partition_key column so that multiple cookie partitions
+// can share a database. Rows are unique by partition_key and creation_utc.
+//
 // Version 5 adds the columns has_expires and is_persistent, so that the
 // database can store session cookies as well as persistent cookies. Databases
 // of version 5 are incompatible with older versions of code. If a database of
@@ -204,8 +330,8 @@ class BrowserPersistentCookieStore::Backend
 // Version 3 updated the database to include the last access time, so we can
 // expire them in decreasing order of use when we've reached the maximum
 // number of cookies.
-static const int kCurrentVersionNumber = 5;
-static const int kCompatibleVersionNumber = 5;
+static const int kCurrentVersionNumber = 6;
+static const int kCompatibleVersionNumber = 6;
 
 namespace {
 
@@ -213,7 +339,8 @@ namespace {
 bool InitTable(sql::Connection* db) {
   if (!db->DoesTableExist("cookies")) {
     if (!db->Execute("CREATE TABLE cookies ("
-                     "creation_utc INTEGER NOT NULL UNIQUE PRIMARY KEY,"
+                     "partition_key TEXT NOT NULL DEFAULT '',"
+                     "creation_utc INTEGER NOT NULL,"
                      "host_key TEXT NOT NULL,"
                      "name TEXT NOT NULL,"
                      "value TEXT NOT NULL,"
@@ -223,7 +350,8 @@ bool InitTable(sql::Connection* db) {
                      "httponly INTEGER NOT NULL,"
                      "last_access_utc INTEGER NOT NULL, "
                      "has_expires INTEGER NOT NULL DEFAULT 1, "
-                     "persistent INTEGER NOT NULL DEFAULT 1)"))
+                     "persistent INTEGER NOT NULL DEFAULT 1, "
+                     "UNIQUE (partition_key, creation_utc))"))
       return false;
   }
 
@@ -237,56 +365,113 @@ bool InitTable(sql::Connection* db) {
   if (!db->Execute("CREATE INDEX IF NOT EXISTS domain ON cookies(host_key)"))
     return false;
 
+  if (!db->Execute("CREATE INDEX IF NOT EXISTS partition_domain ON cookies"
+                   " (partition_key, host_key)")) {
+    return false;
+  }
+
   return true;
 }
 
 }  // namespace
 
+void BrowserPersistentCookieStore::Backend::AddPartitionStore(
+    const std::string& partition) {
+  base::AutoLock locked(lock_);
+  partitions_[partition].store_count++;
+}
+
+void BrowserPersistentCookieStore::Backend::RemovePartitionStore(
+    const std::string& partition) {
+  {
+    base::AutoLock locked(lock_);
+    Partition& state = partitions_[partition];
+    DCHECK_GT(state.store_count, 0);
+    if (--state.store_count > 0 || !state.clear_local_state_on_exit)
+      return;
+    state.clear_local_state_on_exit = false;
+  }
+
+  CefThread::PostTask(
+      CefThread::FILE, FROM_HERE,
+      base::Bind(&Backend::ClearPartitionOnDBThread, this, partition));
+}
+
 void BrowserPersistentCookieStore::Backend::Load(
+    const std::string& partition,
+    bool restore_old_session_cookies,
     const LoadedCallback& loaded_callback) {
-  // This function should be called only once per instance.
-  DCHECK(!db_.get());
+  {
+    base::AutoLock locked(lock_);
+    Partition& state = partitions_[partition];
+    state.load_start = base::TimeTicks::Now();
+    state.metrics = LoadMetrics();
+  }
+
   CefThread::PostTask(
       CefThread::FILE, FROM_HERE,
-      base::Bind(&Backend::LoadAndNotifyOnDBThread, this, loaded_callback));
+      base::Bind(&Backend::LoadAndNotifyOnDBThread, this, partition,
+                 restore_old_session_cookies, loaded_callback));
 }
 
 void BrowserPersistentCookieStore::Backend::LoadCookiesForKey(
+    const std::string& partition,
+    bool restore_old_session_cookies,
     const std::string& key,
     const LoadedCallback& loaded_callback) {
   CefThread::PostTask(
     CefThread::FILE, FROM_HERE,
     base::Bind(&Backend::LoadKeyAndNotifyOnDBThread, this,
+    partition,
+    restore_old_session_cookies,
     key,
     loaded_callback));
 }
 
 void BrowserPersistentCookieStore::Backend::LoadAndNotifyOnDBThread(
+    const std::string& partition,
+    bool restore_old_session_cookies,
     const LoadedCallback& loaded_callback) {
   DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
 
-  if (!InitializeDatabase()) {
+  // Discard load state left by a previous store for the same partition.
+  Partition* state = GetPartition(partition);
+  state->initialized = false;
+  state->keys_to_load.clear();
+
+  if (!InitializeDatabase() || !InitializePartition(partition)) {
     CefThread::PostTask(
       CefThread::IO, FROM_HERE,
       base::Bind(&BrowserPersistentCookieStore::Backend::NotifyOnIOThread,
-                 this, loaded_callback, false));
+                 this, partition, loaded_callback, false));
+  } else if (background_load_delay_ms_ > 0) {
+    // Domain keys will be loaded on demand until the delay expires.
+    CefThread::PostDelayedTask(
+      CefThread::FILE, FROM_HERE,
+      base::Bind(&Backend::ChainLoadCookies, this, partition,
+                 restore_old_session_cookies, loaded_callback),
+      background_load_delay_ms_);
   } else {
-    ChainLoadCookies(loaded_callback);
+    ChainLoadCookies(partition, restore_old_session_cookies, loaded_callback);
   }
 }
 
 void BrowserPersistentCookieStore::Backend::LoadKeyAndNotifyOnDBThread(
+    const std::string& partition,
+    bool restore_old_session_cookies,
     const std::string& key,
     const LoadedCallback& loaded_callback) {
   DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
 
   bool success = false;
-  if (InitializeDatabase()) {
+  if (InitializeDatabase() && InitializePartition(partition)) {
+    Partition* state = GetPartition(partition);
     std::map<std::string, std::set<std::string> >::iterator
-      it = keys_to_load_.find(key);
-    if (it != keys_to_load_.end()) {
-      success = LoadCookiesForDomains(it->second);
-      keys_to_load_.erase(it);
+      it = state->keys_to_load.find(key);
+    if (it != state->keys_to_load.end()) {
+      success = LoadCookiesForDomains(partition, restore_old_session_cookies,
+                                      it->second, true);
+      state->keys_to_load.erase(it);
     } else {
       success = true;
     }
@@ -295,10 +480,11 @@ void BrowserPersistentCookieStore::Backend::LoadKeyAndNotifyOnDBThread(
   CefThread::PostTask(
     CefThread::IO, FROM_HERE,
     base::Bind(&BrowserPersistentCookieStore::Backend::NotifyOnIOThread,
-    this, loaded_callback, success));
+    this, partition, loaded_callback, success));
 }
 
 void BrowserPersistentCookieStore::Backend::NotifyOnIOThread(
+    const std::string& partition,
     const LoadedCallback& loaded_callback,
     bool load_success) {
   DCHECK(CefThread::CurrentlyOn(CefThread::IO));
@@ -306,7 +492,7 @@ void BrowserPersistentCookieStore::Backend::NotifyOnIOThread(
   std::vector<net::CookieMonster::CanonicalCookie*> cookies;
   {
     base::AutoLock locked(lock_);
-    cookies.swap(cookies_);
+    cookies.swap(partitions_[partition].cookies);
   }
 
   loaded_callback.Run(cookies);
@@ -326,6 +512,8 @@ bool BrowserPersistentCookieStore::Backend::InitializeDatabase() {
     return false;
   }
 
+  base::TimeTicks open_start = base::TimeTicks::Now();
+
   db_.reset(new sql::Connection);
   if (!db_->Open(path_)) {
     NOTREACHED() << "Unable to open cookie DB.";
@@ -335,23 +523,42 @@ bool BrowserPersistentCookieStore::Backend::InitializeDatabase() {
 
   // db_->set_error_delegate(GetErrorHandlerForCookieDb());
 
+  SetDatabasePragmas();
+
   if (!EnsureDatabaseVersion() || !InitTable(db_.get())) {
     NOTREACHED() << "Unable to open cookie DB.";
     db_.reset();
     return false;
   }
 
-  // Retrieve all the domains
-  sql::Statement smt(db_->GetUniqueStatement(
-    "SELECT DISTINCT host_key FROM cookies"));
+  {
+    base::AutoLock locked(lock_);
+    database_open_time_ = base::TimeTicks::Now() - open_start;
+  }
+
+  initialized_ = true;
+  return true;
+}
+
+bool BrowserPersistentCookieStore::Backend::InitializePartition(
+    const std::string& partition) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  Partition* state = GetPartition(partition);
+  if (state->initialized)
+    return true;
+
+  // Retrieve all the domains for the partition
+  sql::Statement smt(db_->GetCachedStatement(SQL_FROM_HERE,
+    "SELECT DISTINCT host_key FROM cookies WHERE partition_key = ?"));
 
   if (!smt.is_valid()) {
     NOTREACHED() << "select statement prep failed";
-    smt.Clear();  // Disconnect smt_ref from db_.
-    db_.reset();
     return false;
   }
 
+  smt.BindString(0, partition);
+
   // Build a map of domain keys (always eTLD+1) to domains.
   while (smt.Step()) {
     std::string domain = smt.ColumnString(0);
@@ -359,68 +566,91 @@ bool BrowserPersistentCookieStore::Backend::InitializeDatabase() {
       net::RegistryControlledDomainService::GetDomainAndRegistry(domain);
 
     std::map<std::string, std::set<std::string> >::iterator it =
-      keys_to_load_.find(key);
-    if (it == keys_to_load_.end())
-      it = keys_to_load_.insert(std::make_pair
-                                (key, std::set<std::string>())).first;
+      state->keys_to_load.find(key);
+    if (it == state->keys_to_load.end())
+      it = state->keys_to_load.insert(std::make_pair
+                                      (key, std::set<std::string>())).first;
     it->second.insert(domain);
   }
 
-  initialized_ = true;
+  state->initialized = true;
   return true;
 }
 
+BrowserPersistentCookieStore::Backend::Partition*
+    BrowserPersistentCookieStore::Backend::GetPartition(
+        const std::string& partition) {
+  base::AutoLock locked(lock_);
+  return &partitions_[partition];
+}
+
 void BrowserPersistentCookieStore::Backend::ChainLoadCookies(
+    const std::string& partition,
+    bool restore_old_session_cookies,
     const LoadedCallback& loaded_callback) {
   DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
 
+  Partition* state = GetPartition(partition);
   bool load_success = true;
 
   if (!db_.get()) {
     // Close() has been called on this store.
     load_success = false;
-  } else if (keys_to_load_.size() > 0) {
+  } else if (state->keys_to_load.size() > 0) {
     // Load cookies for the first domain key.
     std::map<std::string, std::set<std::string> >::iterator
-      it = keys_to_load_.begin();
-    load_success = LoadCookiesForDomains(it->second);
-    keys_to_load_.erase(it);
+      it = state->keys_to_load.begin();
+    load_success = LoadCookiesForDomains(partition,
+                                         restore_old_session_cookies,
+                                         it->second, false);
+    state->keys_to_load.erase(it);
   }
 
   // If load is successful and there are more domain keys to be loaded,
   // then post a DB task to continue chain-load;
   // Otherwise notify on IO thread.
-  if (load_success && keys_to_load_.size() > 0) {
+  if (load_success && state->keys_to_load.size() > 0) {
     CefThread::PostTask(
       CefThread::FILE, FROM_HERE,
-      base::Bind(&Backend::ChainLoadCookies, this, loaded_callback));
+      base::Bind(&Backend::ChainLoadCookies, this, partition,
+                 restore_old_session_cookies, loaded_callback));
   } else {
+    if (load_success) {
+      base::AutoLock locked(lock_);
+      state->metrics.load_complete = true;
+      state->metrics.total_load_time =
+          base::TimeTicks::Now() - state->load_start;
+    }
     CefThread::PostTask(
       CefThread::IO, FROM_HERE,
       base::Bind(&BrowserPersistentCookieStore::Backend::NotifyOnIOThread,
-                 this, loaded_callback, load_success));
-    if (load_success && !restore_old_session_cookies_)
-      DeleteSessionCookies();
+                 this, partition, loaded_callback, load_success));
+    if (load_success && !restore_old_session_cookies)
+      DeleteSessionCookies(partition);
   }
 }
 
 bool BrowserPersistentCookieStore::Backend::LoadCookiesForDomains(
-  const std::set<std::string>& domains) {
+  const std::string& partition,
+  bool restore_old_session_cookies,
+  const std::set<std::string>& domains,
+  bool priority) {
   DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
 
   sql::Statement smt;
-  if (restore_old_session_cookies_) {
+  if (restore_old_session_cookies) {
     smt.Assign(db_->GetCachedStatement(
       SQL_FROM_HERE,
       "SELECT creation_utc, host_key, name, value, path, expires_utc, "
       "secure, httponly, last_access_utc, has_expires, persistent "
-      "FROM cookies WHERE host_key = ?"));
+      "FROM cookies WHERE partition_key = ? AND host_key = ?"));
   } else {
     smt.Assign(db_->GetCachedStatement(
       SQL_FROM_HERE,
       "SELECT creation_utc, host_key, name, value, path, expires_utc, "
       "secure, httponly, last_access_utc, has_expires, persistent "
-      "FROM cookies WHERE host_key = ? AND persistent = 1"));
+      "FROM cookies WHERE partition_key = ? AND host_key = ? AND "
+      "persistent = 1"));
   }
   if (!smt.is_valid()) {
     NOTREACHED() << "select statement prep failed";
@@ -432,7 +662,8 @@ bool BrowserPersistentCookieStore::Backend::LoadCookiesForDomains(
   std::vector<net::CookieMonster::CanonicalCookie*> cookies;
   std::set<std::string>::const_iterator it = domains.begin();
   for (; it != domains.end(); ++it) {
-    smt.BindString(0, *it);
+    smt.BindString(0, partition);
+    smt.BindString(1, *it);
     while (smt.Step()) {
       scoped_ptr<net::CookieMonster::CanonicalCookie> cc(
           new net::CookieMonster::CanonicalCookie(
@@ -459,11 +690,53 @@ bool BrowserPersistentCookieStore::Backend::LoadCookiesForDomains(
   }
   {
     base::AutoLock locked(lock_);
-    cookies_.insert(cookies_.end(), cookies.begin(), cookies.end());
+    Partition& state = partitions_[partition];
+    state.cookies.insert(state.cookies.end(), cookies.begin(), cookies.end());
+    if (priority)
+      state.metrics.priority_key_count++;
+    else
+      state.metrics.background_key_count++;
+    state.metrics.cookie_count += static_cast<int>(cookies.size());
   }
   return true;
 }
 
+void BrowserPersistentCookieStore::Backend::SetDatabasePragmas() {
+  const char* journal_mode = NULL;
+  switch (journal_mode_) {
+    case DATABASE_JOURNAL_MODE_TRUNCATE:
+      journal_mode = "PRAGMA journal_mode=TRUNCATE";
+      break;
+    case DATABASE_JOURNAL_MODE_PERSIST:
+      journal_mode = "PRAGMA journal_mode=PERSIST";
+      break;
+    case DATABASE_JOURNAL_MODE_WAL:
+      journal_mode = "PRAGMA journal_mode=WAL";
+      break;
+    default:
+      break;
+  }
+  if (journal_mode && !db_->Execute(journal_mode))
+    LOG(WARNING) << "Unable to set the cookie DB journal mode.";
+
+  const char* synchronous = NULL;
+  switch (synchronous_) {
+    case DATABASE_SYNCHRONOUS_OFF:
+      synchronous = "PRAGMA synchronous=OFF";
+      break;
+    case DATABASE_SYNCHRONOUS_NORMAL:
+      synchronous = "PRAGMA synchronous=NORMAL";
+      break;
+    case DATABASE_SYNCHRONOUS_FULL:
+      synchronous = "PRAGMA synchronous=FULL";
+      break;
+    default:
+      break;
+  }
+  if (synchronous && !db_->Execute(synchronous))
+    LOG(WARNING) << "Unable to set the cookie DB synchronous level.";
+}
+
 bool BrowserPersistentCookieStore::Backend::EnsureDatabaseVersion() {
   // Version check.
   if (!meta_table_.Init(
@@ -546,6 +819,33 @@ bool BrowserPersistentCookieStore::Backend::EnsureDatabaseVersion() {
     transaction.Commit();
   }
 
+  if (cur_version == 5) {
+    // The primary key changes from creation_utc to (partition_key,
+    // creation_utc) so the table must be recreated.
+    sql::Transaction transaction(db_.get());
+    if (!transaction.Begin())
+      return false;
+    if (!db_->Execute("ALTER TABLE cookies RENAME TO cookies_v5") ||
+        !db_->Execute("DROP INDEX IF EXISTS cookie_times") ||
+        !db_->Execute("DROP INDEX IF EXISTS domain") ||
+        !InitTable(db_.get()) ||
+        !db_->Execute("INSERT INTO cookies (creation_utc, host_key, name, "
+                      "value, path, expires_utc, secure, httponly, "
+                      "last_access_utc, has_expires, persistent) "
+                      "SELECT creation_utc, host_key, name, value, path, "
+                      "expires_utc, secure, httponly, last_access_utc, "
+                      "has_expires, persistent FROM cookies_v5") ||
+        !db_->Execute("DROP TABLE cookies_v5")) {
+      LOG(WARNING) << "Unable to update cookie database to version 6.";
+      return false;
+    }
+    ++cur_version;
+    meta_table_.SetVersionNumber(cur_version);
+    meta_table_.SetCompatibleVersionNumber(
+        std::min(cur_version, kCompatibleVersionNumber));
+    transaction.Commit();
+  }
+
   // Put future migration cases here.
 
   // When the version is too old, we just try to continue anyway, there should
@@ -557,31 +857,31 @@ bool BrowserPersistentCookieStore::Backend::EnsureDatabaseVersion() {
 }
 
 void BrowserPersistentCookieStore::Backend::AddCookie(
+    const std::string& partition,
     const net::CookieMonster::CanonicalCookie& cc) {
-  BatchOperation(PendingOperation::COOKIE_ADD, cc);
+  BatchOperation(PendingOperation::COOKIE_ADD, partition, cc);
 }
 
 void BrowserPersistentCookieStore::Backend::UpdateCookieAccessTime(
+    const std::string& partition,
     const net::CookieMonster::CanonicalCookie& cc) {
-  BatchOperation(PendingOperation::COOKIE_UPDATEACCESS, cc);
+  BatchOperation(PendingOperation::COOKIE_UPDATEACCESS, partition, cc);
 }
 
 void BrowserPersistentCookieStore::Backend::DeleteCookie(
+    const std::string& partition,
     const net::CookieMonster::CanonicalCookie& cc) {
-  BatchOperation(PendingOperation::COOKIE_DELETE, cc);
+  BatchOperation(PendingOperation::COOKIE_DELETE, partition, cc);
 }
 
 void BrowserPersistentCookieStore::Backend::BatchOperation(
     PendingOperation::OperationType op,
+    const std::string& partition,
     const net::CookieMonster::CanonicalCookie& cc) {
-  // Commit every 30 seconds.
-  static const int kCommitIntervalMs = 30 * 1000;
-  // Commit right away if we have more than 512 outstanding operations.
-  static const size_t kCommitAfterBatchSize = 512;
   DCHECK(!CefThread::CurrentlyOn(CefThread::FILE));
 
   // We do a full copy of the cookie here, and hopefully just here.
-  scoped_ptr<PendingOperation> po(new PendingOperation(op, cc));
+  scoped_ptr<PendingOperation> po(new PendingOperation(op, partition, cc));
 
   PendingOperationsList::size_type num_pending;
   {
@@ -590,16 +890,16 @@ void BrowserPersistentCookieStore::Backend::BatchOperation(
     num_pending = ++num_pending_;
   }
 
-  if (num_pending == 1) {
-    // We've gotten our first entry for this batch, fire off the timer.
-    CefThread::PostDelayedTask(
-        CefThread::FILE, FROM_HERE,
-        base::Bind(&Backend::Commit, this), kCommitIntervalMs);
-  } else if (num_pending == kCommitAfterBatchSize) {
+  if (num_pending == commit_batch_size_) {
     // We've reached a big enough batch, fire off a commit now.
     CefThread::PostTask(
         CefThread::FILE, FROM_HERE,
         base::Bind(&Backend::Commit, this));
+  } else if (num_pending == 1) {
+    // We've gotten our first entry for this batch, fire off the timer.
+    CefThread::PostDelayedTask(
+        CefThread::FILE, FROM_HERE,
+        base::Bind(&Backend::Commit, this), commit_interval_ms_);
   }
 }
 
@@ -618,24 +918,25 @@ void BrowserPersistentCookieStore::Backend::Commit() {
     return;
 
   sql::Statement add_smt(db_->GetCachedStatement(SQL_FROM_HERE,
-      "INSERT INTO cookies (creation_utc, host_key, name, value, path, "
-      "expires_utc, secure, httponly, last_access_utc, has_expires, "
-      "persistent) "
-      "VALUES (?,?,?,?,?,?,?,?,?,?,?)"));
+      "INSERT INTO cookies (partition_key, creation_utc, host_key, name, "
+      "value, path, expires_utc, secure, httponly, last_access_utc, "
+      "has_expires, persistent) "
+      "VALUES (?,?,?,?,?,?,?,?,?,?,?,?)"));
   if (!add_smt) {
     NOTREACHED();
     return;
   }
 
   sql::Statement update_access_smt(db_->GetCachedStatement(SQL_FROM_HERE,
-      "UPDATE cookies SET last_access_utc=? WHERE creation_utc=?"));
+      "UPDATE cookies SET last_access_utc=? WHERE partition_key=? AND "
+      "creation_utc=?"));
   if (!update_access_smt) {
     NOTREACHED();
     return;
   }
 
   sql::Statement del_smt(db_->GetCachedStatement(SQL_FROM_HERE,
-                         "DELETE FROM cookies WHERE creation_utc=?"));
+      "DELETE FROM cookies WHERE partition_key=? AND creation_utc=?"));
   if (!del_smt) {
     NOTREACHED();
     return;
@@ -653,17 +954,18 @@ void BrowserPersistentCookieStore::Backend::Commit() {
     switch (po->op()) {
       case PendingOperation::COOKIE_ADD:
         add_smt.Reset();
-        add_smt.BindInt64(0, po->cc().CreationDate().ToInternalValue());
-        add_smt.BindString(1, po->cc().Domain());
-        add_smt.BindString(2, po->cc().Name());
-        add_smt.BindString(3, po->cc().Value());
-        add_smt.BindString(4, po->cc().Path());
-        add_smt.BindInt64(5, po->cc().ExpiryDate().ToInternalValue());
-        add_smt.BindInt(6, po->cc().IsSecure());
-        add_smt.BindInt(7, po->cc().IsHttpOnly());
-        add_smt.BindInt64(8, po->cc().LastAccessDate().ToInternalValue());
-        add_smt.BindInt(9, po->cc().DoesExpire());
-        add_smt.BindInt(10, po->cc().IsPersistent());
+        add_smt.BindString(0, po->partition());
+        add_smt.BindInt64(1, po->cc().CreationDate().ToInternalValue());
+        add_smt.BindString(2, po->cc().Domain());
+        add_smt.BindString(3, po->cc().Name());
+        add_smt.BindString(4, po->cc().Value());
+        add_smt.BindString(5, po->cc().Path());
+        add_smt.BindInt64(6, po->cc().ExpiryDate().ToInternalValue());
+        add_smt.BindInt(7, po->cc().IsSecure());
+        add_smt.BindInt(8, po->cc().IsHttpOnly());
+        add_smt.BindInt64(9, po->cc().LastAccessDate().ToInternalValue());
+        add_smt.BindInt(10, po->cc().DoesExpire());
+        add_smt.BindInt(11, po->cc().IsPersistent());
         if (!add_smt.Run())
           NOTREACHED() << "Could not add a cookie to the DB.";
         break;
@@ -672,7 +974,8 @@ void BrowserPersistentCookieStore::Backend::Commit() {
         update_access_smt.Reset();
         update_access_smt.BindInt64(0,
             po->cc().LastAccessDate().ToInternalValue());
-        update_access_smt.BindInt64(1,
+        update_access_smt.BindString(1, po->partition());
+        update_access_smt.BindInt64(2,
             po->cc().CreationDate().ToInternalValue());
         if (!update_access_smt.Run())
           NOTREACHED() << "Could not update cookie last access time in the DB.";
@@ -680,7 +983,8 @@ void BrowserPersistentCookieStore::Backend::Commit() {
 
       case PendingOperation::COOKIE_DELETE:
         del_smt.Reset();
-        del_smt.BindInt64(0, po->cc().CreationDate().ToInternalValue());
+        del_smt.BindString(0, po->partition());
+        del_smt.BindInt64(1, po->cc().CreationDate().ToInternalValue());
         if (!del_smt.Run())
           NOTREACHED() << "Could not delete a cookie from the DB.";
         break;
@@ -725,71 +1029,183 @@ void BrowserPersistentCookieStore::Backend::InternalBackgroundClose() {
   // Commit any pending operations
   Commit();
 
+  // Delete the database if cleared partitions have left it empty.
+  bool delete_file = false;
+  if (cleared_partition_ && db_.get()) {
+    sql::Statement smt(db_->GetUniqueStatement(
+        "SELECT COUNT(*) FROM cookies"));
+    delete_file = (smt.is_valid() && smt.Step() && smt.ColumnInt(0) == 0);
+  }
+
   db_.reset();
 
-  if (clear_local_state_on_exit_)
+  if (delete_file)
     file_util::Delete(path_, false);
 }
 
 void BrowserPersistentCookieStore::Backend::SetClearLocalStateOnExit(
+    const std::string& partition,
     bool clear_local_state) {
   base::AutoLock locked(lock_);
-  clear_local_state_on_exit_ = clear_local_state;
+  partitions_[partition].clear_local_state_on_exit = clear_local_state;
+}
+
+void BrowserPersistentCookieStore::Backend::GetLoadMetrics(
+    const std::string& partition,
+    LoadMetrics* metrics) {
+  base::AutoLock locked(lock_);
+  PartitionMap::const_iterator it = partitions_.find(partition);
+  if (it != partitions_.end())
+    *metrics = it->second.metrics;
+  else
+    *metrics = LoadMetrics();
+  metrics->database_open_time = database_open_time_;
 }
 
-void BrowserPersistentCookieStore::Backend::DeleteSessionCookies() {
+void BrowserPersistentCookieStore::Backend::DeleteSessionCookies(
+    const std::string& partition) {
   DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
-  if (!db_->Execute("DELETE FROM cookies WHERE persistent == 0"))
+  sql::Statement smt(db_->GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM cookies WHERE partition_key = ? AND persistent == 0"));
+  if (!smt.is_valid()) {
+    NOTREACHED() << "delete statement prep failed";
+    return;
+  }
+  smt.BindString(0, partition);
+  if (!smt.Run())
     LOG(WARNING) << "Unable to delete session cookies.";
 }
 
+void BrowserPersistentCookieStore::Backend::ClearPartitionOnDBThread(
+    const std::string& partition) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  // Commit first so that pending additions are not written afterwards.
+  Commit();
+
+  if (!InitializeDatabase())
+    return;
+
+  sql::Statement smt(db_->GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM cookies WHERE partition_key = ?"));
+  if (!smt.is_valid()) {
+    NOTREACHED() << "delete statement prep failed";
+    return;
+  }
+  smt.BindString(0, partition);
+  if (smt.Run())
+    cleared_partition_ = true;
+  else
+    LOG(WARNING) << "Unable to clear cookie partition.";
+}
+
+// Commit every 30 seconds by default.
+int BrowserPersistentCookieStore::commit_interval_ms_ = 30 * 1000;
+// Commit right away if we have 512 outstanding operations by default.
+size_t BrowserPersistentCookieStore::commit_batch_size_ = 512;
+cef_database_journal_mode_t BrowserPersistentCookieStore::journal_mode_ =
+    DATABASE_JOURNAL_MODE_DEFAULT;
+cef_database_synchronous_t BrowserPersistentCookieStore::synchronous_ =
+    DATABASE_SYNCHRONOUS_DEFAULT;
+// Load all cookies immediately by default.
+int BrowserPersistentCookieStore::background_load_delay_ms_ = 0;
+
+BrowserPersistentCookieStore::BackendMap*
+    BrowserPersistentCookieStore::backend_map_ = NULL;
+
+// static
+void BrowserPersistentCookieStore::set_commit_interval(int interval_ms) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+  commit_interval_ms_ = interval_ms;
+}
+
+// static
+void BrowserPersistentCookieStore::set_commit_batch_size(size_t batch_size) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+  commit_batch_size_ = batch_size;
+}
+
+// static
+void BrowserPersistentCookieStore::set_journal_mode(
+    cef_database_journal_mode_t journal_mode) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+  journal_mode_ = journal_mode;
+}
+
+// static
+void BrowserPersistentCookieStore::set_synchronous(
+    cef_database_synchronous_t synchronous) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+  synchronous_ = synchronous;
+}
+
+// static
+void BrowserPersistentCookieStore::set_background_load_delay(int delay_ms) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+  background_load_delay_ms_ = delay_ms;
+}
+
 BrowserPersistentCookieStore::BrowserPersistentCookieStore(
     const FilePath& path,
+    const std::string& partition,
     bool restore_old_session_cookies)
-    : backend_(new Backend(path, restore_old_session_cookies)) {
+    : path_(path),
+      partition_(partition),
+      restore_old_session_cookies_(restore_old_session_cookies),
+      backend_(AcquireBackend(path)) {
+  backend_->AddPartitionStore(partition_);
 }
 
 BrowserPersistentCookieStore::~BrowserPersistentCookieStore() {
   if (backend_.get()) {
-    backend_->Close();
     // Release our reference, it will probably still have a reference if the
     // background thread has not run Close() yet.
+    backend_->RemovePartitionStore(partition_);
     backend_ = NULL;
+    ReleaseBackend(path_);
   }
 }
 
 void BrowserPersistentCookieStore::Load(const LoadedCallback& loaded_callback) {
-  backend_->Load(loaded_callback);
+  backend_->Load(partition_, restore_old_session_cookies_, loaded_callback);
 }
 
 void BrowserPersistentCookieStore::LoadCookiesForKey(
     const std::string& key,
     const LoadedCallback& loaded_callback) {
-  backend_->LoadCookiesForKey(key, loaded_callback);
+  backend_->LoadCookiesForKey(partition_, restore_old_session_cookies_, key,
+                              loaded_callback);
 }
 
 void BrowserPersistentCookieStore::AddCookie(
     const net::CookieMonster::CanonicalCookie& cc) {
   if (backend_.get())
-    backend_->AddCookie(cc);
+    backend_->AddCookie(partition_, cc);
 }
 
 void BrowserPersistentCookieStore::UpdateCookieAccessTime(
     const net::CookieMonster::CanonicalCookie& cc) {
   if (backend_.get())
-    backend_->UpdateCookieAccessTime(cc);
+    backend_->UpdateCookieAccessTime(partition_, cc);
 }
 
 void BrowserPersistentCookieStore::DeleteCookie(
     const net::CookieMonster::CanonicalCookie& cc) {
   if (backend_.get())
-    backend_->DeleteCookie(cc);
+    backend_->DeleteCookie(partition_, cc);
 }
 
 void BrowserPersistentCookieStore::SetClearLocalStateOnExit(
     bool clear_local_state) {
   if (backend_.get())
-    backend_->SetClearLocalStateOnExit(clear_local_state);
+    backend_->SetClearLocalStateOnExit(partition_, clear_local_state);
+}
+
+void BrowserPersistentCookieStore::GetLoadMetrics(LoadMetrics* metrics) {
+  if (backend_.get())
+    backend_->GetLoadMetrics(partition_, metrics);
+  else
+    *metrics = LoadMetrics();
 }
 
 void BrowserPersistentCookieStore::Flush(const base::Closure& callback) {
@@ -798,3 +1214,46 @@ void BrowserPersistentCookieStore::Flush(const base::Closure& callback) {
   else if (!callback.is_null())
     MessageLoop::current()->PostTask(FROM_HERE, callback);
 }
+
+// static
+BrowserPersistentCookieStore::Backend*
+    BrowserPersistentCookieStore::AcquireBackend(const FilePath& path) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+
+  if (!backend_map_)
+    backend_map_ = new BackendMap();
+
+  BackendMap::iterator it = backend_map_->find(path);
+  if (it == backend_map_->end()) {
+    BackendInfo info;
+    info.backend = new Backend(path, commit_interval_ms_, commit_batch_size_,
+                               journal_mode_, synchronous_,
+                               background_load_delay_ms_);
+    info.store_count = 0;
+    it = backend_map_->insert(std::make_pair(path, info)).first;
+  }
+
+  it->second.store_count++;
+  return it->second.backend.get();
+}
+
+// static
+void BrowserPersistentCookieStore::ReleaseBackend(const FilePath& path) {
+  base::AutoLock locked(g_backend_map_lock.Get());
+
+  DCHECK(backend_map_);
+  BackendMap::iterator it = backend_map_->find(path);
+  DCHECK(it != backend_map_->end());
+  if (it == backend_map_->end())
+    return;
+
+  if (--it->second.store_count == 0) {
+    // The last store using this backend has been destroyed.
+    it->second.backend->Close();
+    backend_map_->erase(it);
+  } else {
+    // Commit the operations from the destroyed store so that a new store for
+    // the same partition loads the current state.
+    it->second.backend->Flush(base::Closure());
+  }
+}
@@ -9,19 +9,28 @@
 // with the following modifications for use in the cef:
 // - BrowserThread has been replaced with CefThread
 // - Performance diagnostic code has been removed (UMA_HISTOGRAM_ENUMERATION)
+// - The commit interval, commit batch size, journal mode and synchronous level
+//   are configurable
+// - Stores that use the same path share a single database and backend. Each
+//   store represents a cookie partition identified by a partition key column
+// - Background loading of all cookies can be delayed and load metrics are
+//   recorded
 
 #ifndef CEF_LIBCEF_BROWSER_PERSISTENT_COOKIE_STORE_H_
 #define CEF_LIBCEF_BROWSER_PERSISTENT_COOKIE_STORE_H_
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "base/compiler_specific.h"
+#include "base/file_path.h"
 #include "base/memory/ref_counted.h"
+#include "base/time.h"
+#include "include/internal/cef_types.h"
 #include "net/base/cookie_monster.h"
 
-class FilePath;
 class Task;
 
 // Implements the PersistentCookieStore interface in terms of a SQLite database.
@@ -30,8 +39,12 @@ class Task;
 class BrowserPersistentCookieStore
     : public net::CookieMonster::PersistentCookieStore {
  public:
+  // Stores that use the same |path| share a database. Cookies are only visible
+  // to stores with the same |partition|. |restore_old_session_cookies| and
+  // SetClearLocalStateOnExit() only affect the cookies in |partition|.
   BrowserPersistentCookieStore(const FilePath& path,
-                              bool restore_old_session_cookies);
+                               const std::string& partition,
+                               bool restore_old_session_cookies);
   virtual ~BrowserPersistentCookieStore();
 
   virtual void Load(const LoadedCallback& loaded_callback) OVERRIDE;
@@ -52,9 +65,63 @@ class BrowserPersistentCookieStore
 
   virtual void Flush(const base::Closure& callback) OVERRIDE;
 
+  struct LoadMetrics {
+    LoadMetrics()
+        : load_complete(false),
+          priority_key_count(0),
+          background_key_count(0),
+          cookie_count(0) {}
+
+    bool load_complete;
+    base::TimeDelta database_open_time;
+    base::TimeDelta total_load_time;
+    int priority_key_count;
+    int background_key_count;
+    int cookie_count;
+  };
+
+  // Returns the load metrics for this store's partition. May be called on any
+  // thread.
+  void GetLoadMetrics(LoadMetrics* metrics);
+
+  // Configure how pending operations are committed to the database. These
+  // values apply to stores that are created after they are set and may be
+  // called on any thread.
+  static void set_commit_interval(int interval_ms);
+  static void set_commit_batch_size(size_t batch_size);
+  static void set_journal_mode(cef_database_journal_mode_t journal_mode);
+  static void set_synchronous(cef_database_synchronous_t synchronous);
+  // Delay before all cookies are loaded in the background. Cookies for
+  // individual domain keys are loaded on demand until then.
+  static void set_background_load_delay(int delay_ms);
+
  private:
   class Backend;
 
+  struct BackendInfo {
+    scoped_refptr<Backend> backend;
+    int store_count;
+  };
+  typedef std::map<FilePath, BackendInfo> BackendMap;
+
+  // Returns the backend for |path|, creating it if necessary.
+  static Backend* AcquireBackend(const FilePath& path);
+  // Release a backend returned by AcquireBackend(). The backend is closed when
+  // the last store using it is destroyed.
+  static void ReleaseBackend(const FilePath& path);
+
+  // Map of database path to shared backend.
+  static BackendMap* backend_map_;
+
+  static int commit_interval_ms_;
+  static size_t commit_batch_size_;
+  static cef_database_journal_mode_t journal_mode_;
+  static cef_database_synchronous_t synchronous_;
+  static int background_load_delay_ms_;
+
+  FilePath path_;
+  std::string partition_;
+  bool restore_old_session_cookies_;
   scoped_refptr<Backend> backend_;
 
   DISALLOW_COPY_AND_ASSIGN(BrowserPersistentCookieStore);
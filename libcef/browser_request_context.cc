@@ -12,6 +12,7 @@
 #include "libcef/browser_file_system.h"
 #include "libcef/browser_persistent_cookie_store.h"
 #include "libcef/browser_resource_loader_bridge.h"
+#include "libcef/browser_webcookiejar_impl.h"
 #include "libcef/cef_context.h"
 #include "libcef/cef_thread.h"
 
@@ -311,7 +312,8 @@ void BrowserRequestContext::SetCookieStoragePath(const FilePath& path) {
   if (!path.empty()) {
     if (file_util::CreateDirectory(path)) {
       const FilePath& cookie_path = path.AppendASCII("Cookies");
-      persistent_store = new BrowserPersistentCookieStore(cookie_path, false);
+      persistent_store =
+          new BrowserPersistentCookieStore(cookie_path, std::string(), false);
     } else {
       NOTREACHED() << "The cookie storage directory could not be created";
     }
@@ -321,8 +323,11 @@ void BrowserRequestContext::SetCookieStoragePath(const FilePath& path) {
   // cookie store, if any, will be automatically flushed and closed when no
   // longer referenced.
   storage_.set_cookie_store(
-      new net::CookieMonster(persistent_store.get(), NULL));
+      new net::CookieMonster(persistent_store.get(),
+          BrowserWebCookieJarImpl::CreateCookieMonsterDelegate()));
   cookie_store_path_ = path;
+  persistent_cookie_store_ = persistent_store;
+  BrowserWebCookieJarImpl::InvalidateAll();
 }
 
 const std::string& BrowserRequestContext::GetUserAgent(
@@ -9,12 +9,14 @@
 
 #include <string>
 
+#include "base/memory/ref_counted.h"
 #include "net/http/http_cache.h"
 #include "net/http/url_security_manager.h"
 #include "net/url_request/url_request.h"
 #include "net/url_request/url_request_context.h"
 #include "net/url_request/url_request_context_storage.h"
 
+class BrowserPersistentCookieStore;
 class FilePath;
 
 namespace webkit_blob {
@@ -44,6 +46,11 @@ class BrowserRequestContext : public net::URLRequestContext {
   // will be flushed and closed.
   void SetCookieStoragePath(const FilePath& path);
 
+  // Returns the on-disk cookie store, if any.
+  BrowserPersistentCookieStore* persistent_cookie_store() const {
+    return persistent_cookie_store_.get();
+  }
+
   webkit_blob::BlobStorageController* blob_storage_controller() const {
     return blob_storage_controller_.get();
   }
@@ -57,6 +64,7 @@ class BrowserRequestContext : public net::URLRequestContext {
   scoped_ptr<net::URLSecurityManager> url_security_manager_;
   scoped_ptr<net::URLRequest::Interceptor> url_request_interceptor_;
   FilePath cookie_store_path_;
+  scoped_refptr<BrowserPersistentCookieStore> persistent_cookie_store_;
   bool accept_all_cookies_;
 };
 
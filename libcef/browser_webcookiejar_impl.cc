@@ -5,14 +5,17 @@
 
 #include "libcef/browser_webcookiejar_impl.h"
 
+#include <set>
 #include <string>
 
 #include "libcef/browser_resource_loader_bridge.h"
 #include "libcef/browser_impl.h"
-#include "libcef/cookie_manager_impl.h"
 #include "libcef/cef_context.h"
 #include "libcef/cef_thread.h"
 
+#include "base/atomicops.h"
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
 #include "base/synchronization/waitable_event.h"
 #include "net/base/cookie_store.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebURL.h"
@@ -22,33 +25,69 @@ using WebKit::WebURL;
 
 namespace {
 
-net::CookieStore* GetCookieStore(CefRefPtr<CefBrowserImpl> browser) {
-  scoped_refptr<net::CookieStore> cookie_store;
-  if (browser) {
-     CefRefPtr<CefClient> client = browser->GetClient();
-     if (client.get()) {
-       CefRefPtr<CefRequestHandler> handler = client->GetRequestHandler();
-       if (handler.get()) {
-         // Get the manager from the handler.
-         CefRefPtr<CefCookieManager> manager =
-            handler->GetCookieManager(browser.get(),
-                                      browser->pending_url().spec());
-         if (manager.get()) {
-           cookie_store =
-              reinterpret_cast<CefCookieManagerImpl*>(
-                  manager.get())->cookie_monster();
-         }
-       }
-     }
-  }
+// Snapshots older than this will be refreshed from the cookie monster. Cookie
+// expiration does not generate change notifications until the cookie monster
+// next accesses the cookie.
+const int kSnapshotMaxAgeMs = 1000;
+
+// Maximum number of snapshots kept by each cookie jar.
+const size_t kSnapshotMaxCount = 64;
+
+// Set of all existing cookie jars. Only accessed on the UI thread.
+typedef std::set<BrowserWebCookieJarImpl*> CookieJarSet;
+base::LazyInstance<CookieJarSet> g_cookie_jars = LAZY_INSTANCE_INITIALIZER;
+
+// Domains of cookies that changed since the snapshots were last invalidated.
+// A single UI thread task is pending while the set is non-empty.
+struct ChangedDomains {
+  base::Lock lock;
+  std::set<std::string> domains;
+};
+base::LazyInstance<ChangedDomains> g_changed_domains =
+    LAZY_INSTANCE_INITIALIZER;
 
-  if (!cookie_store) {
-    // Use the global cookie store.
-    cookie_store = _Context->request_context()->cookie_store();
+// Number of cookie changes reported by all cookie monsters.
+base::subtle::Atomic32 g_change_count = 0;
+
+// Returns true if |host| is |domain| or a subdomain of |domain|. |domain| may
+// start with a "." for domain cookies.
+bool HostMatchesDomain(const std::string& host, const std::string& domain) {
+  std::string match_domain =
+      (!domain.empty() && domain[0] == '.') ? domain.substr(1) : domain;
+  if (host == match_domain)
+    return true;
+  return (host.length() > match_domain.length() &&
+          host[host.length() - match_domain.length() - 1] == '.' &&
+          host.compare(host.length() - match_domain.length(),
+                       match_domain.length(), match_domain) == 0);
+}
+
+// Returns |url| without the reference.
+GURL GetSnapshotKey(const GURL& url) {
+  if (!url.is_valid())
+    return url;
+  GURL::Replacements replacements;
+  replacements.ClearRef();
+  return url.ReplaceComponents(replacements);
+}
+
+// Forwards cookie changes from the cookie monster to the UI thread.
+class CookieMonsterDelegate : public net::CookieMonster::Delegate {
+ public:
+  virtual void OnCookieChanged(
+      const net::CookieMonster::CanonicalCookie& cookie,
+      bool removed,
+      ChangeCause cause) OVERRIDE {
+    BrowserWebCookieJarImpl::OnCookieChanged(cookie.Domain());
   }
+};
+
+net::CookieStore* GetCookieStore(CefRefPtr<CefBrowserImpl> browser) {
+  if (browser)
+    return browser->GetCookieStore();
 
-  DCHECK(cookie_store);
-  return cookie_store;
+  // Use the global cookie store.
+  return _Context->request_context()->cookie_store();
 }
 
 class CookieSetter : public base::RefCountedThreadSafe<CookieSetter> {
@@ -106,10 +145,100 @@ class CookieGetter : public base::RefCountedThreadSafe<CookieGetter> {
 
 BrowserWebCookieJarImpl::BrowserWebCookieJarImpl()
   : browser_(NULL) {
+  g_cookie_jars.Pointer()->insert(this);
 }
 
 BrowserWebCookieJarImpl::BrowserWebCookieJarImpl(CefBrowserImpl* browser)
   : browser_(browser) {
+  g_cookie_jars.Pointer()->insert(this);
+}
+
+BrowserWebCookieJarImpl::~BrowserWebCookieJarImpl() {
+  g_cookie_jars.Pointer()->erase(this);
+}
+
+// static
+net::CookieMonster::Delegate*
+    BrowserWebCookieJarImpl::CreateCookieMonsterDelegate() {
+  return new CookieMonsterDelegate();
+}
+
+// static
+void BrowserWebCookieJarImpl::InvalidateAll() {
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    CookieJarSet::const_iterator it = g_cookie_jars.Pointer()->begin();
+    for (; it != g_cookie_jars.Pointer()->end(); ++it)
+      (*it)->snapshots_.clear();
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&BrowserWebCookieJarImpl::InvalidateAll));
+  }
+}
+
+// static
+void BrowserWebCookieJarImpl::InvalidateBrowser(CefBrowserImpl* browser) {
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    CookieJarSet::const_iterator it = g_cookie_jars.Pointer()->begin();
+    for (; it != g_cookie_jars.Pointer()->end(); ++it) {
+      if ((*it)->browser_ == browser)
+        (*it)->snapshots_.clear();
+    }
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&BrowserWebCookieJarImpl::InvalidateBrowser,
+                   base::Unretained(browser)));
+  }
+}
+
+// static
+void BrowserWebCookieJarImpl::OnCookieChanged(const std::string& domain) {
+  base::subtle::Barrier_AtomicIncrement(&g_change_count, 1);
+
+  ChangedDomains* changed = g_changed_domains.Pointer();
+  {
+    base::AutoLock lock_scope(changed->lock);
+    bool pending = !changed->domains.empty();
+    changed->domains.insert(domain);
+    if (pending)
+      return;
+  }
+
+  CefThread::PostTask(CefThread::UI, FROM_HERE,
+      base::Bind(&BrowserWebCookieJarImpl::UIT_InvalidateChangedDomains));
+}
+
+// static
+int BrowserWebCookieJarImpl::GetChangeCount() {
+  return base::subtle::Acquire_Load(&g_change_count);
+}
+
+// static
+void BrowserWebCookieJarImpl::UIT_InvalidateChangedDomains() {
+  REQUIRE_UIT();
+
+  std::set<std::string> domains;
+  {
+    ChangedDomains* changed = g_changed_domains.Pointer();
+    base::AutoLock lock_scope(changed->lock);
+    changed->domains.swap(domains);
+  }
+
+  CookieJarSet::const_iterator it = g_cookie_jars.Pointer()->begin();
+  for (; it != g_cookie_jars.Pointer()->end(); ++it) {
+    SnapshotMap& snapshots = (*it)->snapshots_;
+    SnapshotMap::iterator snapshot = snapshots.begin();
+    while (snapshot != snapshots.end()) {
+      const std::string& host = snapshot->first.url.host();
+      bool matches = false;
+      std::set<std::string>::const_iterator domain = domains.begin();
+      for (; domain != domains.end() && !matches; ++domain)
+        matches = HostMatchesDomain(host, *domain);
+      if (matches)
+        snapshots.erase(snapshot++);
+      else
+        ++snapshot;
+    }
+  }
 }
 
 void BrowserWebCookieJarImpl::setCookie(const WebURL& url,
@@ -118,6 +247,10 @@ void BrowserWebCookieJarImpl::setCookie(const WebURL& url,
   GURL gurl = url;
   std::string cookie = value.utf8();
 
+  // The cookie may apply to any domain that this cookie jar has a snapshot
+  // for. The next read will be proxied to the IO thread after the write.
+  snapshots_.clear();
+
   // Proxy to IO thread to synchronize w/ network loading.
   scoped_refptr<CookieSetter> cookie_setter = new CookieSetter();
   CefThread::PostTask(CefThread::IO, FROM_HERE, base::Bind(
@@ -128,12 +261,36 @@ WebString BrowserWebCookieJarImpl::cookies(
     const WebURL& url,
     const WebURL& first_party_for_cookies) {
   GURL gurl = url;
+  base::TimeTicks now = base::TimeTicks::Now();
+
+  // The cookie manager for a browser is selected based on the main frame URL.
+  SnapshotKey key;
+  if (browser_)
+    key.manager_url = browser_->pending_url();
+  key.url = GetSnapshotKey(gurl);
+  key.first_party_for_cookies = GetSnapshotKey(first_party_for_cookies);
+
+  SnapshotMap::const_iterator it = snapshots_.find(key);
+  if (it != snapshots_.end() &&
+      (now - it->second.time).InMilliseconds() < kSnapshotMaxAgeMs) {
+    return WebString::fromUTF8(it->second.cookie_line);
+  }
 
   // Proxy to IO thread to synchronize w/ network loading.
   scoped_refptr<CookieGetter> cookie_getter = new CookieGetter();
   CefThread::PostTask(CefThread::IO, FROM_HERE, base::Bind(
       &CookieGetter::Get, cookie_getter.get(), browser_, gurl));
 
-  // Blocks until the result is available.
-  return WebString::fromUTF8(cookie_getter->GetResult());
+  // Blocks until the result is available. Change notifications that are sent
+  // while blocked will be processed after the snapshot is stored.
+  std::string cookie_line = cookie_getter->GetResult();
+
+  if (snapshots_.size() >= kSnapshotMaxCount)
+    snapshots_.clear();
+
+  Snapshot& snapshot = snapshots_[key];
+  snapshot.cookie_line = cookie_line;
+  snapshot.time = now;
+
+  return WebString::fromUTF8(cookie_line);
 }
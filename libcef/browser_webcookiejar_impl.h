@@ -7,19 +7,48 @@
 #define CEF_LIBCEF_BROWSER_WEBCOOKIEJAR_IMPL_H_
 #pragma once
 
-#include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebCookieJar.h"
+#include <map>
+#include <string>
 
-namespace net {
-class CookieStore;
-}
+#include "base/basictypes.h"
+#include "base/time.h"
+#include "googleurl/src/gurl.h"
+#include "net/base/cookie_monster.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebCookieJar.h"
 
 class CefBrowserImpl;
 
-// Handles cookie requests from the renderer.
+// Handles cookie requests from the renderer. Cookie reads are served from a
+// UI thread snapshot of the cookie line for each URL. Snapshots are discarded
+// when the cookie monster reports a change to a matching cookie, when this
+// cookie jar writes a cookie, or after a short period of time.
 class BrowserWebCookieJarImpl : public WebKit::WebCookieJar {
  public:
   BrowserWebCookieJarImpl();
   explicit BrowserWebCookieJarImpl(CefBrowserImpl* browser);
+  virtual ~BrowserWebCookieJarImpl();
+
+  // Returns a new delegate that should be passed to every cookie monster used
+  // by the renderer so that cookie changes are reflected in the snapshots.
+  static net::CookieMonster::Delegate* CreateCookieMonsterDelegate();
+
+  // Discard the snapshots of all cookie jars. Call this method when a cookie
+  // monster is replaced. May be called on any thread.
+  static void InvalidateAll();
+
+  // Discard the snapshots of the cookie jar used by |browser|. Call this method
+  // when the cookie manager for |browser| may have changed. May be called on
+  // any thread.
+  static void InvalidateBrowser(CefBrowserImpl* browser);
+
+  // Discard the snapshots for URLs whose host matches |domain|. May be called
+  // on any thread. Changes are batched so that at most one UI thread task is
+  // pending at a time.
+  static void OnCookieChanged(const std::string& domain);
+
+  // Returns a count that is incremented each time a cookie monster reports a
+  // cookie change. May be called on any thread.
+  static int GetChangeCount();
 
   // WebKit::WebCookieJar methods.
   virtual void setCookie(
@@ -29,8 +58,38 @@ class BrowserWebCookieJarImpl : public WebKit::WebCookieJar {
       const WebKit::WebURL& url, const WebKit::WebURL& first_party_for_cookies);
 
  private:
+  // Identifies the cookie manager and request that produced a snapshot. URLs
+  // are stored without the reference.
+  struct SnapshotKey {
+    // Main frame URL used to select the browser's cookie manager. Empty for
+    // the global implementation.
+    GURL manager_url;
+    GURL url;
+    GURL first_party_for_cookies;
+
+    bool operator<(const SnapshotKey& other) const {
+      if (manager_url != other.manager_url)
+        return manager_url < other.manager_url;
+      if (url != other.url)
+        return url < other.url;
+      return first_party_for_cookies < other.first_party_for_cookies;
+    }
+  };
+  struct Snapshot {
+    std::string cookie_line;
+    base::TimeTicks time;
+  };
+  typedef std::map<SnapshotKey, Snapshot> SnapshotMap;
+
+  // Discard the snapshots for URLs whose host matches a changed domain.
+  static void UIT_InvalidateChangedDomains();
+
   // May be NULL for the global implementation.
   CefBrowserImpl* browser_;
+
+  SnapshotMap snapshots_;
+
+  DISALLOW_COPY_AND_ASSIGN(BrowserWebCookieJarImpl);
 };
 
 #endif  // CEF_LIBCEF_BROWSER_WEBCOOKIEJAR_IMPL_H_
@@ -9,9 +9,14 @@
 MSVC_PUSH_WARNING_LEVEL(0);
 #include "ApplicationCacheStorage.h"  // NOLINT(build/include)
 #include "CrossOriginPreflightResultCache.h"  // NOLINT(build/include)
+#include "Document.h"  // NOLINT(build/include)
 #include "DocumentLoader.h"  // NOLINT(build/include)
+#include "Frame.h"  // NOLINT(build/include)
+#include "InspectorInstrumentation.h"  // NOLINT(build/include)
 #include "MemoryCache.h"  // NOLINT(build/include)
+#include "ScriptController.h"  // NOLINT(build/include)
 #include "TextEncoding.h"  // NOLINT(build/include)
+#include "V8RecursionScope.h"  // NOLINT(build/include)
 #include "third_party/WebKit/Source/WebKit/chromium/src/WebFrameImpl.h"
 MSVC_POP_WARNING();
 #undef LOG
@@ -48,6 +53,34 @@ v8::Handle<v8::Context> GetV8Context(WebKit::WebFrame* frame) {
   return WebCore::V8Proxy::context(core_frame);
 }
 
+v8::Local<v8::Value> RunV8Script(WebKit::WebFrame* frame,
+                                 v8::Handle<v8::Script> script,
+                                 const std::string& script_url,
+                                 int start_line) {
+  WebFrameImpl* webFrameImpl = static_cast<WebFrameImpl*>(frame);
+  WebCore::Frame* core_frame = webFrameImpl->frame();
+  if (!core_frame->script()->canExecuteScripts(
+          WebCore::AboutToExecuteScript)) {
+    return v8::Local<v8::Value>();
+  }
+
+  // Keep the Frame alive while the script executes.
+  RefPtr<WebCore::Frame> protect(core_frame);
+
+  WebCore::InspectorInstrumentationCookie cookie =
+      WebCore::InspectorInstrumentation::willEvaluateScript(
+          core_frame, WTF::String::fromUTF8(script_url.c_str()), start_line);
+
+  v8::Local<v8::Value> result;
+  {
+    WebCore::V8RecursionScope recursion_scope(core_frame->document());
+    result = script->Run();
+  }
+
+  WebCore::InspectorInstrumentation::didEvaluateScript(cookie);
+  return result;
+}
+
 void ClearCache() {
   if (WebCore::memoryCache()->disabled())
     return;
@@ -43,6 +43,17 @@ void InitializeTextEncoding();
 // Retrieve the V8 context associated with the frame.
 v8::Handle<v8::Context> GetV8Context(WebKit::WebFrame* frame);
 
+// Run a script compiled in the main world context of |frame| the same way that
+// WebFrame::executeScript() does: the frame is kept alive, the inspector is
+// notified and the recursion depth is tracked so that mutation observers are
+// delivered when the outermost script completes. Exceptions are left for the
+// caller's TryCatch, if any. Returns an empty handle if script execution is
+// disabled for the frame.
+v8::Local<v8::Value> RunV8Script(WebKit::WebFrame* frame,
+                                 v8::Handle<v8::Script> script,
+                                 const std::string& script_url,
+                                 int start_line);
+
 // Clear all cached data.
 void ClearCache();
 
@@ -885,6 +885,9 @@ void BrowserWebViewDelegate::didCommitProvisionalLoad(
 
 void BrowserWebViewDelegate::didCreateScriptContext(
     WebFrame* frame, v8::Handle<v8::Context> context, int worldId) {
+  // Begin tracking native objects for the context.
+  CefV8ContextCreated(context);
+
   CefRefPtr<CefClient> client = browser_->GetClient();
   if (!client.get())
     return;
@@ -905,20 +908,23 @@ void BrowserWebViewDelegate::didCreateScriptContext(
 void BrowserWebViewDelegate::willReleaseScriptContext(
     WebFrame* frame, v8::Handle<v8::Context> context, int worldId) {
   CefRefPtr<CefClient> client = browser_->GetClient();
-  if (!client.get())
-    return;
+  CefRefPtr<CefV8ContextHandler> handler;
+  if (client.get())
+    handler = client->GetV8ContextHandler();
 
-  CefRefPtr<CefV8ContextHandler> handler = client->GetV8ContextHandler();
-  if (!handler.get())
-    return;
+  if (handler.get()) {
+    v8::HandleScope handle_scope;
+    v8::Context::Scope scope(context);
 
-  v8::HandleScope handle_scope;
-  v8::Context::Scope scope(context);
+    CefRefPtr<CefFrame> framePtr(browser_->UIT_GetCefFrame(frame));
+    CefRefPtr<CefV8Context> contextPtr(new CefV8ContextImpl(context));
 
-  CefRefPtr<CefFrame> framePtr(browser_->UIT_GetCefFrame(frame));
-  CefRefPtr<CefV8Context> contextPtr(new CefV8ContextImpl(context));
+    handler->OnContextReleased(browser_, framePtr, contextPtr);
+  }
 
-  handler->OnContextReleased(browser_, framePtr, contextPtr);
+  // Release all native objects tracked for the context, including objects
+  // that have not yet been garbage collected.
+  CefV8ContextReleased(context);
 }
 
 void BrowserWebViewDelegate::didReceiveTitle(
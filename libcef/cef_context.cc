@@ -64,6 +64,15 @@ base::StringPiece GetRawDataResource(HMODULE module, int resource_id) {
 
 #endif  // defined(OS_MACOSX)
 
+// Begin loading the script cache from disk. This is posted from Initialize()
+// because the FILE thread does not exist yet when the UI thread is initialized.
+void UIT_LoadScriptCache() {
+  REQUIRE_UIT();
+  CefV8ScriptCache* script_cache = _Context->script_cache();
+  if (script_cache)
+    script_cache->LoadEntries();
+}
+
 }  // namespace
 
 bool CefInitialize(const CefSettings& settings, CefRefPtr<CefApp> application) {
@@ -183,6 +192,10 @@ bool CefContext::Initialize(const CefSettings& settings,
 
   initialized_ = true;
 
+  // Load the script cache before the first browser executes script.
+  CefThread::PostTask(CefThread::UI, FROM_HERE,
+                      base::Bind(&UIT_LoadScriptCache));
+
   // Perform DevTools scheme registration when CEF initialization is complete.
   CefThread::PostTask(CefThread::UI, FROM_HERE,
                       base::Bind(&RegisterDevToolsSchemeHandler, true));
@@ -225,6 +238,8 @@ void CefContext::Shutdown() {
 }
 
 bool CefContext::AddBrowser(CefRefPtr<CefBrowserImpl> browser) {
+  REQUIRE_UIT();
+
   bool found = false;
 
   AutoLock lock_scope(this);
@@ -239,14 +254,18 @@ bool CefContext::AddBrowser(CefRefPtr<CefBrowserImpl> browser) {
   }
 
   if (!found) {
-    browser->UIT_SetUniqueID(next_browser_id_++);
+    int id = next_browser_id_++;
+    browser->UIT_SetUniqueID(id);
     browserlist_.push_back(browser);
+    browser_id_map_[id] = browser.get();
   }
 
   return !found;
 }
 
 bool CefContext::RemoveBrowser(CefRefPtr<CefBrowserImpl> browser) {
+  REQUIRE_UIT();
+
   bool deleted = false;
   bool empty = false;
 
@@ -262,6 +281,21 @@ bool CefContext::RemoveBrowser(CefRefPtr<CefBrowserImpl> browser) {
       }
     }
 
+    if (deleted) {
+      BrowserIdMap::iterator id_it =
+          browser_id_map_.find(browser->UIT_GetUniqueID());
+      if (id_it != browser_id_map_.end() && id_it->second == browser.get())
+        browser_id_map_.erase(id_it);
+
+      BrowserFrameMap::iterator frame_it = browser_frame_map_.begin();
+      while (frame_it != browser_frame_map_.end()) {
+        if (frame_it->second == browser.get())
+          browser_frame_map_.erase(frame_it++);
+        else
+          ++frame_it;
+      }
+    }
+
     if (browserlist_.empty()) {
       next_browser_id_ = kNextBrowserIdReset;
       empty = true;
@@ -281,17 +315,48 @@ bool CefContext::RemoveBrowser(CefRefPtr<CefBrowserImpl> browser) {
 }
 
 CefRefPtr<CefBrowserImpl> CefContext::GetBrowserByID(int id) {
+  // The index is only modified on the UI thread so lookups on that thread do
+  // not need to acquire the lock.
+  if (CefThread::CurrentlyOn(CefThread::UI))
+    return FindBrowserByID(id);
+
   AutoLock lock_scope(this);
+  return FindBrowserByID(id);
+}
 
-  BrowserList::const_iterator it = browserlist_.begin();
-  for (; it != browserlist_.end(); ++it) {
-    if (it->get()->UIT_GetUniqueID() == id)
-      return it->get();
+CefRefPtr<CefBrowserImpl> CefContext::UIT_GetBrowserByMainFrame(
+    WebKit::WebFrame* frame) {
+  REQUIRE_UIT();
+
+  if (!frame)
+    return NULL;
+
+  BrowserFrameMap::const_iterator it = browser_frame_map_.find(frame);
+  if (it != browser_frame_map_.end())
+    return it->second;
+
+  // The main frame does not exist when the browser is added so the index is
+  // populated on first lookup. The main frame does not change for the life of
+  // the browser.
+  BrowserList::const_iterator list_it = browserlist_.begin();
+  for (; list_it != browserlist_.end(); ++list_it) {
+    if (list_it->get()->UIT_GetMainWebFrame() == frame) {
+      AutoLock lock_scope(this);
+      browser_frame_map_[frame] = list_it->get();
+      return list_it->get();
+    }
   }
 
   return NULL;
 }
 
+CefBrowserImpl* CefContext::FindBrowserByID(int id) const {
+  BrowserIdMap::const_iterator it = browser_id_map_.find(id);
+  if (it != browser_id_map_.end())
+    return it->second;
+  return NULL;
+}
+
 void CefContext::InitializeResourceBundle() {
   if (settings_.pack_loading_disabled)
     return;
@@ -472,6 +537,8 @@ void CefContext::UIT_FinishShutdown(
     if (!browserlist_.empty()) {
       list = browserlist_;
       browserlist_.clear();
+      browser_id_map_.clear();
+      browser_frame_map_.clear();
     }
   }
 
@@ -482,6 +549,10 @@ void CefContext::UIT_FinishShutdown(
       (*it)->UIT_DestroyBrowser();
   }
 
+  // Write pending localStorage changes while the FILE thread is still running.
+  if (storage_context_.get())
+    storage_context_->Shutdown();
+
   if (uithread_shutdown_event) {
     // The destruction observer will signal the UI thread shutdown event when
     // the UI thread has been destroyed.
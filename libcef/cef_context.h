@@ -16,6 +16,7 @@
 #include "libcef/browser_request_context.h"
 #include "libcef/cef_process.h"
 #include "libcef/dom_storage_context.h"
+#include "libcef/v8_script_cache.h"
 
 #include "base/at_exit.h"
 #include "base/file_path.h"
@@ -24,6 +25,10 @@
 class CefBrowserImpl;
 class WebViewHost;
 
+namespace WebKit {
+class WebFrame;
+}
+
 namespace base {
 class WaitableEvent;
 }
@@ -47,11 +52,17 @@ class CefContext : public CefBase {
 
   CefProcess* process() { return process_.get(); }
 
+  // Browsers are added and removed on the UI thread. Lookups on the UI thread
+  // use the browser indexes without acquiring the context lock.
   bool AddBrowser(CefRefPtr<CefBrowserImpl> browser);
   bool RemoveBrowser(CefRefPtr<CefBrowserImpl> browser);
   CefRefPtr<CefBrowserImpl> GetBrowserByID(int id);
   BrowserList* GetBrowserList() { return &browserlist_; }
 
+  // Returns the browser whose main frame is |frame|. Must be called on the UI
+  // thread.
+  CefRefPtr<CefBrowserImpl> UIT_GetBrowserByMainFrame(WebKit::WebFrame* frame);
+
   void InitializeResourceBundle();
   void CleanupResourceBundle();
 
@@ -84,6 +95,12 @@ class CefContext : public CefBase {
   }
   DOMStorageContext* storage_context() { return storage_context_.get(); }
 
+  // The CefV8ScriptCache object is managed by CefProcessUIThread.
+  void set_script_cache(CefV8ScriptCache* script_cache) {
+    script_cache_.reset(script_cache);
+  }
+  CefV8ScriptCache* script_cache() { return script_cache_.get(); }
+
   BrowserFileSystem* file_system() { return &file_system_; }
 
   // Used to keep track of the web view host we're dragging over. WARNING:
@@ -97,6 +114,9 @@ class CefContext : public CefBase {
   static bool ImplementsThreadSafeReferenceCounting() { return true; }
 
  private:
+  // Returns the browser with the specified unique ID from the index.
+  CefBrowserImpl* FindBrowserByID(int id) const;
+
   // Performs shutdown actions that need to occur on the UI thread before any
   // threads are destroyed.
   void UIT_FinishShutdown(base::WaitableEvent* browser_shutdown_event,
@@ -118,11 +138,19 @@ class CefContext : public CefBase {
   FilePath cache_path_;
   scoped_refptr<BrowserRequestContext> request_context_;
   scoped_ptr<DOMStorageContext> storage_context_;
+  scoped_ptr<CefV8ScriptCache> script_cache_;
   BrowserFileSystem file_system_;
 
-  // Map of browsers that currently exist.
+  // List of browsers that currently exist.
   BrowserList browserlist_;
 
+  // Indexes of the browsers in |browserlist_|. Only modified on the UI thread
+  // while holding the context lock.
+  typedef std::map<int, CefBrowserImpl*> BrowserIdMap;
+  BrowserIdMap browser_id_map_;
+  typedef std::map<WebKit::WebFrame*, CefBrowserImpl*> BrowserFrameMap;
+  BrowserFrameMap browser_frame_map_;
+
   // Used for assigning unique IDs to browser instances.
   int next_browser_id_;
 
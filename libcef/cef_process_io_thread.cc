@@ -8,6 +8,7 @@
 #include "libcef/cef_context.h"
 #include "libcef/browser_appcache_system.h"
 #include "libcef/browser_file_writer.h"
+#include "libcef/browser_persistent_cookie_store.h"
 #include "libcef/browser_resource_loader_bridge.h"
 #include "libcef/browser_socket_stream_bridge.h"
 #include "libcef/browser_webblobregistry_impl.h"
@@ -35,6 +36,21 @@ CefProcessIOThread::~CefProcessIOThread() {
 void CefProcessIOThread::Init() {
   CefThread::Init();
 
+  // Set cookie database commit policy.
+  const CefSettings& settings = _Context->settings();
+  if (settings.cookie_commit_interval != 0) {
+    BrowserPersistentCookieStore::set_commit_interval(
+        settings.cookie_commit_interval);
+  }
+  if (settings.cookie_commit_batch_size != 0) {
+    BrowserPersistentCookieStore::set_commit_batch_size(
+        settings.cookie_commit_batch_size);
+  }
+  BrowserPersistentCookieStore::set_journal_mode(settings.cookie_journal_mode);
+  BrowserPersistentCookieStore::set_synchronous(settings.cookie_synchronous);
+  BrowserPersistentCookieStore::set_background_load_delay(
+      settings.cookie_background_load_delay);
+
   FilePath cache_path(_Context->cache_path());
   request_context_ = new BrowserRequestContext(cache_path,
       net::HttpCache::NORMAL, false);
@@ -140,10 +140,18 @@ void CefProcessUIThread::Init() {
     DOMStorageContext::set_session_storage_quota(
         settings.session_storage_quota);
   }
+  DOMStorageContext::set_use_local_storage_database(
+      settings.consolidated_local_storage);
+  DOMStorageContext::set_local_storage_memory_limit(
+      settings.local_storage_memory_limit);
 
   // Create the storage context object.
   _Context->set_storage_context(new DOMStorageContext(_Context->cache_path()));
 
+  // Create the script cache object.
+  _Context->set_script_cache(new CefV8ScriptCache(
+      settings.persistent_script_cache ? _Context->cache_path() : FilePath()));
+
   if (settings.user_agent.length > 0) {
     webkit_glue::SetUserAgent(CefString(&settings.user_agent), false);
   } else {
@@ -195,6 +203,9 @@ void CefProcessUIThread::CleanUp() {
   // Destroy the storage context object.
   _Context->set_storage_context(NULL);
 
+  // Destroy the script cache object.
+  _Context->set_script_cache(NULL);
+
   // Tear down the shared StatsTable.
   base::StatsTable::set_current(NULL);
   delete statstable_;
@@ -4,18 +4,293 @@
 
 #include "libcef/cookie_manager_impl.h"
 
+#include <algorithm>
 #include <string>
 
 #include "libcef/browser_persistent_cookie_store.h"
+#include "libcef/browser_webcookiejar_impl.h"
 #include "libcef/cef_context.h"
 #include "libcef/cef_thread.h"
 #include "libcef/cef_time_util.h"
 
 #include "base/bind.h"
 #include "base/logging.h"
+#include "base/string_number_conversions.h"
+#include "base/string_split.h"
 
 namespace {
 
+// Serialized cookie data starts with this line. Each following line describes
+// one cookie using tab-separated fields.
+const char kExportHeader[] = "CEFCOOKIES 1";
+
+enum ExportField {
+  EXPORT_FIELD_DOMAIN = 0,
+  EXPORT_FIELD_PATH,
+  EXPORT_FIELD_NAME,
+  EXPORT_FIELD_VALUE,
+  EXPORT_FIELD_EXPIRES,
+  EXPORT_FIELD_FLAGS,
+  EXPORT_FIELD_COUNT
+};
+
+enum ExportFlags {
+  EXPORT_FLAG_SECURE = 1 << 0,
+  EXPORT_FLAG_HTTPONLY = 1 << 1
+};
+
+// Escape the characters used as field and line separators.
+std::string EscapeField(const std::string& str) {
+  std::string result;
+  result.reserve(str.size());
+  for (size_t i = 0; i < str.size(); ++i) {
+    switch (str[i]) {
+      case '%':  result.append("%25"); break;
+      case '\t': result.append("%09"); break;
+      case '\n': result.append("%0A"); break;
+      case '\r': result.append("%0D"); break;
+      default:   result.push_back(str[i]); break;
+    }
+  }
+  return result;
+}
+
+bool UnescapeField(const std::string& str, std::string* result) {
+  result->clear();
+  result->reserve(str.size());
+  for (size_t i = 0; i < str.size(); ++i) {
+    if (str[i] != '%') {
+      result->push_back(str[i]);
+      continue;
+    }
+    if (i + 2 >= str.size())
+      return false;
+    std::string code = str.substr(i + 1, 2);
+    if (code == "25")
+      result->push_back('%');
+    else if (code == "09")
+      result->push_back('\t');
+    else if (code == "0A")
+      result->push_back('\n');
+    else if (code == "0D")
+      result->push_back('\r');
+    else
+      return false;
+    i += 2;
+  }
+  return true;
+}
+
+// Parse a single line of exported cookie data.
+bool ParseExportedCookie(const std::string& line,
+                         CefCookieManagerImpl::ImportedCookie* cookie) {
+  std::vector<std::string> fields;
+  base::SplitStringDontTrim(line, '\t', &fields);
+  if (fields.size() != EXPORT_FIELD_COUNT)
+    return false;
+
+  if (!UnescapeField(fields[EXPORT_FIELD_DOMAIN], &cookie->domain) ||
+      !UnescapeField(fields[EXPORT_FIELD_PATH], &cookie->path) ||
+      !UnescapeField(fields[EXPORT_FIELD_NAME], &cookie->name) ||
+      !UnescapeField(fields[EXPORT_FIELD_VALUE], &cookie->value)) {
+    return false;
+  }
+
+  int64 expires;
+  int flags;
+  if (!base::StringToInt64(fields[EXPORT_FIELD_EXPIRES], &expires) ||
+      !base::StringToInt(fields[EXPORT_FIELD_FLAGS], &flags)) {
+    return false;
+  }
+
+  cookie->expiration_time = base::Time::FromInternalValue(expires);
+  cookie->secure = (flags & EXPORT_FLAG_SECURE) != 0;
+  cookie->httponly = (flags & EXPORT_FLAG_HTTPONLY) != 0;
+
+  // Domain cookies start with a "." and host cookies do not.
+  bool domain_cookie = (!cookie->domain.empty() && cookie->domain[0] == '.');
+  std::string host =
+      domain_cookie ? cookie->domain.substr(1) : cookie->domain;
+  cookie->url = GURL((cookie->secure ? "https://" : "http://") + host +
+                     cookie->path);
+  if (!cookie->url.is_valid())
+    return false;
+
+  // An empty domain results in a host cookie.
+  if (!domain_cookie)
+    cookie->domain.clear();
+
+  return true;
+}
+
+// Callback class for exporting cookies.
+class ExportCookiesCallback : public base::RefCounted<ExportCookiesCallback> {
+ public:
+  explicit ExportCookiesCallback(CefRefPtr<CefCookieExportHandler> handler)
+    : handler_(handler) {
+  }
+
+  void Run(const net::CookieList& list) {
+    REQUIRE_IOT();
+
+    std::string data(kExportHeader);
+    data.push_back('\n');
+
+    net::CookieList::const_iterator it = list.begin();
+    for (; it != list.end(); ++it) {
+      const net::CookieMonster::CanonicalCookie& cc = *(it);
+
+      int flags = 0;
+      if (cc.IsSecure())
+        flags |= EXPORT_FLAG_SECURE;
+      if (cc.IsHttpOnly())
+        flags |= EXPORT_FLAG_HTTPONLY;
+
+      data.append(EscapeField(cc.Domain()));
+      data.push_back('\t');
+      data.append(EscapeField(cc.Path()));
+      data.push_back('\t');
+      data.append(EscapeField(cc.Name()));
+      data.push_back('\t');
+      data.append(EscapeField(cc.Value()));
+      data.push_back('\t');
+      data.append(base::Int64ToString(
+          cc.DoesExpire() ? cc.ExpiryDate().ToInternalValue() : 0));
+      data.push_back('\t');
+      data.append(base::IntToString(flags));
+      data.push_back('\n');
+    }
+
+    handler_->OnCookiesExported(data, static_cast<int>(list.size()));
+  }
+
+ private:
+  CefRefPtr<CefCookieExportHandler> handler_;
+};
+
+// Populate |cookie| from |cc|.
+void CanonicalCookieToCefCookie(const net::CookieMonster::CanonicalCookie& cc,
+                                CefCookie& cookie) {
+  CefString(&cookie.name).FromString(cc.Name());
+  CefString(&cookie.value).FromString(cc.Value());
+  CefString(&cookie.domain).FromString(cc.Domain());
+  CefString(&cookie.path).FromString(cc.Path());
+  cookie.secure = cc.IsSecure();
+  cookie.httponly = cc.IsHttpOnly();
+  cef_time_from_basetime(cc.CreationDate(), cookie.creation);
+  cef_time_from_basetime(cc.LastAccessDate(), cookie.last_access);
+  cookie.has_expires = cc.DoesExpire();
+  if (cookie.has_expires)
+    cef_time_from_basetime(cc.ExpiryDate(), cookie.expires);
+}
+
+// Returns true if the cookie domain |cookie_domain| is |domain| or a subdomain
+// of |domain|.
+bool CookieDomainMatches(const std::string& cookie_domain,
+                         const std::string& domain) {
+  std::string host = (!cookie_domain.empty() && cookie_domain[0] == '.') ?
+      cookie_domain.substr(1) : cookie_domain;
+  if (host == domain)
+    return true;
+  return (host.length() > domain.length() &&
+          host[host.length() - domain.length() - 1] == '.' &&
+          host.compare(host.length() - domain.length(), domain.length(),
+                       domain) == 0);
+}
+
+// Position of a cookie in the paged visitation order. Cookies are ordered by
+// domain, name, path and creation date so that a visit can be resumed after
+// other cookies have been added or removed.
+struct CookiePageCursor {
+  std::string domain;
+  std::string name;
+  std::string path;
+  int64 creation;
+};
+
+// Returns a negative value, zero or a positive value if |cc| is ordered before,
+// at or after the specified position.
+int CompareCookiePosition(const net::CookieMonster::CanonicalCookie& cc,
+                          const std::string& domain,
+                          const std::string& name,
+                          const std::string& path,
+                          int64 creation) {
+  int result = cc.Domain().compare(domain);
+  if (result == 0)
+    result = cc.Name().compare(name);
+  if (result == 0)
+    result = cc.Path().compare(path);
+  if (result == 0) {
+    int64 cc_creation = cc.CreationDate().ToInternalValue();
+    if (cc_creation != creation)
+      result = (cc_creation < creation) ? -1 : 1;
+  }
+  return result;
+}
+
+bool CookiePageLess(const net::CookieMonster::CanonicalCookie* a,
+                    const net::CookieMonster::CanonicalCookie* b) {
+  return CompareCookiePosition(*a, b->Domain(), b->Name(), b->Path(),
+                               b->CreationDate().ToInternalValue()) < 0;
+}
+
+bool CookiePageCursorLess(const CookiePageCursor& cursor,
+                          const net::CookieMonster::CanonicalCookie& cc) {
+  return CompareCookiePosition(cc, cursor.domain, cursor.name, cursor.path,
+                               cursor.creation) > 0;
+}
+
+// Returns the cursor that identifies the position of |cc|. The fields are
+// escaped and tab-separated as with exported cookie data.
+std::string GetCookiePageCursor(
+    const net::CookieMonster::CanonicalCookie& cc) {
+  std::string cursor;
+  cursor.append(EscapeField(cc.Domain()));
+  cursor.push_back('\t');
+  cursor.append(EscapeField(cc.Name()));
+  cursor.push_back('\t');
+  cursor.append(EscapeField(cc.Path()));
+  cursor.push_back('\t');
+  cursor.append(base::Int64ToString(cc.CreationDate().ToInternalValue()));
+  return cursor;
+}
+
+bool ParseCookiePageCursor(const std::string& str, CookiePageCursor* cursor) {
+  std::vector<std::string> fields;
+  base::SplitStringDontTrim(str, '\t', &fields);
+  return (fields.size() == 4 &&
+          UnescapeField(fields[0], &cursor->domain) &&
+          UnescapeField(fields[1], &cursor->name) &&
+          UnescapeField(fields[2], &cursor->path) &&
+          base::StringToInt64(fields[3], &cursor->creation));
+}
+
+// Implementation of the CefCookiePage interface. The cookies are only
+// converted when requested.
+class CefCookiePageImpl : public CefCookiePage {
+ public:
+  CefCookiePageImpl(net::CookieList::const_iterator begin,
+                    net::CookieList::const_iterator end)
+    : cookies_(begin, end) {
+  }
+
+  virtual int GetCount() OVERRIDE {
+    return static_cast<int>(cookies_.size());
+  }
+
+  virtual bool GetCookie(int index, CefCookie& cookie) OVERRIDE {
+    if (index < 0 || index >= static_cast<int>(cookies_.size()))
+      return false;
+    CanonicalCookieToCefCookie(cookies_[index], cookie);
+    return true;
+  }
+
+ private:
+  const net::CookieList cookies_;
+
+  IMPLEMENT_REFCOUNTING(CefCookiePageImpl);
+};
+
 // Callback class for visiting cookies.
 class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
  public:
@@ -34,18 +309,7 @@ class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
     for (; it != list.end(); ++it, ++count) {
       CefCookie cookie;
       const net::CookieMonster::CanonicalCookie& cc = *(it);
-
-      CefString(&cookie.name).FromString(cc.Name());
-      CefString(&cookie.value).FromString(cc.Value());
-      CefString(&cookie.domain).FromString(cc.Domain());
-      CefString(&cookie.path).FromString(cc.Path());
-      cookie.secure = cc.IsSecure();
-      cookie.httponly = cc.IsHttpOnly();
-      cef_time_from_basetime(cc.CreationDate(), cookie.creation);
-      cef_time_from_basetime(cc.LastAccessDate(), cookie.last_access);
-      cookie.has_expires = cc.DoesExpire();
-      if (cookie.has_expires)
-        cef_time_from_basetime(cc.ExpiryDate(), cookie.expires);
+      CanonicalCookieToCefCookie(cc, cookie);
 
       bool deleteCookie = false;
       bool keepLooping = visitor_->Visit(cookie, count, total, deleteCookie);
@@ -66,9 +330,129 @@ class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
 }  // namespace
 
 
-CefCookieManagerImpl::CefCookieManagerImpl(bool is_global)
-  : is_global_(is_global) {
+// Cookies that match the filters of a paged visit, in visitation order. A
+// snapshot is reused to resume the visit at a cursor until any cookie changes
+// or expires.
+class CookiePageSnapshot : public base::RefCounted<CookiePageSnapshot> {
+ public:
+  CookiePageSnapshot(const std::string& domain,
+                     const std::string& name,
+                     const net::CookieList& list)
+    : domain_(domain),
+      name_(name),
+      change_count_(BrowserWebCookieJarImpl::GetChangeCount()) {
+    // Filter and order the cookies before any are copied.
+    typedef std::vector<const net::CookieMonster::CanonicalCookie*> MatchList;
+    MatchList matches;
+    net::CookieList::const_iterator it = list.begin();
+    for (; it != list.end(); ++it) {
+      if (!domain_.empty() && !CookieDomainMatches(it->Domain(), domain_))
+        continue;
+      if (!name_.empty() && it->Name() != name_)
+        continue;
+      matches.push_back(&(*it));
+      if (it->DoesExpire() &&
+          (expiry_.is_null() || it->ExpiryDate() < expiry_)) {
+        expiry_ = it->ExpiryDate();
+      }
+    }
+    std::sort(matches.begin(), matches.end(), CookiePageLess);
+
+    cookies_.reserve(matches.size());
+    MatchList::const_iterator match = matches.begin();
+    for (; match != matches.end(); ++match)
+      cookies_.push_back(**match);
+  }
+
+  // Returns true if the snapshot can be used for a visit with the specified
+  // filters.
+  bool IsValid(const std::string& domain, const std::string& name) const {
+    return (domain == domain_ && name == name_ &&
+            change_count_ == BrowserWebCookieJarImpl::GetChangeCount() &&
+            (expiry_.is_null() || base::Time::Now() < expiry_));
+  }
+
+  const net::CookieList& cookies() const { return cookies_; }
+
+ private:
+  std::string domain_;
+  std::string name_;
+  int change_count_;
+  // Earliest expiration time of the cookies, if any expire.
+  base::Time expiry_;
+  net::CookieList cookies_;
+};
+
+namespace {
+
+// Visits pages of cookies from a snapshot.
+class VisitCookiePagesCallback
+    : public base::RefCounted<VisitCookiePagesCallback> {
+ public:
+  VisitCookiePagesCallback(CookiePageSnapshot* snapshot,
+                           int page_size,
+                           CefRefPtr<CefCookiePageVisitor> visitor)
+    : snapshot_(snapshot),
+      page_size_(page_size),
+      visitor_(visitor) {
+  }
+
+  // If |cursor| is NULL the visit starts at the first cookie.
+  void Run(const CookiePageCursor* cursor) {
+    REQUIRE_IOT();
+
+    const net::CookieList& cookies = snapshot_->cookies();
+    size_t index = 0;
+    if (cursor) {
+      index = std::upper_bound(cookies.begin(), cookies.end(), *cursor,
+                               CookiePageCursorLess) - cookies.begin();
+    }
+    VisitPage(index);
+  }
+
+  void VisitPage(size_t index) {
+    REQUIRE_IOT();
+
+    const net::CookieList& cookies = snapshot_->cookies();
+    size_t remaining = cookies.size() - index;
+    size_t end = (static_cast<size_t>(page_size_) >= remaining) ?
+        cookies.size() : index + page_size_;
+
+    CefRefPtr<CefCookiePage> page(
+        new CefCookiePageImpl(cookies.begin() + index, cookies.begin() + end));
+
+    // The last page has an empty cursor.
+    std::string next_cursor;
+    if (end < cookies.size())
+      next_cursor = GetCookiePageCursor(cookies[end - 1]);
+
+    if (!visitor_->Visit(page, next_cursor,
+                         static_cast<int>(cookies.size())) ||
+        next_cursor.empty()) {
+      return;
+    }
+
+    // Deliver the next page in a separate task so that other IO thread tasks
+    // can run in between.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(&VisitCookiePagesCallback::VisitPage, this, end));
+  }
+
+ private:
+  scoped_refptr<CookiePageSnapshot> snapshot_;
+  int page_size_;
+  CefRefPtr<CefCookiePageVisitor> visitor_;
+};
+
+}  // namespace
+
+
+CefCookieManagerImpl::CefCookieManagerImpl(bool is_global,
+                                           const std::string& partition)
+  : is_global_(is_global),
+    partition_(partition) {
   if (is_global) {
+    DCHECK(partition.empty());
     cookie_monster_ =
         static_cast<net::CookieMonster*>(
             _Context->request_context()->cookie_store());
@@ -121,6 +505,70 @@ bool CefCookieManagerImpl::VisitUrlCookies(
   return true;
 }
 
+bool CefCookieManagerImpl::VisitCookiePages(
+    const CefString& domain,
+    const CefString& name,
+    int page_size,
+    const CefString& cursor,
+    CefRefPtr<CefCookiePageVisitor> visitor) {
+  if (page_size <= 0)
+    return false;
+
+  CookiePageCursor page_cursor;
+  if (!cursor.empty() && !ParseCookiePageCursor(cursor, &page_cursor))
+    return false;
+
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    std::string domain_str = domain;
+    std::string name_str = name;
+    if (page_snapshot_.get() && page_snapshot_->IsValid(domain_str, name_str)) {
+      // Resume from the existing snapshot without copying the cookies again.
+      VisitCookiePageSnapshot(page_snapshot_, page_size, cursor, visitor);
+    } else {
+      cookie_monster_->GetAllCookiesAsync(
+          base::Bind(&CefCookieManagerImpl::SetCookiePageSnapshot, this,
+                     domain_str, name_str, page_size, cursor, visitor));
+    }
+  } else {
+    // Execute on the IO thread.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::VisitCookiePages),
+                   this, domain, name, page_size, cursor, visitor));
+  }
+
+  return true;
+}
+
+void CefCookieManagerImpl::SetCookiePageSnapshot(
+    const std::string& domain,
+    const std::string& name,
+    int page_size,
+    const CefString& cursor,
+    CefRefPtr<CefCookiePageVisitor> visitor,
+    const net::CookieList& list) {
+  REQUIRE_IOT();
+
+  page_snapshot_ = new CookiePageSnapshot(domain, name, list);
+  VisitCookiePageSnapshot(page_snapshot_, page_size, cursor, visitor);
+}
+
+void CefCookieManagerImpl::VisitCookiePageSnapshot(
+    CookiePageSnapshot* snapshot,
+    int page_size,
+    const CefString& cursor,
+    CefRefPtr<CefCookiePageVisitor> visitor) {
+  REQUIRE_IOT();
+
+  // The cursor was validated by VisitCookiePages().
+  CookiePageCursor page_cursor;
+  bool has_cursor =
+      !cursor.empty() && ParseCookiePageCursor(cursor, &page_cursor);
+
+  scoped_refptr<VisitCookiePagesCallback> callback(
+      new VisitCookiePagesCallback(snapshot, page_size, visitor));
+  callback->Run(has_cursor ? &page_cursor : NULL);
+}
+
 bool CefCookieManagerImpl::SetCookie(const CefString& url,
                                      const CefCookie& cookie) {
   // Verify that this function is being called on the IO thread.
@@ -166,14 +614,7 @@ bool CefCookieManagerImpl::DeleteCookies(const CefString& url,
   if (!gurl.is_valid())
     return false;
 
-  if (cookie_name.empty()) {
-    // Delete all matching host cookies.
-    cookie_monster_->DeleteAllForHostAsync(gurl,
-        net::CookieMonster::DeleteCallback());
-  } else {
-    // Delete all matching host and domain cookies.
-    cookie_monster_->DeleteCookieAsync(gurl, cookie_name, base::Closure());
-  }
+  DeleteCookiesInternal(gurl, cookie_name);
   return true;
 }
 
@@ -183,6 +624,9 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
     if (!path.empty())
       new_path = FilePath(path);
 
+    // Snapshots taken from a replaced cookie monster must not be reused.
+    page_snapshot_ = NULL;
+
     if (is_global_) {
       // Global path changes are handled by the request context.
       _Context->request_context()->SetCookieStoragePath(new_path);
@@ -202,7 +646,8 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
     if (!new_path.empty()) {
       if (file_util::CreateDirectory(new_path)) {
         const FilePath& cookie_path = new_path.AppendASCII("Cookies");
-        persistent_store = new BrowserPersistentCookieStore(cookie_path, false);
+        persistent_store =
+            new BrowserPersistentCookieStore(cookie_path, partition_, false);
       } else {
         NOTREACHED() << "The cookie storage directory could not be created";
         storage_path_.clear();
@@ -212,8 +657,11 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
     // Set the new cookie store that will be used for all new requests. The old
     // cookie store, if any, will be automatically flushed and closed when no
     // longer referenced.
-    cookie_monster_ = new net::CookieMonster(persistent_store.get(), NULL);
+    cookie_monster_ = new net::CookieMonster(persistent_store.get(),
+        BrowserWebCookieJarImpl::CreateCookieMonsterDelegate());
     storage_path_ = new_path;
+    persistent_store_ = persistent_store;
+    BrowserWebCookieJarImpl::InvalidateAll();
   } else {
     // Execute on the IO thread.
     CefThread::PostTask(CefThread::IO, FROM_HERE,
@@ -224,6 +672,164 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
   return true;
 }
 
+bool CefCookieManagerImpl::GetLoadMetrics(CefCookieLoadMetrics& metrics) {
+  // Verify that this function is being called on the IO thread.
+  if (!CefThread::CurrentlyOn(CefThread::IO)) {
+    NOTREACHED() << "called on invalid thread";
+    return false;
+  }
+
+  BrowserPersistentCookieStore* store = is_global_ ?
+      _Context->request_context()->persistent_cookie_store() :
+      persistent_store_.get();
+  if (!store)
+    return false;
+
+  BrowserPersistentCookieStore::LoadMetrics load_metrics;
+  store->GetLoadMetrics(&load_metrics);
+
+  metrics.load_complete = load_metrics.load_complete;
+  metrics.database_open_time =
+      load_metrics.database_open_time.InMilliseconds();
+  metrics.total_load_time = load_metrics.total_load_time.InMilliseconds();
+  metrics.priority_key_count = load_metrics.priority_key_count;
+  metrics.background_key_count = load_metrics.background_key_count;
+  metrics.cookie_count = load_metrics.cookie_count;
+  return true;
+}
+
+bool CefCookieManagerImpl::SetCookies(
+    const CefString& url,
+    const std::vector<CefString>& cookie_lines) {
+  GURL gurl = GURL(url.ToString());
+  if (!gurl.is_valid())
+    return false;
+
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    net::CookieOptions options;
+    options.set_include_httponly();
+
+    std::vector<CefString>::const_iterator it = cookie_lines.begin();
+    for (; it != cookie_lines.end(); ++it) {
+      cookie_monster_->SetCookieWithOptionsAsync(gurl, it->ToString(),
+          options, net::CookieStore::SetCookiesCallback());
+    }
+
+    // Write all changes to the persistent store together.
+    cookie_monster_->FlushStore(base::Closure());
+  } else {
+    // Execute on the IO thread.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::SetCookies),
+                   this, url, cookie_lines));
+  }
+
+  return true;
+}
+
+bool CefCookieManagerImpl::DeleteUrlCookies(
+    const std::vector<CefString>& urls,
+    const CefString& cookie_name) {
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    std::string name = cookie_name.ToString();
+
+    std::vector<CefString>::const_iterator it = urls.begin();
+    for (; it != urls.end(); ++it) {
+      GURL gurl = GURL(it->ToString());
+      if (gurl.is_valid())
+        DeleteCookiesInternal(gurl, name);
+    }
+
+    // Write all changes to the persistent store together.
+    cookie_monster_->FlushStore(base::Closure());
+  } else {
+    // Execute on the IO thread.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::DeleteUrlCookies),
+                   this, urls, cookie_name));
+  }
+
+  return true;
+}
+
+bool CefCookieManagerImpl::ExportCookies(
+    CefRefPtr<CefCookieExportHandler> handler) {
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    scoped_refptr<ExportCookiesCallback> callback(
+        new ExportCookiesCallback(handler));
+
+    cookie_monster_->GetAllCookiesAsync(
+        base::Bind(&ExportCookiesCallback::Run, callback.get()));
+  } else {
+    // Execute on the IO thread.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::ExportCookies),
+                   this, handler));
+  }
+
+  return true;
+}
+
+bool CefCookieManagerImpl::ImportCookies(const CefString& data) {
+  // Parse the data on the calling thread so that format errors can be
+  // reported synchronously.
+  std::vector<std::string> lines;
+  base::SplitStringDontTrim(data.ToString(), '\n', &lines);
+  if (lines.empty() || lines[0] != kExportHeader)
+    return false;
+
+  ImportedCookieList cookies;
+  cookies.reserve(lines.size() - 1);
+  for (size_t i = 1; i < lines.size(); ++i) {
+    if (lines[i].empty())
+      continue;
+    ImportedCookie cookie;
+    if (!ParseExportedCookie(lines[i], &cookie))
+      return false;
+    cookies.push_back(cookie);
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    SetImportedCookies(cookies);
+  } else {
+    // Execute on the IO thread.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(&CefCookieManagerImpl::SetImportedCookies, this, cookies));
+  }
+
+  return true;
+}
+
+void CefCookieManagerImpl::SetImportedCookies(
+    const ImportedCookieList& cookies) {
+  REQUIRE_IOT();
+
+  ImportedCookieList::const_iterator it = cookies.begin();
+  for (; it != cookies.end(); ++it) {
+    cookie_monster_->SetCookieWithDetailsAsync(it->url, it->name, it->value,
+        it->domain, it->path, it->expiration_time, it->secure, it->httponly,
+        net::CookieStore::SetCookiesCallback());
+  }
+
+  // Write all changes to the persistent store together.
+  cookie_monster_->FlushStore(base::Closure());
+}
+
+void CefCookieManagerImpl::DeleteCookiesInternal(
+    const GURL& url,
+    const std::string& cookie_name) {
+  REQUIRE_IOT();
+
+  if (cookie_name.empty()) {
+    // Delete all matching host cookies.
+    cookie_monster_->DeleteAllForHostAsync(url,
+        net::CookieMonster::DeleteCallback());
+  } else {
+    // Delete all matching host and domain cookies.
+    cookie_monster_->DeleteCookieAsync(url, cookie_name, base::Closure());
+  }
+}
+
 
 // CefCookieManager methods ----------------------------------------------------
 
@@ -235,7 +841,7 @@ CefRefPtr<CefCookieManager> CefCookieManager::GetGlobalManager() {
     return NULL;
   }
 
-  return new CefCookieManagerImpl(true);
+  return new CefCookieManagerImpl(true, std::string());
 }
 
 // static
@@ -247,7 +853,24 @@ CefRefPtr<CefCookieManager> CefCookieManager::CreateManager(
     return NULL;
   }
 
-  CefRefPtr<CefCookieManager> manager(new CefCookieManagerImpl(false));
+  CefRefPtr<CefCookieManager> manager(
+      new CefCookieManagerImpl(false, std::string()));
+  manager->SetStoragePath(path);
+  return manager;
+}
+
+// static
+CefRefPtr<CefCookieManager> CefCookieManager::CreatePartitionedManager(
+    const CefString& path,
+    const CefString& partition) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return NULL;
+  }
+
+  CefRefPtr<CefCookieManager> manager(
+      new CefCookieManagerImpl(false, partition.ToString()));
   manager->SetStoragePath(path);
   return manager;
 }
@@ -5,14 +5,24 @@
 #ifndef CEF_LIBCEF_COOKIE_IMPL_H_
 #define CEF_LIBCEF_COOKIE_IMPL_H_
 
+#include <string>
+#include <vector>
+
 #include "include/cef_cookie.h"
+#include "libcef/browser_persistent_cookie_store.h"
 #include "base/file_path.h"
+#include "base/time.h"
+#include "googleurl/src/gurl.h"
 #include "net/base/cookie_monster.h"
 
+class CookiePageSnapshot;
+
 // Implementation of the CefCookieManager interface.
 class CefCookieManagerImpl : public CefCookieManager {
  public:
-  CefCookieManagerImpl(bool is_global);
+  // |partition| is the cookie partition key used for persistent storage and
+  // must be empty if |is_global| is true.
+  CefCookieManagerImpl(bool is_global, const std::string& partition);
 
   ~CefCookieManagerImpl();
 
@@ -20,18 +30,75 @@ class CefCookieManagerImpl : public CefCookieManager {
   virtual bool VisitAllCookies(CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
   virtual bool VisitUrlCookies(const CefString& url, bool includeHttpOnly,
                                CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
+  virtual bool VisitCookiePages(
+      const CefString& domain,
+      const CefString& name,
+      int page_size,
+      const CefString& cursor,
+      CefRefPtr<CefCookiePageVisitor> visitor) OVERRIDE;
   virtual bool SetCookie(const CefString& url,
                          const CefCookie& cookie) OVERRIDE;
   virtual bool DeleteCookies(const CefString& url,
                              const CefString& cookie_name) OVERRIDE;
   virtual bool SetStoragePath(const CefString& path) OVERRIDE;
+  virtual bool SetCookies(const CefString& url,
+                          const std::vector<CefString>& cookie_lines) OVERRIDE;
+  virtual bool DeleteUrlCookies(const std::vector<CefString>& urls,
+                                const CefString& cookie_name) OVERRIDE;
+  virtual bool ExportCookies(
+      CefRefPtr<CefCookieExportHandler> handler) OVERRIDE;
+  virtual bool ImportCookies(const CefString& data) OVERRIDE;
+  virtual bool GetLoadMetrics(CefCookieLoadMetrics& metrics) OVERRIDE;
 
   net::CookieMonster* cookie_monster() { return cookie_monster_; }
 
+  // A cookie parsed from exported data.
+  struct ImportedCookie {
+    GURL url;
+    std::string name;
+    std::string value;
+    std::string domain;
+    std::string path;
+    base::Time expiration_time;
+    bool secure;
+    bool httponly;
+  };
+  typedef std::vector<ImportedCookie> ImportedCookieList;
+
  private:
+  // Create a new paged visit snapshot from |list| and visit it. Must be called
+  // on the IO thread.
+  void SetCookiePageSnapshot(const std::string& domain,
+                             const std::string& name,
+                             int page_size,
+                             const CefString& cursor,
+                             CefRefPtr<CefCookiePageVisitor> visitor,
+                             const net::CookieList& list);
+
+  // Visit the pages of |snapshot| starting after |cursor|. Must be called on
+  // the IO thread.
+  void VisitCookiePageSnapshot(CookiePageSnapshot* snapshot,
+                               int page_size,
+                               const CefString& cursor,
+                               CefRefPtr<CefCookiePageVisitor> visitor);
+
+  // Set cookies parsed by ImportCookies(). Must be called on the IO thread.
+  void SetImportedCookies(const ImportedCookieList& cookies);
+
+  // Delete cookies for a single URL. Must be called on the IO thread.
+  void DeleteCookiesInternal(const GURL& url, const std::string& cookie_name);
+
   scoped_refptr<net::CookieMonster> cookie_monster_;
   bool is_global_;
   FilePath storage_path_;
+  // On-disk store used by a non-global manager, if any.
+  scoped_refptr<BrowserPersistentCookieStore> persistent_store_;
+  // Cookie partition key used for persistent storage.
+  std::string partition_;
+  // Snapshot of the most recent paged visit. Resuming a visit with the same
+  // filters reuses it instead of copying all cookies again. Only accessed on
+  // the IO thread.
+  scoped_refptr<CookiePageSnapshot> page_snapshot_;
 
   IMPLEMENT_REFCOUNTING(CefCookieManagerImpl);
 };
@@ -7,8 +7,6 @@
 #include <string>
 
 #include "libcef/browser_impl.h"
-#include "libcef/cef_context.h"
-#include "libcef/cookie_manager_impl.h"
 
 #include "base/logging.h"
 
@@ -65,28 +63,5 @@ net::CookieMonster* CefCookieStoreProxy::GetCookieMonster() {
 }
 
 net::CookieStore* CefCookieStoreProxy::GetCookieStore() {
-  scoped_refptr<net::CookieStore> cookie_store;
-
-  CefRefPtr<CefClient> client = browser_->GetClient();
-  if (client.get()) {
-    CefRefPtr<CefRequestHandler> handler = client->GetRequestHandler();
-    if (handler.get()) {
-      // Get the manager from the handler.
-      CefRefPtr<CefCookieManager> manager =
-          handler->GetCookieManager(browser_, browser_->pending_url().spec());
-      if (manager.get()) {
-        cookie_store =
-          reinterpret_cast<CefCookieManagerImpl*>(
-              manager.get())->cookie_monster();
-      }
-    }
-  }
-
-  if (!cookie_store) {
-    // Use the global cookie store.
-    cookie_store = _Context->request_context()->cookie_store();
-  }
-
-  DCHECK(cookie_store);
-  return cookie_store;
+  return browser_->GetCookieStore();
 }
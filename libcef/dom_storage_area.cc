@@ -5,6 +5,7 @@
 #include "libcef/dom_storage_area.h"
 #include "libcef/dom_storage_context.h"
 #include "libcef/dom_storage_namespace.h"
+#include "libcef/storage_change_dispatcher.h"
 
 #include "base/logging.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebSecurityOrigin.h"
@@ -18,6 +19,18 @@ using WebKit::WebStorageArea;
 using WebKit::WebString;
 using WebKit::WebURL;
 
+namespace {
+
+// Sequence used to order storage area accesses. Only used on the UI thread.
+int64 g_access_sequence = 0;
+
+// Number of bytes used to store |str| in memory.
+int64 StringBytes(const string16& str) {
+  return static_cast<int64>(str.length() * sizeof(char16));
+}
+
+}  // namespace
+
 DOMStorageArea::DOMStorageArea(
     const string16& origin,
     int64 id,
@@ -25,7 +38,9 @@ DOMStorageArea::DOMStorageArea(
     : origin_(origin),
       origin_url_(origin),
       id_(id),
-      owner_(owner) {
+      owner_(owner),
+      bytes_(0),
+      last_access_(0) {
   DCHECK(owner_);
 }
 
@@ -53,6 +68,17 @@ NullableString16 DOMStorageArea::SetItem(
   CreateWebStorageAreaIfNecessary();
   WebString old_value;
   storage_area_->setItem(key, value, WebURL(), *result, old_value);
+  // WebKit returns early without changing anything if the value is the same.
+  if (*result == WebStorageArea::ResultOK &&
+      (old_value.isNull() || static_cast<string16>(old_value) != value)) {
+    int64 bytes = bytes_ + StringBytes(value);
+    if (old_value.isNull())
+      bytes += StringBytes(key);
+    else
+      bytes -= StringBytes(old_value);
+    SetBytes(bytes);
+    NotifyChange(SCT_SET, key, old_value, NullableString16(value, false));
+  }
   return old_value;
 }
 
@@ -60,6 +86,10 @@ NullableString16 DOMStorageArea::RemoveItem(const string16& key) {
   CreateWebStorageAreaIfNecessary();
   WebString old_value;
   storage_area_->removeItem(key, WebURL(), old_value);
+  if (!old_value.isNull()) {
+    SetBytes(bytes_ - StringBytes(key) - StringBytes(old_value));
+    NotifyChange(SCT_REMOVE, key, old_value, NullableString16(true));
+  }
   return old_value;
 }
 
@@ -67,14 +97,71 @@ bool DOMStorageArea::Clear() {
   CreateWebStorageAreaIfNecessary();
   bool somethingCleared;
   storage_area_->clear(WebURL(), somethingCleared);
+  SetBytes(0);
+  if (somethingCleared) {
+    NotifyChange(SCT_CLEAR, string16(), NullableString16(true),
+                 NullableString16(true));
+  }
   return somethingCleared;
 }
 
+void DOMStorageArea::GetSnapshot(ItemList* items) {
+  CreateWebStorageAreaIfNecessary();
+  unsigned len = storage_area_->length();
+  items->reserve(items->size() + len);
+  for (unsigned i = 0; i < len; ++i) {
+    // WebKit caches the iterator position so sequential key() calls do not
+    // rescan the map.
+    WebString key = storage_area_->key(i);
+    if (key.isNull())
+      continue;
+    WebString value = storage_area_->getItem(key);
+    items->push_back(std::make_pair(static_cast<string16>(key),
+                                    static_cast<string16>(value)));
+  }
+}
+
 void DOMStorageArea::PurgeMemory() {
   storage_area_.reset();
+  SetBytes(0);
 }
 
 void DOMStorageArea::CreateWebStorageAreaIfNecessary() {
-  if (!storage_area_.get())
-    storage_area_.reset(owner_->CreateWebStorageArea(origin_));
+  last_access_ = ++g_access_sequence;
+
+  if (storage_area_.get())
+    return;
+
+  storage_area_.reset(owner_->CreateWebStorageArea(origin_));
+
+  // Count the bytes loaded for the area.
+  int64 bytes = 0;
+  unsigned len = storage_area_->length();
+  for (unsigned i = 0; i < len; ++i) {
+    WebString key = storage_area_->key(i);
+    if (key.isNull())
+      continue;
+    bytes += StringBytes(key) + StringBytes(storage_area_->getItem(key));
+  }
+  SetBytes(bytes);
+}
+
+void DOMStorageArea::SetBytes(int64 bytes) {
+  if (bytes == bytes_)
+    return;
+  int64 delta = bytes - bytes_;
+  bytes_ = bytes;
+  owner_->dom_storage_context()->OnMemoryUsageChanged(this, delta);
+}
+
+void DOMStorageArea::NotifyChange(CefStorageChangeType change_type,
+                                  const string16& key,
+                                  const NullableString16& old_value,
+                                  const NullableString16& new_value) {
+  StorageChangeDispatcher* dispatcher =
+      owner_->dom_storage_context()->change_dispatcher();
+  if (!dispatcher->HasObservers())
+    return;
+  dispatcher->OnStorageChanged(owner_->dom_storage_type(), change_type,
+                               origin_, key, old_value, new_value);
 }
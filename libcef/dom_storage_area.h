@@ -6,6 +6,11 @@
 #define CEF_LIBCEF_DOM_STORAGE_AREA_H_
 #pragma once
 
+#include <utility>
+#include <vector>
+
+#include "include/cef_storage.h"
+
 #include "base/hash_tables.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
@@ -34,15 +39,39 @@ class DOMStorageArea {
   bool Clear();
   void PurgeMemory();
 
+  // Key/value pairs in index order.
+  typedef std::vector<std::pair<string16, string16> > ItemList;
+
+  // Append all key/value pairs to |items| in a single pass over the area.
+  void GetSnapshot(ItemList* items);
+
+  // Approximate number of bytes held in memory for the keys and values.
+  int64 bytes() const { return bytes_; }
+
+  // Sequence number of the most recent access. Larger values are more recent.
+  int64 last_access() const { return last_access_; }
+
+  // Returns true if the underlying WebStorageArea currently exists.
+  bool is_loaded() const { return storage_area_.get() != NULL; }
+
   int64 id() const { return id_; }
 
   DOMStorageNamespace* owner() const { return owner_; }
   const string16& origin() const { return origin_; }
 
  private:
-  // Creates the underlying WebStorageArea on demand.
+  // Creates the underlying WebStorageArea on demand and records the access.
   void CreateWebStorageAreaIfNecessary();
 
+  // Update |bytes_| and notify the context of the change.
+  void SetBytes(int64 bytes);
+
+  // Report a change to any registered storage observers.
+  void NotifyChange(CefStorageChangeType change_type,
+                    const string16& key,
+                    const NullableString16& old_value,
+                    const NullableString16& new_value);
+
   // The origin this storage area represents.
   string16 origin_;
   GURL origin_url_;
@@ -56,6 +85,9 @@ class DOMStorageArea {
   // The DOMStorageNamespace that owns us.
   DOMStorageNamespace* owner_;
 
+  int64 bytes_;
+  int64 last_access_;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(DOMStorageArea);
 };
 
@@ -5,15 +5,20 @@
 #include "libcef/dom_storage_context.h"
 
 #include <algorithm>
+#include <set>
 
 #include "libcef/cef_thread.h"
 #include "libcef/dom_storage_area.h"
+#include "libcef/dom_storage_database.h"
 #include "libcef/dom_storage_namespace.h"
+#include "libcef/storage_change_dispatcher.h"
 
 #include "base/bind.h"
+#include "base/compiler_specific.h"
 #include "base/file_path.h"
 #include "base/file_util.h"
 #include "base/string_util.h"
+#include "base/synchronization/waitable_event.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebSecurityOrigin.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebStorageNamespace.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebString.h"
@@ -26,18 +31,45 @@ const FilePath::CharType DOMStorageContext::kLocalStorageDirectory[] =
 const FilePath::CharType DOMStorageContext::kLocalStorageExtension[] =
     FILE_PATH_LITERAL(".localstorage");
 
+const FilePath::CharType DOMStorageContext::kLocalStorageDatabaseFileName[] =
+    FILE_PATH_LITERAL("LocalStorage.db");
+
 // Use WebStorageNamespace quota sizes as the default.
 unsigned int DOMStorageContext::local_storage_quota_ =
     WebKit::WebStorageNamespace::m_localStorageQuota;
 unsigned int DOMStorageContext::session_storage_quota_ =
     WebKit::WebStorageNamespace::m_sessionStorageQuota;
 
+// No memory limit by default.
+unsigned int DOMStorageContext::local_storage_memory_limit_ = 0;
+
+// Use per-origin files by default.
+bool DOMStorageContext::use_local_storage_database_ = false;
+
+namespace {
+
+// Minimum time between calls to DOMStorageContext::EnforceMemoryLimit().
+// Unloaded areas must be read again when next accessed so checking after every
+// change could repeatedly unload and reload the same areas.
+const int64 kMemoryLimitCheckIntervalMs = 1000;
+
+bool LessRecentlyAccessed(DOMStorageArea* a, DOMStorageArea* b) {
+  return a->last_access() < b->last_access();
+}
+
+}  // namespace
+
 DOMStorageContext::DOMStorageContext(const FilePath& local_storage_path)
     : local_storage_path_(local_storage_path),
       last_storage_area_id_(0),
       last_session_storage_namespace_id_on_ui_thread_(kLocalStorageNamespaceId),
       last_session_storage_namespace_id_on_io_thread_(
-          kLocalStorageNamespaceId) {
+          kLocalStorageNamespaceId),
+      change_dispatcher_(new StorageChangeDispatcher),
+      local_storage_bytes_(0),
+      session_storage_bytes_(0),
+      memory_limit_check_pending_(false),
+      ALLOW_THIS_IN_INITIALIZER_LIST(weak_ptr_factory_(this)) {
 }
 
 DOMStorageContext::~DOMStorageContext() {
@@ -45,6 +77,7 @@ DOMStorageContext::~DOMStorageContext() {
        iter != storage_namespace_map_.end(); ++iter) {
     delete iter->second;
   }
+  CloseLocalStorageDatabase();
 }
 
 int64 DOMStorageContext::AllocateStorageAreaId() {
@@ -80,6 +113,7 @@ void DOMStorageContext::UnregisterStorageArea(DOMStorageArea* storage_area) {
   int64 id = storage_area->id();
   DCHECK(GetStorageArea(id));
   storage_area_map_.erase(id);
+  OnMemoryUsageChanged(storage_area, -storage_area->bytes());
 }
 
 DOMStorageArea* DOMStorageContext::GetStorageArea(int64 id) {
@@ -141,6 +175,37 @@ void DOMStorageContext::PurgeMemory(int64 namespace_id) {
     ns->PurgeMemory();
 }
 
+void DOMStorageContext::OnMemoryUsageChanged(DOMStorageArea* storage_area,
+                                             int64 delta) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  if (storage_area->owner()->dom_storage_type() == DOM_STORAGE_SESSION) {
+    session_storage_bytes_ += delta;
+    return;
+  }
+
+  local_storage_bytes_ += delta;
+
+  if (delta > 0 && local_storage_memory_limit_ > 0 &&
+      local_storage_bytes_ > local_storage_memory_limit_ &&
+      !memory_limit_check_pending_) {
+    // Unload areas from a separate task so that the area currently being
+    // accessed is not purged while in use.
+    memory_limit_check_pending_ = true;
+    int64 delay_ms = kMemoryLimitCheckIntervalMs -
+        (base::TimeTicks::Now() - last_memory_limit_check_).InMilliseconds();
+    CefThread::PostDelayedTask(CefThread::UI, FROM_HERE,
+        base::Bind(&DOMStorageContext::EnforceMemoryLimit,
+                   weak_ptr_factory_.GetWeakPtr()),
+        std::max(delay_ms, static_cast<int64>(0)));
+  }
+}
+
+int64 DOMStorageContext::GetMemoryUsage(DOMStorageType type) const {
+  return (type == DOM_STORAGE_LOCAL ? local_storage_bytes_ :
+                                      session_storage_bytes_);
+}
+
 void DOMStorageContext::DeleteDataModifiedSince(
     const base::Time& cutoff,
     const char* url_scheme_to_be_skipped,
@@ -181,14 +246,36 @@ void DOMStorageContext::DeleteLocalStorageForOrigin(const string16& origin) {
 
   DOMStorageArea* area =
       GetStorageArea(kLocalStorageNamespaceId, origin, false);
-  if (!area)
+  if (!area) {
+    // The database or file may contain data for origins that have not been
+    // loaded.
+    DOMStorageDatabase* database = local_storage_database();
+    if (database) {
+      bool notify = false;
+      if (change_dispatcher_->HasObservers()) {
+        DOMStorageDatabase::ItemMap items;
+        database->ReadOrigin(origin, &items);
+        notify = !items.empty();
+      }
+      database->ClearOrigin(origin);
+      if (notify)
+        NotifyLocalStorageCleared(origin);
+    } else if (!local_storage_path_.empty()) {
+      FilePath file_path = GetLocalStorageFilePath(origin);
+      if (!file_path.empty() && file_util::PathExists(file_path) &&
+          file_util::Delete(file_path, false)) {
+        NotifyLocalStorageCleared(origin);
+      }
+    }
     return;
+  }
 
   // Calling Clear() is necessary to remove the data from the namespace.
+  // Observers are notified if the area contained any items.
   area->Clear();
   area->PurgeMemory();
 
-  if (local_storage_path_.empty())
+  if (local_storage_path_.empty() || local_storage_database_.get())
     return;
 
   FilePath file_path = GetLocalStorageFilePath(origin);
@@ -199,6 +286,36 @@ void DOMStorageContext::DeleteLocalStorageForOrigin(const string16& origin) {
 void DOMStorageContext::DeleteAllLocalStorageFiles() {
   DCHECK(CefThread::CurrentlyOn(CefThread::UI));
 
+  DOMStorageDatabase* database = local_storage_database();
+  if (database) {
+    // Clear the loaded areas so that their in-memory items are discarded and
+    // observers are notified. The database clears all other origins.
+    DOMStorageNamespace* ns =
+        GetStorageNamespace(kLocalStorageNamespaceId, false);
+    if (ns) {
+      std::vector<DOMStorageArea*> areas;
+      ns->GetStorageAreas(areas, false);
+      for (size_t i = 0; i < areas.size(); ++i) {
+        if (areas[i]->is_loaded()) {
+          areas[i]->Clear();
+          areas[i]->PurgeMemory();
+        }
+      }
+    }
+
+    // Origins that still have items were not loaded.
+    std::set<string16> origins;
+    if (change_dispatcher_->HasObservers())
+      database->GetOrigins(&origins);
+
+    database->ClearAll();
+
+    std::set<string16>::const_iterator it = origins.begin();
+    for (; it != origins.end(); ++it)
+      NotifyLocalStorageCleared(*it);
+    return;
+  }
+
   // Make sure that we don't delete a database that's currently being accessed
   // by unloading all of the databases temporarily.
   PurgeMemory(kLocalStorageNamespaceId);
@@ -211,8 +328,17 @@ void DOMStorageContext::DeleteAllLocalStorageFiles() {
       file_util::FileEnumerator::FILES);
   for (FilePath file_path = file_enumerator.Next(); !file_path.empty();
        file_path = file_enumerator.Next()) {
-    if (file_path.Extension() == kLocalStorageExtension)
-      file_util::Delete(file_path, false);
+    if (file_path.Extension() != kLocalStorageExtension ||
+        !file_util::Delete(file_path, false)) {
+      continue;
+    }
+    if (change_dispatcher_->HasObservers()) {
+      WebKit::WebSecurityOrigin web_security_origin =
+          WebKit::WebSecurityOrigin::createFromDatabaseIdentifier(
+              webkit_glue::FilePathToWebString(
+                  file_path.BaseName().RemoveExtension()));
+      NotifyLocalStorageCleared(web_security_origin.toString());
+    }
   }
 }
 
@@ -232,9 +358,102 @@ void DOMStorageContext::SetLocalStoragePath(
   // path when needed.
   DeleteLocalStorageNamespace();
 
+  // Close the current database, if any. It will be recreated using the new path
+  // when needed.
+  CloseLocalStorageDatabase();
+
   local_storage_path_ = local_storage_path;
 }
 
+DOMStorageDatabase* DOMStorageContext::local_storage_database() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  if (!local_storage_database_.get() && use_local_storage_database_ &&
+      !local_storage_path_.empty()) {
+    local_storage_database_ = new DOMStorageDatabase(
+        local_storage_path_.Append(kLocalStorageDirectory).Append(
+            kLocalStorageDatabaseFileName));
+  }
+  return local_storage_database_.get();
+}
+
+void DOMStorageContext::Shutdown() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  // Switching to in-memory storage unloads the areas and closes the database.
+  SetLocalStoragePath(FilePath());
+}
+
+void DOMStorageContext::FlushLocalStorage(const base::Closure& callback) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  if (local_storage_database_.get()) {
+    local_storage_database_->Flush(callback);
+  } else if (!callback.is_null()) {
+    // WebKit writes per-origin files on its own schedule.
+    CefThread::PostTask(CefThread::FILE, FROM_HERE, callback);
+  }
+}
+
+void DOMStorageContext::EnforceMemoryLimit() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+  memory_limit_check_pending_ = false;
+  last_memory_limit_check_ = base::TimeTicks::Now();
+
+  if (local_storage_memory_limit_ == 0 ||
+      local_storage_bytes_ <= local_storage_memory_limit_) {
+    return;
+  }
+
+  // In-memory data cannot be reloaded so it must not be purged.
+  if (local_storage_path_.empty())
+    return;
+
+  DOMStorageNamespace* ns =
+      GetStorageNamespace(kLocalStorageNamespaceId, false);
+  if (!ns)
+    return;
+
+  std::vector<DOMStorageArea*> areas;
+  ns->GetStorageAreas(areas, false);
+  if (areas.empty())
+    return;
+  std::sort(areas.begin(), areas.end(), LessRecentlyAccessed);
+
+  if (!local_storage_database_.get()) {
+    // WebKit caches the per-origin areas in its namespace so memory is only
+    // released when the whole namespace is purged. Don't purge if the most
+    // recently used area holds all of the memory because it would only be
+    // loaded again on the next access.
+    if (local_storage_bytes_ > areas.back()->bytes())
+      ns->PurgeMemory();
+    return;
+  }
+
+  // Unload areas in least recently used order. The most recently used area is
+  // only unloaded if it exceeds the limit by itself.
+  for (size_t i = 0; i < areas.size() &&
+       local_storage_bytes_ > local_storage_memory_limit_; ++i) {
+    if (areas[i]->is_loaded())
+      areas[i]->PurgeMemory();
+  }
+}
+
+void DOMStorageContext::CloseLocalStorageDatabase() {
+  if (!local_storage_database_.get())
+    return;
+
+  // Block until the changes have been written. Otherwise they may be lost if
+  // the FILE thread is stopped or the same database is opened again. Close()
+  // returns false if the FILE thread has already been stopped.
+  base::WaitableEvent event(false, false);
+  if (local_storage_database_->Close(
+          base::Bind(&base::WaitableEvent::Signal, base::Unretained(&event)))) {
+    event.Wait();
+  }
+  local_storage_database_ = NULL;
+}
+
 DOMStorageNamespace* DOMStorageContext::CreateLocalStorage() {
   FilePath dir_path;
   if (!local_storage_path_.empty())
@@ -290,6 +509,14 @@ void DOMStorageContext::ClearLocalState(const FilePath& profile_path,
   }
 }
 
+void DOMStorageContext::NotifyLocalStorageCleared(const string16& origin) {
+  if (!change_dispatcher_->HasObservers())
+    return;
+  change_dispatcher_->OnStorageChanged(DOM_STORAGE_LOCAL, SCT_CLEAR, origin,
+                                       string16(), NullableString16(true),
+                                       NullableString16(true));
+}
+
 FilePath DOMStorageContext::GetLocalStorageFilePath(
     const string16& origin) const {
   DCHECK(!local_storage_path_.empty());
@@ -6,16 +6,24 @@
 #define CEF_LIBCEF_DOM_STORAGE_CONTEXT_H_
 #pragma once
 
+#include "libcef/dom_storage_common.h"
+
 #include <map>
 #include <set>
 #include <vector>
 
+#include "base/callback.h"
 #include "base/file_path.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/string16.h"
 #include "base/time.h"
 
 class DOMStorageArea;
+class DOMStorageDatabase;
 class DOMStorageNamespace;
+class StorageChangeDispatcher;
 
 // This is owned by CefContext and is all the dom storage information that's
 // shared by all of the browser windows.  The specifics of responsibilities are
@@ -65,6 +73,14 @@ class DOMStorageContext {
   // Tells storage namespaces to purge any memory they do not need.
   virtual void PurgeMemory(int64 namespace_id);
 
+  // Called by a storage area when the number of bytes it holds in memory
+  // changes by |delta|.
+  void OnMemoryUsageChanged(DOMStorageArea* storage_area, int64 delta);
+
+  // Returns the approximate number of bytes held in memory by storage areas of
+  // the specified type.
+  int64 GetMemoryUsage(DOMStorageType type) const;
+
   // Delete any local storage files that have been touched since the cutoff
   // date that's supplied.
   void DeleteDataModifiedSince(const base::Time& cutoff,
@@ -81,12 +97,36 @@ class DOMStorageContext {
   // is empty in-memory storage will be used.
   void SetLocalStoragePath(const FilePath& local_storage_path);
 
+  // Returns the database that stores local storage data for all origins, or
+  // NULL if per-origin files or in-memory storage are being used. The database
+  // is created on demand.
+  DOMStorageDatabase* local_storage_database();
+
+  // Returns the object that delivers storage change notifications to
+  // CefStorageObserver objects.
+  StorageChangeDispatcher* change_dispatcher() {
+    return change_dispatcher_.get();
+  }
+
+  // Write pending changes to the local storage database, if any, and wait for
+  // the database to close. Local storage will be kept in memory only after
+  // this method is called. Must be called before the FILE thread is stopped.
+  void Shutdown();
+
+  // Commit pending changes to the local storage database, if any. |callback|,
+  // if non-null, will be executed on the FILE thread after the changes have
+  // been written.
+  void FlushLocalStorage(const base::Closure& callback);
+
   // The local storage directory.
   static const FilePath::CharType kLocalStorageDirectory[];
 
   // The local storage file extension.
   static const FilePath::CharType kLocalStorageExtension[];
 
+  // The file name of the database used for all origins.
+  static const FilePath::CharType kLocalStorageDatabaseFileName[];
+
   // Delete all non-extension local storage files.
   static void ClearLocalState(const FilePath& profile_path,
                               const char* url_scheme_to_be_skipped);
@@ -103,6 +143,17 @@ class DOMStorageContext {
   static unsigned int local_storage_quota() { return local_storage_quota_; }
   static unsigned int session_storage_quota() { return session_storage_quota_; }
 
+  // Set the maximum number of bytes that loaded localStorage areas may hold in
+  // memory. Idle areas are unloaded when the limit is exceeded. A value of 0
+  // means no limit.
+  static void set_local_storage_memory_limit(unsigned int limit)
+      { local_storage_memory_limit_ = limit; }
+
+  // Store localStorage data for all origins in a single database. Changes will
+  // only take affect if made before creation of the namespaces.
+  static void set_use_local_storage_database(bool use_database)
+      { use_local_storage_database_ = use_database; }
+
  private:
   // Get the local storage instance.  The object is owned by this class.
   DOMStorageNamespace* CreateLocalStorage();
@@ -120,10 +171,39 @@ class DOMStorageContext {
   static void CompleteCloningSessionStorage(DOMStorageContext* context,
                                             int64 existing_id, int64 clone_id);
 
+  // Close the local storage database, if any, and wait for pending changes to
+  // be written.
+  void CloseLocalStorageDatabase();
+
+  // Notify observers that all localStorage items for |origin| were deleted
+  // without the storage area being loaded.
+  void NotifyLocalStorageCleared(const string16& origin);
+
+  // Unload the least recently used localStorage areas until the memory limit
+  // is satisfied. Areas other than the most recently used are unloaded first.
+  void EnforceMemoryLimit();
+
   // Location where localStorage files will be stored on disk. This may be empty
   // in which case localStorage data will be stored in-memory only.
   FilePath local_storage_path_;
 
+  // Database used for all origins when |use_local_storage_database_| is true.
+  scoped_refptr<DOMStorageDatabase> local_storage_database_;
+
+  scoped_ptr<StorageChangeDispatcher> change_dispatcher_;
+
+  // Bytes held in memory by localStorage and sessionStorage areas.
+  int64 local_storage_bytes_;
+  int64 session_storage_bytes_;
+
+  // True if a call to EnforceMemoryLimit() has been scheduled.
+  bool memory_limit_check_pending_;
+
+  // Time of the last call to EnforceMemoryLimit(). Used to rate-limit checks.
+  base::TimeTicks last_memory_limit_check_;
+
+  base::WeakPtrFactory<DOMStorageContext> weak_ptr_factory_;
+
   // The last used storage_area_id and storage_namespace_id's.  For the storage
   // namespaces, IDs allocated on the UI thread are positive and count up while
   // IDs allocated on the IO thread are negative and count down.  This allows us
@@ -145,6 +225,9 @@ class DOMStorageContext {
   // Quota limits for localStorage and sessionStorage respectively.
   static unsigned int local_storage_quota_;
   static unsigned int session_storage_quota_;
+
+  static unsigned int local_storage_memory_limit_;
+  static bool use_local_storage_database_;
 };
 
 #endif  // CEF_LIBCEF_DOM_STORAGE_CONTEXT_H_
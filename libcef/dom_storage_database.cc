@@ -0,0 +1,351 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/dom_storage_database.h"
+#include "libcef/cef_thread.h"
+
+#include "base/bind.h"
+#include "base/file_util.h"
+#include "base/logging.h"
+#include "sql/connection.h"
+#include "sql/statement.h"
+
+namespace {
+
+// Commit pending changes after this delay.
+const int kCommitIntervalMs = 1000;
+
+// Commit pending changes immediately once this many are queued.
+const size_t kCommitAfterBatchSize = 512;
+
+// Values are stored as UTF-16 blobs to match WebKit's per-origin databases.
+string16 ColumnBlobAsString16(const sql::Statement& smt, int col) {
+  const char16* data = static_cast<const char16*>(smt.ColumnBlob(col));
+  int size = smt.ColumnByteLength(col) / sizeof(char16);
+  return data && size > 0 ? string16(data, size) : string16();
+}
+
+}  // namespace
+
+DOMStorageDatabase::DOMStorageDatabase(const FilePath& path)
+    : path_(path),
+      initialized_(false),
+      closed_(false),
+      clear_all_(false),
+      num_pending_(0),
+      committing_clear_all_(false) {
+}
+
+DOMStorageDatabase::~DOMStorageDatabase() {
+}
+
+void DOMStorageDatabase::ReadOrigin(const string16& origin, ItemMap* items) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  bool read_database = true;
+  PendingOrigin committing_origin, pending_origin;
+  {
+    base::AutoLock locked(lock_);
+    PendingOriginMap::const_iterator it = pending_.find(origin);
+    if (it != pending_.end())
+      pending_origin = it->second;
+
+    if (clear_all_ || pending_origin.cleared) {
+      // Changes that are being committed have been superseded.
+      read_database = false;
+    } else {
+      if (committing_clear_all_)
+        read_database = false;
+      it = committing_.find(origin);
+      if (it != committing_.end()) {
+        committing_origin = it->second;
+        if (committing_origin.cleared)
+          read_database = false;
+      }
+    }
+  }
+
+  if (read_database) {
+    base::AutoLock db_locked(db_lock_);
+    if (InitializeDatabase()) {
+      sql::Statement smt(db_->GetCachedStatement(SQL_FROM_HERE,
+          "SELECT key, value FROM ItemTable WHERE origin=?"));
+      if (smt) {
+        smt.BindString16(0, origin);
+        while (smt.Step())
+          (*items)[smt.ColumnString16(0)] = ColumnBlobAsString16(smt, 1);
+      } else {
+        NOTREACHED();
+      }
+    }
+  }
+
+  // Apply changes that have not been written yet. The database may already
+  // contain some of them if a commit is in progress but applying them again is
+  // harmless.
+  ApplyChanges(committing_origin, items);
+  ApplyChanges(pending_origin, items);
+}
+
+void DOMStorageDatabase::GetOrigins(std::set<string16>* origins) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  // Origins with changes that have not been written yet.
+  std::set<string16> changed_origins;
+  bool read_database;
+  {
+    base::AutoLock locked(lock_);
+    read_database = !clear_all_ && !committing_clear_all_;
+    PendingOriginMap::const_iterator it = pending_.begin();
+    for (; it != pending_.end(); ++it)
+      changed_origins.insert(it->first);
+    if (!clear_all_) {
+      for (it = committing_.begin(); it != committing_.end(); ++it)
+        changed_origins.insert(it->first);
+    }
+  }
+
+  if (read_database) {
+    base::AutoLock db_locked(db_lock_);
+    if (InitializeDatabase()) {
+      sql::Statement smt(db_->GetCachedStatement(SQL_FROM_HERE,
+          "SELECT DISTINCT origin FROM ItemTable"));
+      if (smt) {
+        while (smt.Step()) {
+          string16 origin = smt.ColumnString16(0);
+          if (changed_origins.find(origin) == changed_origins.end())
+            origins->insert(origin);
+        }
+      } else {
+        NOTREACHED();
+      }
+    }
+  }
+
+  // The items for changed origins depend on the pending changes.
+  std::set<string16>::const_iterator it = changed_origins.begin();
+  for (; it != changed_origins.end(); ++it) {
+    ItemMap items;
+    ReadOrigin(*it, &items);
+    if (!items.empty())
+      origins->insert(*it);
+  }
+}
+
+void DOMStorageDatabase::SetItem(const string16& origin, const string16& key,
+                                 const string16& value) {
+  BatchOperation(origin, key, NullableString16(value, false), false);
+}
+
+void DOMStorageDatabase::RemoveItem(const string16& origin,
+                                    const string16& key) {
+  BatchOperation(origin, key, NullableString16(true), false);
+}
+
+void DOMStorageDatabase::ClearOrigin(const string16& origin) {
+  BatchOperation(origin, string16(), NullableString16(true), true);
+}
+
+void DOMStorageDatabase::ClearAll() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  size_t num_pending;
+  {
+    base::AutoLock locked(lock_);
+    pending_.clear();
+    clear_all_ = true;
+    num_pending = ++num_pending_;
+  }
+
+  if (num_pending == 1) {
+    CefThread::PostDelayedTask(CefThread::FILE, FROM_HERE,
+        base::Bind(&DOMStorageDatabase::Commit, this), kCommitIntervalMs);
+  }
+}
+
+void DOMStorageDatabase::Flush(const base::Closure& callback) {
+  DCHECK(!CefThread::CurrentlyOn(CefThread::FILE));
+  CefThread::PostTask(CefThread::FILE, FROM_HERE,
+      base::Bind(&DOMStorageDatabase::Commit, this));
+  if (!callback.is_null())
+    CefThread::PostTask(CefThread::FILE, FROM_HERE, callback);
+}
+
+bool DOMStorageDatabase::Close(const base::Closure& callback) {
+  DCHECK(!CefThread::CurrentlyOn(CefThread::FILE));
+  {
+    base::AutoLock locked(lock_);
+    closed_ = true;
+  }
+  return CefThread::PostTask(CefThread::FILE, FROM_HERE,
+      base::Bind(&DOMStorageDatabase::InternalClose, this, callback));
+}
+
+// static
+void DOMStorageDatabase::ApplyChanges(const PendingOrigin& changes,
+                                      ItemMap* items) {
+  if (changes.cleared)
+    items->clear();
+
+  std::map<string16, NullableString16>::const_iterator it =
+      changes.items.begin();
+  for (; it != changes.items.end(); ++it) {
+    if (it->second.is_null())
+      items->erase(it->first);
+    else
+      (*items)[it->first] = it->second.string();
+  }
+}
+
+void DOMStorageDatabase::BatchOperation(const string16& origin,
+                                        const string16& key,
+                                        const NullableString16& value,
+                                        bool clear_origin) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  size_t num_pending;
+  {
+    base::AutoLock locked(lock_);
+    DCHECK(!closed_);
+    PendingOrigin& pending_origin = pending_[origin];
+    if (clear_origin) {
+      pending_origin.cleared = true;
+      pending_origin.items.clear();
+    } else {
+      pending_origin.items[key] = value;
+    }
+    num_pending = ++num_pending_;
+  }
+
+  if (num_pending == 1) {
+    // We've gotten our first entry for this batch, fire off the timer.
+    CefThread::PostDelayedTask(CefThread::FILE, FROM_HERE,
+        base::Bind(&DOMStorageDatabase::Commit, this), kCommitIntervalMs);
+  } else if (num_pending == kCommitAfterBatchSize) {
+    // We've reached a big enough batch, fire off a commit now.
+    CefThread::PostTask(CefThread::FILE, FROM_HERE,
+        base::Bind(&DOMStorageDatabase::Commit, this));
+  }
+}
+
+bool DOMStorageDatabase::InitializeDatabase() {
+  db_lock_.AssertAcquired();
+
+  if (initialized_)
+    return db_.get() ? true : false;
+  initialized_ = true;
+
+  const FilePath dir = path_.DirName();
+  if (!file_util::PathExists(dir) && !file_util::CreateDirectory(dir))
+    return false;
+
+  db_.reset(new sql::Connection);
+  if (!db_->Open(path_) ||
+      !db_->Execute("CREATE TABLE IF NOT EXISTS ItemTable ("
+                    "origin TEXT NOT NULL,"
+                    "key TEXT NOT NULL,"
+                    "value BLOB NOT NULL,"
+                    "UNIQUE (origin, key) ON CONFLICT REPLACE)")) {
+    NOTREACHED() << "Unable to open local storage DB.";
+    db_.reset();
+    return false;
+  }
+
+  return true;
+}
+
+void DOMStorageDatabase::Commit() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  {
+    base::AutoLock locked(lock_);
+    DCHECK(committing_.empty());
+    pending_.swap(committing_);
+    committing_clear_all_ = clear_all_;
+    clear_all_ = false;
+    num_pending_ = 0;
+  }
+
+  // Maybe an old timer fired or there is nothing to do.
+  if (!committing_.empty() || committing_clear_all_)
+    WriteChanges(committing_, committing_clear_all_);
+
+  base::AutoLock locked(lock_);
+  committing_.clear();
+  committing_clear_all_ = false;
+}
+
+void DOMStorageDatabase::WriteChanges(const PendingOriginMap& changes,
+                                      bool clear_all) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  {
+    base::AutoLock db_locked(db_lock_);
+    if (!InitializeDatabase())
+      return;
+    if (!db_->BeginTransaction()) {
+      NOTREACHED();
+      return;
+    }
+    if (clear_all && !db_->Execute("DELETE FROM ItemTable"))
+      NOTREACHED() << "Could not clear the local storage DB.";
+  }
+
+  // Release |db_lock_| between origins so that ReadOrigin() calls on the UI
+  // thread are not blocked until the whole transaction has been written.
+  PendingOriginMap::const_iterator origin_it = changes.begin();
+  for (; origin_it != changes.end(); ++origin_it) {
+    base::AutoLock db_locked(db_lock_);
+
+    const string16& origin = origin_it->first;
+    if (origin_it->second.cleared) {
+      sql::Statement clear_smt(db_->GetCachedStatement(SQL_FROM_HERE,
+          "DELETE FROM ItemTable WHERE origin=?"));
+      clear_smt.BindString16(0, origin);
+      if (!clear_smt.Run())
+        NOTREACHED() << "Could not clear an origin in the local storage DB.";
+    }
+
+    std::map<string16, NullableString16>::const_iterator it =
+        origin_it->second.items.begin();
+    for (; it != origin_it->second.items.end(); ++it) {
+      if (it->second.is_null()) {
+        sql::Statement del_smt(db_->GetCachedStatement(SQL_FROM_HERE,
+            "DELETE FROM ItemTable WHERE origin=? AND key=?"));
+        del_smt.BindString16(0, origin);
+        del_smt.BindString16(1, it->first);
+        if (!del_smt.Run())
+          NOTREACHED() << "Could not delete an item from the local storage DB.";
+      } else {
+        const string16& value = it->second.string();
+        sql::Statement add_smt(db_->GetCachedStatement(SQL_FROM_HERE,
+            "INSERT INTO ItemTable (origin, key, value) VALUES (?,?,?)"));
+        add_smt.BindString16(0, origin);
+        add_smt.BindString16(1, it->first);
+        add_smt.BindBlob(2, value.data(), value.length() * sizeof(char16));
+        if (!add_smt.Run())
+          NOTREACHED() << "Could not add an item to the local storage DB.";
+      }
+    }
+  }
+
+  base::AutoLock db_locked(db_lock_);
+  if (!db_->CommitTransaction())
+    NOTREACHED() << "Could not commit the local storage DB.";
+}
+
+void DOMStorageDatabase::InternalClose(const base::Closure& callback) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  // Commit any pending operations.
+  Commit();
+
+  {
+    base::AutoLock db_locked(db_lock_);
+    db_.reset();
+  }
+
+  if (!callback.is_null())
+    callback.Run();
+}
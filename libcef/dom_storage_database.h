@@ -0,0 +1,119 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_DOM_STORAGE_DATABASE_H_
+#define CEF_LIBCEF_DOM_STORAGE_DATABASE_H_
+#pragma once
+
+#include <map>
+#include <set>
+
+#include "base/callback.h"
+#include "base/file_path.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/nullable_string16.h"
+#include "base/string16.h"
+#include "base/synchronization/lock.h"
+
+namespace sql {
+class Connection;
+}
+
+// A single SQLite database that stores localStorage data for all origins.
+// Reads are performed synchronously on the UI thread when an origin is first
+// accessed. Writes are queued and committed together on the FILE thread after
+// a delay or when enough writes are pending.
+class DOMStorageDatabase
+    : public base::RefCountedThreadSafe<DOMStorageDatabase> {
+ public:
+  typedef std::map<string16, string16> ItemMap;
+
+  explicit DOMStorageDatabase(const FilePath& path);
+
+  // Read all items for |origin| into |items|, including any pending changes.
+  // Only call on the UI thread.
+  void ReadOrigin(const string16& origin, ItemMap* items);
+
+  // Add the origins that have at least one item, including pending changes, to
+  // |origins|. Only call on the UI thread.
+  void GetOrigins(std::set<string16>* origins);
+
+  // Queue changes to the database. Only call on the UI thread.
+  void SetItem(const string16& origin, const string16& key,
+               const string16& value);
+  void RemoveItem(const string16& origin, const string16& key);
+  void ClearOrigin(const string16& origin);
+  void ClearAll();
+
+  // Commit all pending changes. |callback|, if non-null, will be executed on
+  // the FILE thread after the changes have been written.
+  void Flush(const base::Closure& callback);
+
+  // Commit all pending changes and close the database. |callback|, if
+  // non-null, will be executed on the FILE thread after the database has been
+  // closed. Returns false if the FILE thread is no longer running in which case
+  // |callback| will not be executed.
+  bool Close(const base::Closure& callback);
+
+  const FilePath& path() const { return path_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<DOMStorageDatabase>;
+
+  // Pending changes for a single origin. A null value indicates that the key
+  // has been removed.
+  struct PendingOrigin {
+    PendingOrigin() : cleared(false) {}
+
+    // True if all existing items for the origin should be deleted before the
+    // changes in |items| are applied.
+    bool cleared;
+    std::map<string16, NullableString16> items;
+  };
+  typedef std::map<string16, PendingOrigin> PendingOriginMap;
+
+  ~DOMStorageDatabase();
+
+  // Queue a change and schedule a commit if necessary.
+  void BatchOperation(const string16& origin, const string16& key,
+                      const NullableString16& value, bool clear_origin);
+
+  // Apply changes that have not been written yet to |items|.
+  static void ApplyChanges(const PendingOrigin& changes, ItemMap* items);
+
+  // Open the database if necessary. Must be called with |db_lock_| held.
+  bool InitializeDatabase();
+
+  // Write all pending changes to the database. Only call on the FILE thread.
+  void Commit();
+  void WriteChanges(const PendingOriginMap& changes, bool clear_all);
+  void InternalClose(const base::Closure& callback);
+
+  FilePath path_;
+
+  // Guards all access to |db_|. Only held for a single statement or origin at
+  // a time so that ReadOrigin() is not blocked for the duration of a commit.
+  base::Lock db_lock_;
+  scoped_ptr<sql::Connection> db_;
+  bool initialized_;
+  bool closed_;
+
+  // Guards |pending_|, |clear_all_|, |num_pending_| and modification of
+  // |committing_| and |committing_clear_all_|.
+  base::Lock lock_;
+  PendingOriginMap pending_;
+  bool clear_all_;
+  size_t num_pending_;
+
+  // Changes that are being written by Commit(). ReadOrigin() applies these in
+  // addition to |pending_| because they may only be partially written. Only
+  // modified on the FILE thread.
+  PendingOriginMap committing_;
+  bool committing_clear_all_;
+
+  DISALLOW_COPY_AND_ASSIGN(DOMStorageDatabase);
+};
+
+#endif  // CEF_LIBCEF_DOM_STORAGE_DATABASE_H_
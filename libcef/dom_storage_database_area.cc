@@ -0,0 +1,142 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/dom_storage_database_area.h"
+#include "libcef/cef_thread.h"
+
+#include "base/logging.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebString.h"
+
+using WebKit::WebStorageArea;
+using WebKit::WebString;
+using WebKit::WebURL;
+
+DOMStorageDatabaseArea::DOMStorageDatabaseArea(const string16& origin,
+                                               DOMStorageDatabase* database,
+                                               unsigned int quota)
+    : origin_(origin),
+      database_(database),
+      quota_(quota),
+      loaded_(false),
+      current_length_(0),
+      key_iterator_index_(0) {
+  DCHECK(database_.get());
+}
+
+DOMStorageDatabaseArea::~DOMStorageDatabaseArea() {
+}
+
+unsigned DOMStorageDatabaseArea::length() {
+  LoadIfNecessary();
+  return items_.size();
+}
+
+WebString DOMStorageDatabaseArea::key(unsigned index) {
+  LoadIfNecessary();
+  if (index >= items_.size())
+    return WebString();
+
+  // Restart from the beginning if moving backwards.
+  if (index < key_iterator_index_)
+    ResetKeyIterator();
+
+  while (key_iterator_index_ < index) {
+    ++key_iterator_;
+    ++key_iterator_index_;
+  }
+  return key_iterator_->first;
+}
+
+WebString DOMStorageDatabaseArea::getItem(const WebString& key) {
+  LoadIfNecessary();
+  DOMStorageDatabase::ItemMap::const_iterator it = items_.find(key);
+  if (it == items_.end())
+    return WebString();
+  return it->second;
+}
+
+void DOMStorageDatabaseArea::setItem(
+    const WebString& key, const WebString& value, const WebURL& url,
+    WebStorageArea::Result& result, WebString& old_value) {
+  LoadIfNecessary();
+
+  string16 key_str = key;
+  string16 value_str = value;
+
+  size_t new_length = current_length_;
+  DOMStorageDatabase::ItemMap::iterator it = items_.find(key_str);
+  if (it != items_.end()) {
+    old_value = it->second;
+    new_length -= it->second.length();
+  } else {
+    old_value = WebString();
+    new_length += key_str.length();
+  }
+  new_length += value_str.length();
+
+  // |quota_| is measured in bytes but lengths are measured in characters. This
+  // matches WebKit's StorageMap.
+  if (new_length > quota_ / sizeof(char16)) {
+    result = WebStorageArea::ResultBlockedByQuota;
+    return;
+  }
+
+  result = WebStorageArea::ResultOK;
+  if (it != items_.end() && it->second == value_str)
+    return;
+
+  items_[key_str] = value_str;
+  current_length_ = new_length;
+  ResetKeyIterator();
+  database_->SetItem(origin_, key_str, value_str);
+}
+
+void DOMStorageDatabaseArea::removeItem(
+    const WebString& key, const WebURL& url, WebString& old_value) {
+  LoadIfNecessary();
+
+  DOMStorageDatabase::ItemMap::iterator it = items_.find(key);
+  if (it == items_.end()) {
+    old_value = WebString();
+    return;
+  }
+
+  old_value = it->second;
+  current_length_ -= it->first.length() + it->second.length();
+  database_->RemoveItem(origin_, it->first);
+  items_.erase(it);
+  ResetKeyIterator();
+}
+
+void DOMStorageDatabaseArea::clear(const WebURL& url,
+                                   bool& cleared_something) {
+  LoadIfNecessary();
+
+  cleared_something = !items_.empty();
+  if (!cleared_something)
+    return;
+
+  items_.clear();
+  current_length_ = 0;
+  ResetKeyIterator();
+  database_->ClearOrigin(origin_);
+}
+
+void DOMStorageDatabaseArea::LoadIfNecessary() {
+  if (loaded_)
+    return;
+  loaded_ = true;
+
+  database_->ReadOrigin(origin_, &items_);
+
+  DOMStorageDatabase::ItemMap::const_iterator it = items_.begin();
+  for (; it != items_.end(); ++it)
+    current_length_ += it->first.length() + it->second.length();
+  ResetKeyIterator();
+}
+
+void DOMStorageDatabaseArea::ResetKeyIterator() {
+  key_iterator_ = items_.begin();
+  key_iterator_index_ = 0;
+}
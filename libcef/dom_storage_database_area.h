@@ -0,0 +1,64 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_DOM_STORAGE_DATABASE_AREA_H_
+#define CEF_LIBCEF_DOM_STORAGE_DATABASE_AREA_H_
+#pragma once
+
+#include "libcef/dom_storage_database.h"
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/string16.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/WebStorageArea.h"
+
+// A localStorage area that keeps its items in memory and writes changes to a
+// DOMStorageDatabase shared by all origins. Only use on the UI thread.
+class DOMStorageDatabaseArea : public WebKit::WebStorageArea {
+ public:
+  DOMStorageDatabaseArea(const string16& origin,
+                         DOMStorageDatabase* database,
+                         unsigned int quota);
+  virtual ~DOMStorageDatabaseArea();
+
+  // See WebStorageArea.h for documentation on these functions.
+  virtual unsigned length();
+  virtual WebKit::WebString key(unsigned index);
+  virtual WebKit::WebString getItem(const WebKit::WebString& key);
+  virtual void setItem(
+      const WebKit::WebString& key, const WebKit::WebString& value,
+      const WebKit::WebURL& url, WebStorageArea::Result& result,
+      WebKit::WebString& old_value);
+  virtual void removeItem(
+      const WebKit::WebString& key, const WebKit::WebURL& url,
+      WebKit::WebString& old_value);
+  virtual void clear(const WebKit::WebURL& url, bool& cleared_something);
+
+ private:
+  // Load the items from the database if necessary.
+  void LoadIfNecessary();
+
+  // Invalidate the cached iterator used by key().
+  void ResetKeyIterator();
+
+  string16 origin_;
+  scoped_refptr<DOMStorageDatabase> database_;
+
+  // Quota in bytes for the keys and values of this origin.
+  unsigned int quota_;
+
+  bool loaded_;
+  DOMStorageDatabase::ItemMap items_;
+
+  // Total number of characters in |items_|.
+  size_t current_length_;
+
+  // Cached position used to make sequential key() calls O(1).
+  DOMStorageDatabase::ItemMap::const_iterator key_iterator_;
+  unsigned key_iterator_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(DOMStorageDatabaseArea);
+};
+
+#endif  // CEF_LIBCEF_DOM_STORAGE_DATABASE_AREA_H_
@@ -5,6 +5,7 @@
 #include "libcef/dom_storage_namespace.h"
 #include "libcef/dom_storage_area.h"
 #include "libcef/dom_storage_context.h"
+#include "libcef/dom_storage_database_area.h"
 
 #include "base/file_path.h"
 #include "base/logging.h"
@@ -105,6 +106,16 @@ void DOMStorageNamespace::PurgeMemory() {
 
 WebStorageArea* DOMStorageNamespace::CreateWebStorageArea(
     const string16& origin) {
+  if (dom_storage_type_ == DOM_STORAGE_LOCAL) {
+    // Use the consolidated database, if any, instead of per-origin files.
+    DOMStorageDatabase* database =
+        dom_storage_context_->local_storage_database();
+    if (database) {
+      return new DOMStorageDatabaseArea(origin, database,
+          DOMStorageContext::local_storage_quota());
+    }
+  }
+
   CreateWebStorageNamespaceIfNecessary();
   return storage_namespace_->createStorageArea(origin);
 }
@@ -43,7 +43,7 @@ class DOMStorageNamespace {
 
   void PurgeMemory();
 
-  const DOMStorageContext* dom_storage_context() const {
+  DOMStorageContext* dom_storage_context() const {
     return dom_storage_context_;
   }
   int64 id() const { return id_; }
@@ -0,0 +1,438 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/scheme_handler_cache.h"
+
+#include <algorithm>
+
+#include "libcef/cef_thread.h"
+#include "libcef/response_impl.h"
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "base/pickle.h"
+#include "net/base/io_buffer.h"
+#include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/disk_cache/disk_cache.h"
+#include "net/http/http_cache.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_transaction_factory.h"
+#include "net/http/http_util.h"
+#include "net/url_request/url_request.h"
+#include "net/url_request/url_request_context.h"
+
+namespace {
+
+// Indices of the streams used by net::HttpCache entries.
+const int kResponseInfoIndex = 0;
+const int kResponseContentIndex = 1;
+
+// Responses larger than this value will not be written to the cache.
+const int64 kMaxCacheEntrySize = 5 * 1024 * 1024;
+
+net::HttpCache* GetHttpCache(net::URLRequest* request) {
+  const net::URLRequestContext* context = request->context();
+  if (!context || !context->http_transaction_factory())
+    return NULL;
+  return context->http_transaction_factory()->GetCache();
+}
+
+// Populate |response| from the cached |headers|.
+void SetResponseFromHeaders(net::HttpResponseHeaders* headers,
+                            CefRefPtr<CefResponse> response) {
+  response->SetStatus(headers->response_code());
+  response->SetStatusText(headers->GetStatusText());
+
+  std::string mime_type;
+  if (headers->GetMimeType(&mime_type))
+    response->SetMimeType(mime_type);
+
+  CefResponse::HeaderMap headerMap;
+  void* iter = NULL;
+  std::string name, value;
+  while (headers->EnumerateHeaderLines(&iter, &name, &value))
+    headerMap.insert(std::make_pair(name, value));
+  response->SetHeaderMap(headerMap);
+}
+
+}  // namespace
+
+// static
+bool CefSchemeHandlerCache::CanCache(net::URLRequest* request) {
+  if (request->method() != "GET" || request->has_upload())
+    return false;
+  if (request->load_flags() & net::LOAD_DISABLE_CACHE)
+    return false;
+  return (GetHttpCache(request) != NULL);
+}
+
+CefSchemeHandlerCache::CefSchemeHandlerCache(
+    net::URLRequest* request,
+    CefRefPtr<CefSchemeHandler> handler)
+  : handler_(handler),
+    http_cache_(GetHttpCache(request)),
+    key_(net::HttpUtil::SpecForRequest(request->url())),
+    load_flags_(request->load_flags()),
+    mode_(MODE_NONE),
+    handler_started_(false),
+    canceled_(false),
+    backend_(NULL),
+    entry_(NULL),
+    read_result_(0),
+    read_offset_(0),
+    expected_length_(-1) {
+  DCHECK(http_cache_);
+}
+
+CefSchemeHandlerCache::~CefSchemeHandlerCache() {
+  if (entry_)
+    entry_->Close();
+}
+
+bool CefSchemeHandlerCache::ProcessRequest(
+    CefRefPtr<CefRequest> request,
+    CefRefPtr<CefSchemeHandlerCallback> callback) {
+  REQUIRE_IOT();
+
+  request_ = request;
+  callback_ = callback;
+
+  int rv = http_cache_->GetBackend(&backend_,
+      base::Bind(&CefSchemeHandlerCache::OnBackendReady, this));
+  if (rv != net::ERR_IO_PENDING)
+    OnBackendReady(rv);
+  return true;
+}
+
+void CefSchemeHandlerCache::GetResponseHeaders(CefRefPtr<CefResponse> response,
+                                               int64& response_length,
+                                               CefString& redirectUrl) {
+  REQUIRE_IOT();
+
+  if (mode_ == MODE_READ) {
+    SetResponseFromHeaders(response_info_.headers, response);
+    response_length = entry_->GetDataSize(kResponseContentIndex);
+    return;
+  }
+
+  handler_->GetResponseHeaders(response, response_length, redirectUrl);
+
+  if (mode_ == MODE_VALIDATE) {
+    if (response->GetStatus() == 304 && redirectUrl.empty()) {
+      // The cached response is still valid. Merge the new headers into the
+      // cached headers and return the cached body.
+      scoped_refptr<net::HttpResponseHeaders> new_headers =
+          static_cast<CefResponseImpl*>(response.get())->GetResponseHeaders();
+      response_info_.headers->Update(*new_headers);
+      response_info_.request_time = request_time_;
+      response_info_.response_time = base::Time::Now();
+      WriteResponseInfo();
+
+      mode_ = MODE_READ;
+      SetResponseFromHeaders(response_info_.headers, response);
+      response_length = entry_->GetDataSize(kResponseContentIndex);
+      return;
+    }
+
+    // The cached response is no longer valid.
+    DoomEntry();
+    mode_ = MODE_WRITE;
+  }
+
+  if (mode_ == MODE_WRITE &&
+      !SetResponseInfo(response, response_length, redirectUrl)) {
+    mode_ = MODE_NONE;
+  }
+}
+
+bool CefSchemeHandlerCache::ReadResponse(
+    void* data_out,
+    int bytes_to_read,
+    int& bytes_read,
+    CefRefPtr<CefSchemeHandlerCallback> callback) {
+  REQUIRE_IOT();
+
+  if (mode_ == MODE_READ)
+    return ReadFromCache(data_out, bytes_to_read, bytes_read);
+
+  bool rv = handler_->ReadResponse(data_out, bytes_to_read, bytes_read,
+                                   callback);
+  if (mode_ != MODE_WRITE)
+    return rv;
+
+  if (rv && bytes_read > 0) {
+    int size = std::min(bytes_read, bytes_to_read);
+    if (static_cast<int64>(body_.size() + size) > kMaxCacheEntrySize) {
+      // The response is too large to cache.
+      mode_ = MODE_NONE;
+      body_.clear();
+      return rv;
+    }
+    body_.append(static_cast<char*>(data_out), size);
+
+    // The job stops reading once the expected number of bytes is received.
+    if (expected_length_ > 0 &&
+        static_cast<int64>(body_.size()) == expected_length_) {
+      WriteToCache();
+    }
+  } else if (!rv) {
+    if (expected_length_ < 0 ||
+        static_cast<int64>(body_.size()) == expected_length_) {
+      WriteToCache();
+    } else {
+      mode_ = MODE_NONE;
+    }
+  }
+
+  return rv;
+}
+
+void CefSchemeHandlerCache::Cancel() {
+  REQUIRE_IOT();
+
+  canceled_ = true;
+  mode_ = MODE_NONE;
+  body_.clear();
+  callback_ = NULL;
+
+  if (handler_started_)
+    handler_->Cancel();
+}
+
+void CefSchemeHandlerCache::OnBackendReady(int rv) {
+  if (canceled_)
+    return;
+
+  if (rv != net::OK || !backend_) {
+    backend_ = NULL;
+    StartHandler(MODE_NONE);
+    return;
+  }
+
+  if (load_flags_ & net::LOAD_BYPASS_CACHE) {
+    // Don't use the existing entry but write the new response.
+    StartHandler(MODE_WRITE);
+    return;
+  }
+
+  rv = backend_->OpenEntry(key_, &entry_,
+      base::Bind(&CefSchemeHandlerCache::OnEntryOpened, this));
+  if (rv != net::ERR_IO_PENDING)
+    OnEntryOpened(rv);
+}
+
+void CefSchemeHandlerCache::OnEntryOpened(int rv) {
+  if (canceled_)
+    return;
+
+  if (rv != net::OK) {
+    entry_ = NULL;
+    StartHandler(MODE_WRITE);
+    return;
+  }
+
+  int size = entry_->GetDataSize(kResponseInfoIndex);
+  if (size <= 0) {
+    DoomEntry();
+    StartHandler(MODE_WRITE);
+    return;
+  }
+
+  read_buffer_ = new net::IOBuffer(size);
+  rv = entry_->ReadData(kResponseInfoIndex, 0, read_buffer_, size,
+      base::Bind(&CefSchemeHandlerCache::OnResponseInfoRead, this));
+  if (rv != net::ERR_IO_PENDING)
+    OnResponseInfoRead(rv);
+}
+
+void CefSchemeHandlerCache::OnResponseInfoRead(int rv) {
+  if (canceled_)
+    return;
+
+  bool truncated = false;
+  bool valid = (rv > 0 && response_info_.InitFromPickle(
+      Pickle(read_buffer_->data(), rv), &truncated) && !truncated);
+  read_buffer_ = NULL;
+
+  if (!valid) {
+    DoomEntry();
+    StartHandler(MODE_WRITE);
+    return;
+  }
+
+  net::HttpResponseHeaders* headers = response_info_.headers;
+  if (!(load_flags_ & net::LOAD_VALIDATE_CACHE) &&
+      !headers->RequiresValidation(response_info_.request_time,
+                                   response_info_.response_time,
+                                   base::Time::Now())) {
+    // Return the cached response without calling the client handler.
+    mode_ = MODE_READ;
+    callback_->HeadersAvailable();
+    return;
+  }
+
+  std::string etag, last_modified;
+  headers->EnumerateHeader(NULL, "etag", &etag);
+  headers->EnumerateHeader(NULL, "last-modified", &last_modified);
+  if (etag.empty() && last_modified.empty()) {
+    // The cached response cannot be revalidated.
+    DoomEntry();
+    StartHandler(MODE_WRITE);
+    return;
+  }
+
+  CefRequest::HeaderMap headerMap;
+  request_->GetHeaderMap(headerMap);
+  if (!etag.empty()) {
+    headerMap.insert(
+        std::make_pair(net::HttpRequestHeaders::kIfNoneMatch, etag));
+  }
+  if (!last_modified.empty()) {
+    headerMap.insert(
+        std::make_pair(net::HttpRequestHeaders::kIfModifiedSince,
+                       last_modified));
+  }
+  request_->SetHeaderMap(headerMap);
+
+  StartHandler(MODE_VALIDATE);
+}
+
+void CefSchemeHandlerCache::OnEntryCreated(int rv) {
+  if (rv != net::OK) {
+    entry_ = NULL;
+    body_.clear();
+    return;
+  }
+
+  WriteResponseInfo();
+
+  scoped_refptr<net::StringIOBuffer> buffer = new net::StringIOBuffer(body_);
+  body_.clear();
+  rv = entry_->WriteData(kResponseContentIndex, 0, buffer, buffer->size(),
+      base::Bind(&CefSchemeHandlerCache::OnCacheWritten, this), true);
+  if (rv != net::ERR_IO_PENDING)
+    OnCacheWritten(rv);
+}
+
+void CefSchemeHandlerCache::OnCacheRead(int rv) {
+  read_result_ = rv;
+  if (!canceled_ && callback_.get())
+    callback_->BytesAvailable();
+}
+
+void CefSchemeHandlerCache::OnCacheWritten(int rv) {
+  if (rv < 0)
+    DoomEntry();
+}
+
+void CefSchemeHandlerCache::StartHandler(Mode mode) {
+  mode_ = mode;
+  handler_started_ = true;
+  request_time_ = base::Time::Now();
+
+  if (!handler_->ProcessRequest(request_, callback_)) {
+    // Cancel the request asynchronously because we already told the job that
+    // the request would be handled.
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(&CefSchemeHandlerCallback::Cancel, callback_.get()));
+  }
+}
+
+bool CefSchemeHandlerCache::SetResponseInfo(CefRefPtr<CefResponse> response,
+                                            int64 response_length,
+                                            const CefString& redirectUrl) {
+  if (!backend_ || !redirectUrl.empty() || response->GetStatus() != 200 ||
+      response_length == 0 || response_length > kMaxCacheEntrySize) {
+    return false;
+  }
+
+  scoped_refptr<net::HttpResponseHeaders> headers =
+      static_cast<CefResponseImpl*>(response.get())->GetResponseHeaders();
+  if (headers->HasHeaderValue("cache-control", "no-store") ||
+      headers->HasHeaderValue("pragma", "no-cache")) {
+    return false;
+  }
+
+  // The mime type is not part of the client response headers.
+  const std::string& mime_type = response->GetMimeType();
+  if (!mime_type.empty() && !headers->HasHeader("content-type"))
+    headers->AddHeader("Content-Type: " + mime_type);
+
+  response_info_ = net::HttpResponseInfo();
+  response_info_.headers = headers;
+  response_info_.request_time = request_time_;
+  response_info_.response_time = base::Time::Now();
+  expected_length_ = response_length;
+  return true;
+}
+
+bool CefSchemeHandlerCache::ReadFromCache(void* data_out, int bytes_to_read,
+                                          int& bytes_read) {
+  bytes_read = 0;
+
+  if (read_buffer_.get()) {
+    // Wait for the pending read to complete.
+    if (read_result_ == net::ERR_IO_PENDING)
+      return true;
+
+    int rv = read_result_;
+    if (rv <= 0) {
+      // All done or an error occurred.
+      read_buffer_ = NULL;
+      return false;
+    }
+
+    // Any bytes that don't fit will be read again on the next call.
+    int size = std::min(rv, bytes_to_read);
+    memcpy(data_out, read_buffer_->data(), size);
+    read_buffer_ = NULL;
+    read_offset_ += size;
+    bytes_read = size;
+    return true;
+  }
+
+  read_buffer_ = new net::IOBuffer(bytes_to_read);
+  read_result_ = entry_->ReadData(kResponseContentIndex, read_offset_,
+      read_buffer_, bytes_to_read,
+      base::Bind(&CefSchemeHandlerCache::OnCacheRead, this));
+  if (read_result_ == net::ERR_IO_PENDING)
+    return true;
+
+  // The read completed synchronously.
+  return ReadFromCache(data_out, bytes_to_read, bytes_read);
+}
+
+void CefSchemeHandlerCache::WriteToCache() {
+  mode_ = MODE_NONE;
+  DoomEntry();
+
+  int rv = backend_->CreateEntry(key_, &entry_,
+      base::Bind(&CefSchemeHandlerCache::OnEntryCreated, this));
+  if (rv != net::ERR_IO_PENDING)
+    OnEntryCreated(rv);
+}
+
+void CefSchemeHandlerCache::WriteResponseInfo() {
+  DCHECK(entry_);
+
+  Pickle pickle;
+  response_info_.Persist(&pickle, true, false);
+
+  scoped_refptr<net::StringIOBuffer> buffer = new net::StringIOBuffer(
+      std::string(static_cast<const char*>(pickle.data()), pickle.size()));
+  int rv = entry_->WriteData(kResponseInfoIndex, 0, buffer, buffer->size(),
+      base::Bind(&CefSchemeHandlerCache::OnCacheWritten, this), true);
+  if (rv != net::ERR_IO_PENDING)
+    OnCacheWritten(rv);
+}
+
+void CefSchemeHandlerCache::DoomEntry() {
+  if (entry_) {
+    entry_->Doom();
+    entry_->Close();
+    entry_ = NULL;
+  }
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_SCHEME_HANDLER_CACHE_H_
+#define CEF_LIBCEF_SCHEME_HANDLER_CACHE_H_
+#pragma once
+
+#include <string>
+
+#include "include/cef_scheme.h"
+#include "base/basictypes.h"
+#include "base/compiler_specific.h"
+#include "base/memory/ref_counted.h"
+#include "base/time.h"
+#include "net/http/http_response_info.h"
+
+namespace disk_cache {
+class Backend;
+class Entry;
+}
+namespace net {
+class HttpCache;
+class IOBuffer;
+class URLRequest;
+}
+
+// Wraps a client CefSchemeHandler so that its responses are stored in and
+// served from the request context's HTTP cache. Entries use the same key and
+// stream layout as net::HttpCache. Fresh entries are returned without calling
+// the client handler. Stale entries that have a validator are revalidated by
+// adding If-None-Match and If-Modified-Since headers to the request and the
+// cached body is returned if the client handler responds with a 304 status.
+// All methods must be called on the IO thread.
+class CefSchemeHandlerCache : public CefSchemeHandler {
+ public:
+  // Returns true if the response for |request| may be read from or written to
+  // the cache.
+  static bool CanCache(net::URLRequest* request);
+
+  CefSchemeHandlerCache(net::URLRequest* request,
+                        CefRefPtr<CefSchemeHandler> handler);
+  virtual ~CefSchemeHandlerCache();
+
+  // CefSchemeHandler methods.
+  virtual bool ProcessRequest(CefRefPtr<CefRequest> request,
+                              CefRefPtr<CefSchemeHandlerCallback> callback)
+                              OVERRIDE;
+  virtual void GetResponseHeaders(CefRefPtr<CefResponse> response,
+                                  int64& response_length,
+                                  CefString& redirectUrl) OVERRIDE;
+  virtual bool ReadResponse(void* data_out,
+                            int bytes_to_read,
+                            int& bytes_read,
+                            CefRefPtr<CefSchemeHandlerCallback> callback)
+                            OVERRIDE;
+  virtual void Cancel() OVERRIDE;
+
+  static bool ImplementsThreadSafeReferenceCounting() { return true; }
+
+ private:
+  enum Mode {
+    // The response is not cached.
+    MODE_NONE,
+    // The response is read from the cache entry.
+    MODE_READ,
+    // The client handler is revalidating the cache entry.
+    MODE_VALIDATE,
+    // The client handler response is written to the cache entry.
+    MODE_WRITE,
+  };
+
+  void OnBackendReady(int rv);
+  void OnEntryOpened(int rv);
+  void OnResponseInfoRead(int rv);
+  void OnEntryCreated(int rv);
+  void OnCacheRead(int rv);
+  void OnCacheWritten(int rv);
+
+  // Pass the request to the client handler.
+  void StartHandler(Mode mode);
+
+  // Returns false if |response| should not be written to the cache.
+  bool SetResponseInfo(CefRefPtr<CefResponse> response,
+                       int64 response_length,
+                       const CefString& redirectUrl);
+
+  bool ReadFromCache(void* data_out, int bytes_to_read, int& bytes_read);
+  void WriteToCache();
+  void WriteResponseInfo();
+  void DoomEntry();
+
+  CefRefPtr<CefSchemeHandler> handler_;
+  CefRefPtr<CefRequest> request_;
+  CefRefPtr<CefSchemeHandlerCallback> callback_;
+
+  net::HttpCache* http_cache_;
+  std::string key_;
+  int load_flags_;
+  Mode mode_;
+  bool handler_started_;
+  bool canceled_;
+
+  disk_cache::Backend* backend_;
+  disk_cache::Entry* entry_;
+  net::HttpResponseInfo response_info_;
+  base::Time request_time_;
+
+  // Used when reading from the cache entry.
+  scoped_refptr<net::IOBuffer> read_buffer_;
+  int read_result_;
+  int read_offset_;
+
+  // Used when writing the client handler response.
+  std::string body_;
+  int64 expected_length_;
+
+  IMPLEMENT_REFCOUNTING(CefSchemeHandlerCache);
+  DISALLOW_COPY_AND_ASSIGN(CefSchemeHandlerCache);
+};
+
+#endif  // CEF_LIBCEF_SCHEME_HANDLER_CACHE_H_
@@ -13,10 +13,13 @@
 #include "libcef/cef_thread.h"
 #include "libcef/request_impl.h"
 #include "libcef/response_impl.h"
+#include "libcef/scheme_handler_cache.h"
 
 #include "base/bind.h"
+#include "base/hash_tables.h"
 #include "base/lazy_instance.h"
 #include "base/logging.h"
+#include "base/memory/linked_ptr.h"
 #include "base/message_loop.h"
 #include "base/string_util.h"
 #include "base/synchronization/lock.h"
@@ -24,6 +27,7 @@
 #include "net/base/completion_callback.h"
 #include "net/base/cookie_monster.h"
 #include "net/base/io_buffer.h"
+#include "net/base/load_flags.h"
 #include "net/base/upload_data.h"
 #include "net/http/http_response_headers.h"
 #include "net/http/http_util.h"
@@ -97,7 +101,254 @@ std::string ToLower(const std::string& str) {
   std::string str_lower = str;
   std::transform(str_lower.begin(), str_lower.end(), str_lower.begin(),
       towlower);
-  return str;
+  return str_lower;
+}
+
+// Trie of handler factories keyed by URL path segments. A factory registered
+// for "/assets" will match "/assets" and "/assets/img/logo.png" but not
+// "/assetsfoo". The factory registered for the root matches all paths.
+class PathRouteTable {
+ public:
+  PathRouteTable() {}
+
+  void Set(const std::string& path,
+           CefRefPtr<CefSchemeHandlerFactory> factory) {
+    Node* node = &root_;
+    size_t pos = 0;
+    std::string segment;
+    while (NextSegment(path, &pos, &segment)) {
+      linked_ptr<Node>& child = node->children[segment];
+      if (!child.get())
+        child.reset(new Node());
+      node = child.get();
+    }
+    node->factory = factory;
+  }
+
+  void Remove(const std::string& path) {
+    RemoveFrom(&root_, path, 0);
+  }
+
+  // Returns the factory registered for the longest matching prefix of |path|.
+  CefRefPtr<CefSchemeHandlerFactory> Find(const std::string& path) const {
+    const Node* node = &root_;
+    CefRefPtr<CefSchemeHandlerFactory> factory = node->factory;
+    size_t pos = 0;
+    std::string segment;
+    while (NextSegment(path, &pos, &segment)) {
+      Node::ChildMap::const_iterator it = node->children.find(segment);
+      if (it == node->children.end())
+        break;
+      node = it->second.get();
+      if (node->factory.get())
+        factory = node->factory;
+    }
+    return factory;
+  }
+
+  bool empty() const {
+    return !root_.factory.get() && root_.children.empty();
+  }
+
+ private:
+  struct Node {
+    typedef base::hash_map<std::string, linked_ptr<Node> > ChildMap;
+    CefRefPtr<CefSchemeHandlerFactory> factory;
+    ChildMap children;
+  };
+
+  // Extract the next non-empty segment of |path| starting at |*pos|. Returns
+  // false when no segments remain.
+  static bool NextSegment(const std::string& path, size_t* pos,
+                          std::string* segment) {
+    while (*pos < path.size() && path[*pos] == '/')
+      ++(*pos);
+    if (*pos >= path.size())
+      return false;
+    size_t end = path.find('/', *pos);
+    if (end == std::string::npos)
+      end = path.size();
+    segment->assign(path, *pos, end - *pos);
+    *pos = end;
+    return true;
+  }
+
+  // Remove the factory for |path| and prune nodes that no longer lead to a
+  // factory. Returns true if |node| is now empty.
+  static bool RemoveFrom(Node* node, const std::string& path, size_t pos) {
+    std::string segment;
+    if (!NextSegment(path, &pos, &segment)) {
+      node->factory = NULL;
+    } else {
+      Node::ChildMap::iterator it = node->children.find(segment);
+      if (it != node->children.end() &&
+          RemoveFrom(it->second.get(), path, pos)) {
+        node->children.erase(it);
+      }
+    }
+    return !node->factory.get() && node->children.empty();
+  }
+
+  Node root_;
+
+  DISALLOW_COPY_AND_ASSIGN(PathRouteTable);
+};
+
+// Routing table for the handler factories of a single scheme. Host names are
+// stored in a trie keyed by labels in reverse order ("a.example.com" is stored
+// as "com" -> "example" -> "a") so that the cost of a lookup is proportional
+// to the length of the request URL and not the number of registrations.
+// Matching prefers, in order, an exact host match, the most specific wildcard
+// ("*.example.com") match and finally the factory registered with no domain.
+// If the preferred host match has no factory for the request path the next
+// less specific host match is tried.
+class DomainRouteTable {
+ public:
+  DomainRouteTable() {}
+
+  // |domain| may be empty to match all hosts and may start with "*." to match
+  // all sub-domains of the remaining host name.
+  void Set(const std::string& domain, const std::string& path,
+           CefRefPtr<CefSchemeHandlerFactory> factory) {
+    std::string host;
+    bool wildcard = false;
+    ParseDomain(domain, &host, &wildcard);
+
+    Node* node = &root_;
+    size_t end = host.size();
+    while (end > 0) {
+      size_t start = host.rfind('.', end - 1);
+      start = (start == std::string::npos) ? 0 : start + 1;
+
+      linked_ptr<Node>& child =
+          node->children[host.substr(start, end - start)];
+      if (!child.get())
+        child.reset(new Node());
+      node = child.get();
+
+      if (start == 0)
+        break;
+      end = start - 1;
+    }
+
+    (wildcard ? node->wildcard : node->exact).Set(path, factory);
+  }
+
+  void Remove(const std::string& domain, const std::string& path) {
+    std::string host;
+    bool wildcard = false;
+    ParseDomain(domain, &host, &wildcard);
+    RemoveFrom(&root_, host, host.size(), wildcard, path);
+  }
+
+  CefRefPtr<CefSchemeHandlerFactory> Find(const std::string& host,
+                                          const std::string& path) const {
+    // Candidate tables ordered from least to most specific.
+    std::vector<const PathRouteTable*> candidates;
+    candidates.push_back(&root_.exact);
+
+    const Node* node = &root_;
+    size_t end = host.size();
+    while (node && end > 0) {
+      size_t start = host.rfind('.', end - 1);
+      start = (start == std::string::npos) ? 0 : start + 1;
+
+      Node::ChildMap::const_iterator it =
+          node->children.find(host.substr(start, end - start));
+      node = (it == node->children.end()) ? NULL : it->second.get();
+      if (!node)
+        break;
+
+      if (start == 0) {
+        candidates.push_back(&node->exact);
+        break;
+      }
+      if (!node->wildcard.empty())
+        candidates.push_back(&node->wildcard);
+      end = start - 1;
+    }
+
+    std::vector<const PathRouteTable*>::const_reverse_iterator it =
+        candidates.rbegin();
+    for (; it != candidates.rend(); ++it) {
+      CefRefPtr<CefSchemeHandlerFactory> factory = (*it)->Find(path);
+      if (factory.get())
+        return factory;
+    }
+    return NULL;
+  }
+
+  bool empty() const {
+    return root_.empty();
+  }
+
+ private:
+  struct Node {
+    typedef base::hash_map<std::string, linked_ptr<Node> > ChildMap;
+
+    bool empty() const {
+      return exact.empty() && wildcard.empty() && children.empty();
+    }
+
+    PathRouteTable exact;
+    PathRouteTable wildcard;
+    ChildMap children;
+  };
+
+  // Split |domain| into the host name and a flag that is true if |domain| is
+  // a wildcard pattern. The host name is empty if |domain| matches all hosts.
+  static void ParseDomain(const std::string& domain, std::string* host,
+                          bool* wildcard) {
+    *host = domain;
+    *wildcard = false;
+    if (*host == "*") {
+      host->clear();
+    } else if (StartsWithASCII(*host, "*.", true)) {
+      *host = host->substr(2);
+      *wildcard = true;
+    }
+  }
+
+  // Remove the factory for |path| from the node for the first |end| characters
+  // of |host| and prune nodes that no longer lead to a factory. Returns true
+  // if |node| is now empty.
+  static bool RemoveFrom(Node* node, const std::string& host, size_t end,
+                         bool wildcard, const std::string& path) {
+    if (end == 0) {
+      (wildcard ? node->wildcard : node->exact).Remove(path);
+    } else {
+      size_t start = host.rfind('.', end - 1);
+      start = (start == std::string::npos) ? 0 : start + 1;
+
+      Node::ChildMap::iterator it =
+          node->children.find(host.substr(start, end - start));
+      if (it != node->children.end() &&
+          RemoveFrom(it->second.get(), host, start == 0 ? 0 : start - 1,
+                     wildcard, path)) {
+        node->children.erase(it);
+      }
+    }
+    return node->empty();
+  }
+
+  Node root_;
+
+  DISALLOW_COPY_AND_ASSIGN(DomainRouteTable);
+};
+
+// Split a factory registration |domain_name| of the form "host/path/prefix"
+// into its host and path components. The host is converted to lower case but
+// the path is left unchanged because URL paths are case-sensitive.
+void ParseDomainName(const std::string& domain_name, std::string* domain,
+                     std::string* path) {
+  size_t pos = domain_name.find('/');
+  if (pos == std::string::npos) {
+    *domain = ToLower(domain_name);
+    path->clear();
+  } else {
+    *domain = ToLower(domain_name.substr(0, pos));
+    *path = domain_name.substr(pos);
+  }
 }
 
 
@@ -105,9 +356,11 @@ std::string ToLower(const std::string& str) {
 class CefUrlRequestJob : public net::URLRequestJob {
  public:
   CefUrlRequestJob(net::URLRequest* request,
-                   CefRefPtr<CefSchemeHandler> handler)
+                   CefRefPtr<CefSchemeHandler> handler,
+                   bool cookies_enabled)
     : net::URLRequestJob(request),
       handler_(handler),
+      cookies_enabled_(cookies_enabled),
       remaining_bytes_(0),
       response_cookies_save_index_(0),
       ALLOW_THIS_IN_INITIALIZER_LIST(weak_factory_(this)) {
@@ -176,8 +429,9 @@ class CefUrlRequestJob : public net::URLRequestJob {
     if (!request_)
       return;
 
-    net::CookieStore* cookie_store =
-        request_->context()->cookie_store();
+    net::CookieStore* cookie_store = NULL;
+    if (ShouldSendCookies())
+      cookie_store = request_->context()->cookie_store();
     if (cookie_store) {
       net::CookieMonster* cookie_monster = cookie_store->GetCookieMonster();
       if (cookie_monster) {
@@ -391,7 +645,8 @@ class CefUrlRequestJob : public net::URLRequestJob {
     response_cookies_.clear();
     response_cookies_save_index_ = 0;
 
-    FetchResponseCookies(&response_cookies_);
+    if (ShouldSaveCookies())
+      FetchResponseCookies(&response_cookies_);
 
     // Now, loop over the response cookies, and attempt to persist each.
     SaveNextCookie();
@@ -438,6 +693,19 @@ class CefUrlRequestJob : public net::URLRequestJob {
     }
   }
 
+  // Cookies are skipped entirely if disabled for the scheme or if the request
+  // load flags opt out of sending or saving them.
+  bool ShouldSendCookies() const {
+    return cookies_enabled_ &&
+           !(request_->load_flags() & net::LOAD_DO_NOT_SEND_COOKIES);
+  }
+
+  bool ShouldSaveCookies() const {
+    return cookies_enabled_ &&
+           !(request_->load_flags() & net::LOAD_DO_NOT_SAVE_COOKIES) &&
+           request_->context()->cookie_store();
+  }
+
   void FetchResponseCookies(
       std::vector<std::string>* cookies) {
     const std::string name = "Set-Cookie";
@@ -536,6 +804,7 @@ class CefUrlRequestJob : public net::URLRequestJob {
     IMPLEMENT_REFCOUNTING(Callback);
   };
 
+  bool cookies_enabled_;
   GURL redirect_url_;
   int64 remaining_bytes_;
   CefRefPtr<CefRequest> cef_request_;
@@ -588,13 +857,19 @@ class CefUrlRequestManager {
     REQUIRE_IOT();
 
     std::string scheme_lower = ToLower(scheme);
-    std::string domain_lower = ToLower(domain);
+    std::string domain_lower, path;
+    ParseDomainName(domain, &domain_lower, &path);
 
-    // Hostname is only supported for standard schemes.
-    if (!IsStandardScheme(scheme_lower))
+    // Hostname and path are only supported for standard schemes.
+    if (!IsStandardScheme(scheme_lower)) {
       domain_lower.clear();
+      path.clear();
+    }
 
-    handler_map_[make_pair(scheme_lower, domain_lower)] = factory;
+    linked_ptr<DomainRouteTable>& table = handler_map_[scheme_lower];
+    if (!table.get())
+      table.reset(new DomainRouteTable());
+    table->Set(domain_lower, path, factory);
 
     net::URLRequestJobFactory* job_factory =
         const_cast<net::URLRequestJobFactory*>(
@@ -611,16 +886,29 @@ class CefUrlRequestManager {
     REQUIRE_IOT();
 
     std::string scheme_lower = ToLower(scheme);
-    std::string domain_lower = ToLower(domain);
+    std::string domain_lower, path;
+    ParseDomainName(domain, &domain_lower, &path);
 
-    // Hostname is only supported for standard schemes.
-    if (!IsStandardScheme(scheme_lower))
+    // Hostname and path are only supported for standard schemes.
+    if (!IsStandardScheme(scheme_lower)) {
       domain_lower.clear();
+      path.clear();
+    }
+
+    HandlerMap::iterator iter = handler_map_.find(scheme_lower);
+    if (iter == handler_map_.end())
+      return;
 
-    HandlerMap::iterator iter =
-        handler_map_.find(make_pair(scheme_lower, domain_lower));
-    if (iter != handler_map_.end())
+    iter->second->Remove(domain_lower, path);
+
+    if (iter->second->empty()) {
+      // Unregister the scheme when its last factory is removed.
+      net::URLRequestJobFactory* job_factory =
+          const_cast<net::URLRequestJobFactory*>(
+              _Context->request_context()->job_factory());
+      job_factory->SetProtocolHandler(scheme_lower, NULL);
       handler_map_.erase(iter);
+    }
   }
 
   // Clear all the existing URL handlers and unregister the ProtocolFactory.
@@ -632,14 +920,9 @@ class CefUrlRequestManager {
             _Context->request_context()->job_factory());
 
     // Unregister with the ProtocolFactory.
-    std::set<std::string> schemes;
     for (HandlerMap::const_iterator i = handler_map_.begin();
         i != handler_map_.end(); ++i) {
-      schemes.insert(i->first.first);
-    }
-    for (std::set<std::string>::const_iterator scheme = schemes.begin();
-        scheme != schemes.end(); ++scheme) {
-      job_factory->SetProtocolHandler(*scheme, NULL);
+      job_factory->SetProtocolHandler(i->first, NULL);
     }
 
     handler_map_.clear();
@@ -659,6 +942,28 @@ class CefUrlRequestManager {
     return registered;
   }
 
+  // Enable or disable cookie handling for requests with the specified scheme.
+  void SetCookiesEnabled(const std::string& scheme, bool enabled) {
+    REQUIRE_IOT();
+
+    std::string scheme_lower = ToLower(scheme);
+    if (enabled)
+      cookieless_scheme_set_.erase(scheme_lower);
+    else
+      cookieless_scheme_set_.insert(scheme_lower);
+  }
+
+  // Enable or disable HTTP caching for requests with the specified scheme.
+  void SetCacheEnabled(const std::string& scheme, bool enabled) {
+    REQUIRE_IOT();
+
+    std::string scheme_lower = ToLower(scheme);
+    if (enabled)
+      cached_scheme_set_.insert(scheme_lower);
+    else
+      cached_scheme_set_.erase(scheme_lower);
+  }
+
   // Register a scheme.
   bool RegisterScheme(const std::string& scheme,
                       bool is_standard,
@@ -694,26 +999,17 @@ class CefUrlRequestManager {
   // lower case.
   CefRefPtr<CefSchemeHandlerFactory> GetHandlerFactory(
       net::URLRequest* request, const std::string& scheme) {
-    CefRefPtr<CefSchemeHandlerFactory> factory;
+    HandlerMap::const_iterator i = handler_map_.find(scheme);
+    if (i == handler_map_.end())
+      return NULL;
 
     if (request->url().is_valid() && IsStandardScheme(scheme)) {
-      // Check for a match with a domain first.
-      const std::string& domain = request->url().host();
-
-      HandlerMap::iterator i = handler_map_.find(make_pair(scheme, domain));
-      if (i != handler_map_.end())
-        factory = i->second;
-    }
-
-    if (!factory.get()) {
-      // Check for a match with no specified domain.
-      HandlerMap::iterator i =
-          handler_map_.find(make_pair(scheme, std::string()));
-      if (i != handler_map_.end())
-        factory = i->second;
+      // Match against the domain and path.
+      return i->second->Find(request->url().host(), request->url().path());
     }
 
-    return factory;
+    // Check for a match with no specified domain.
+    return i->second->Find(std::string(), std::string());
   }
 
   // Create the job that will handle the request. |scheme| will already be in
@@ -731,8 +1027,16 @@ class CefUrlRequestManager {
           BrowserResourceLoaderBridge::GetBrowserForRequest(request);
       CefRefPtr<CefSchemeHandler> handler =
           factory->Create(browser.get(), scheme, requestPtr);
-      if (handler.get())
-        job = new CefUrlRequestJob(request, handler);
+      if (handler.get()) {
+        if (cached_scheme_set_.find(scheme) != cached_scheme_set_.end() &&
+            CefSchemeHandlerCache::CanCache(request)) {
+          // Store and serve the response using the HTTP cache.
+          handler = new CefSchemeHandlerCache(request, handler);
+        }
+        job = new CefUrlRequestJob(request, handler,
+            cookieless_scheme_set_.find(scheme) ==
+                cookieless_scheme_set_.end());
+      }
     }
 
     if (!job && IsBuiltinScheme(scheme)) {
@@ -748,14 +1052,23 @@ class CefUrlRequestManager {
     return job;
   }
 
-  // Map (scheme, domain) to factories. This map will only be accessed on the IO
-  // thread.
-  typedef std::map<std::pair<std::string, std::string>,
-      CefRefPtr<CefSchemeHandlerFactory> > HandlerMap;
+  // Map scheme to the routing table of (domain, path) factories. This map will
+  // only be accessed on the IO thread. Registration requests from other threads
+  // are posted to the IO thread so that lookups never wait on a lock.
+  typedef base::hash_map<std::string, linked_ptr<DomainRouteTable> >
+      HandlerMap;
   HandlerMap handler_map_;
 
-  // Set of registered schemes. This set may be accessed from multiple threads.
+  // Set of schemes for which cookies are disabled. This set will only be
+  // accessed on the IO thread.
   typedef std::set<std::string> SchemeSet;
+  SchemeSet cookieless_scheme_set_;
+
+  // Set of schemes for which responses are cached. This set will only be
+  // accessed on the IO thread.
+  SchemeSet cached_scheme_set_;
+
+  // Set of registered schemes. This set may be accessed from multiple threads.
   SchemeSet scheme_set_;
   base::Lock scheme_set_lock_;
 
@@ -840,3 +1153,40 @@ bool CefClearSchemeHandlerFactories() {
 
   return true;
 }
+
+bool CefSetSchemeCookiesEnabled(const CefString& scheme_name, bool enabled) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    CefUrlRequestManager::GetInstance()->SetCookiesEnabled(scheme_name,
+                                                           enabled);
+  } else {
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(base::IgnoreResult(&CefSetSchemeCookiesEnabled),
+                   scheme_name, enabled));
+  }
+
+  return true;
+}
+
+bool CefSetSchemeCacheEnabled(const CefString& scheme_name, bool enabled) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::IO)) {
+    CefUrlRequestManager::GetInstance()->SetCacheEnabled(scheme_name, enabled);
+  } else {
+    CefThread::PostTask(CefThread::IO, FROM_HERE,
+        base::Bind(base::IgnoreResult(&CefSetSchemeCacheEnabled),
+                   scheme_name, enabled));
+  }
+
+  return true;
+}
@@ -0,0 +1,144 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/storage_change_dispatcher.h"
+#include "libcef/cef_thread.h"
+
+#include "base/bind.h"
+#include "base/compiler_specific.h"
+#include "base/logging.h"
+
+namespace {
+
+// Implementation of the CefStorageChanges interface.
+class CefStorageChangesImpl : public CefStorageChanges {
+ public:
+  explicit CefStorageChangesImpl(StorageChangeDispatcher::ChangeList& changes) {
+    changes_.swap(changes);
+  }
+
+  virtual int GetCount() OVERRIDE {
+    return static_cast<int>(changes_.size());
+  }
+
+  virtual CefStorageType GetStorageType(int index) OVERRIDE {
+    if (!IsValidIndex(index))
+      return ST_LOCALSTORAGE;
+    return changes_[index].storage_type;
+  }
+
+  virtual CefStorageChangeType GetChangeType(int index) OVERRIDE {
+    if (!IsValidIndex(index))
+      return SCT_SET;
+    return changes_[index].change_type;
+  }
+
+  virtual CefString GetOrigin(int index) OVERRIDE {
+    if (!IsValidIndex(index))
+      return CefString();
+    return changes_[index].origin;
+  }
+
+  virtual CefString GetKey(int index) OVERRIDE {
+    if (!IsValidIndex(index))
+      return CefString();
+    return changes_[index].key;
+  }
+
+  virtual CefString GetOldValue(int index) OVERRIDE {
+    if (!IsValidIndex(index))
+      return CefString();
+    return changes_[index].old_value;
+  }
+
+  virtual CefString GetNewValue(int index) OVERRIDE {
+    if (!IsValidIndex(index))
+      return CefString();
+    return changes_[index].new_value;
+  }
+
+ private:
+  bool IsValidIndex(int index) const {
+    return (index >= 0 && index < static_cast<int>(changes_.size()));
+  }
+
+  StorageChangeDispatcher::ChangeList changes_;
+
+  IMPLEMENT_REFCOUNTING(CefStorageChangesImpl);
+};
+
+}  // namespace
+
+StorageChangeDispatcher::StorageChangeDispatcher()
+    : ALLOW_THIS_IN_INITIALIZER_LIST(weak_ptr_factory_(this)) {
+}
+
+StorageChangeDispatcher::~StorageChangeDispatcher() {
+}
+
+void StorageChangeDispatcher::AddObserver(
+    int observer_id, CefRefPtr<CefStorageObserver> observer) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+  DCHECK(observers_.find(observer_id) == observers_.end());
+  observers_[observer_id] = observer;
+}
+
+void StorageChangeDispatcher::RemoveObserver(int observer_id) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+  observers_.erase(observer_id);
+}
+
+void StorageChangeDispatcher::OnStorageChanged(
+    DOMStorageType type,
+    CefStorageChangeType change_type,
+    const string16& origin,
+    const string16& key,
+    const NullableString16& old_value,
+    const NullableString16& new_value) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  if (observers_.empty())
+    return;
+
+  Change change;
+  change.storage_type =
+      (type == DOM_STORAGE_LOCAL ? ST_LOCALSTORAGE : ST_SESSIONSTORAGE);
+  change.change_type = change_type;
+  change.origin = origin;
+  if (change_type != SCT_CLEAR) {
+    change.key = key;
+    if (!old_value.is_null())
+      change.old_value = old_value.string();
+    if (!new_value.is_null())
+      change.new_value = new_value.string();
+  }
+
+  pending_.push_back(change);
+
+  if (pending_.size() == 1) {
+    // Deliver the changes after the current task completes.
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&StorageChangeDispatcher::DispatchChanges,
+                   weak_ptr_factory_.GetWeakPtr()));
+  }
+}
+
+void StorageChangeDispatcher::DispatchChanges() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  if (pending_.empty())
+    return;
+
+  CefRefPtr<CefStorageChanges> changes(new CefStorageChangesImpl(pending_));
+  DCHECK(pending_.empty());
+
+  // Copy the map in case an observer is added or removed during notification.
+  // Observers that have been removed are skipped.
+  ObserverMap observers(observers_);
+  ObserverMap::const_iterator it = observers.begin();
+  for (; it != observers.end(); ++it) {
+    if (observers_.find(it->first) != observers_.end())
+      it->second->OnStorageChanged(changes);
+  }
+}
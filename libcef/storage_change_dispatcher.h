@@ -0,0 +1,71 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_STORAGE_CHANGE_DISPATCHER_H_
+#define CEF_LIBCEF_STORAGE_CHANGE_DISPATCHER_H_
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "include/cef_storage.h"
+#include "libcef/dom_storage_common.h"
+
+#include "base/basictypes.h"
+#include "base/memory/weak_ptr.h"
+#include "base/nullable_string16.h"
+#include "base/string16.h"
+
+// Collects storage changes and delivers them to the registered
+// CefStorageObserver objects. Changes made during a single UI thread task are
+// delivered together from a subsequent task. Only use on the UI thread.
+class StorageChangeDispatcher {
+ public:
+  struct Change {
+    CefStorageType storage_type;
+    CefStorageChangeType change_type;
+    string16 origin;
+    string16 key;
+    string16 old_value;
+    string16 new_value;
+  };
+  typedef std::vector<Change> ChangeList;
+
+  StorageChangeDispatcher();
+  ~StorageChangeDispatcher();
+
+  // Observers are identified by the id returned from CefAddStorageObserver()
+  // because the same client object may be represented by a different wrapper
+  // object each time it crosses the DLL boundary.
+  void AddObserver(int observer_id, CefRefPtr<CefStorageObserver> observer);
+  void RemoveObserver(int observer_id);
+
+  // Returns true if any observers are registered. Changes do not need to be
+  // reported if this method returns false.
+  bool HasObservers() const { return !observers_.empty(); }
+
+  // Record a change to the storage area for |origin|. |key|, |old_value| and
+  // |new_value| are ignored for SCT_CLEAR changes.
+  void OnStorageChanged(DOMStorageType type,
+                        CefStorageChangeType change_type,
+                        const string16& origin,
+                        const string16& key,
+                        const NullableString16& old_value,
+                        const NullableString16& new_value);
+
+ private:
+  // Deliver the pending changes to all observers.
+  void DispatchChanges();
+
+  typedef std::map<int, CefRefPtr<CefStorageObserver> > ObserverMap;
+  ObserverMap observers_;
+
+  ChangeList pending_;
+
+  base::WeakPtrFactory<StorageChangeDispatcher> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(StorageChangeDispatcher);
+};
+
+#endif  // CEF_LIBCEF_STORAGE_CHANGE_DISPATCHER_H_
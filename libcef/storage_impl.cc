@@ -2,18 +2,39 @@
 // reserved. Use of this source code is governed by a BSD-style license that can
 // be found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "include/cef_storage.h"
 #include "libcef/cef_context.h"
 #include "libcef/cef_thread.h"
 #include "libcef/dom_storage_common.h"
 #include "libcef/dom_storage_namespace.h"
 #include "libcef/dom_storage_area.h"
+#include "libcef/storage_change_dispatcher.h"
+
+#include "base/atomic_sequence_num.h"
 
 namespace {
 
-void UIT_VisitStorage(int64 namespace_id, const CefString& origin,
-                      const CefString& key,
-                      CefRefPtr<CefStorageVisitor> visitor) {
+// Default number of key/value pairs delivered to a CefStorageBatchVisitor.
+const int kDefaultBatchSize = 100;
+
+// Snapshot of the key/value pairs for a single storage area.
+struct AreaSnapshot {
+  DOMStorageArea* area;
+  string16 origin;
+  DOMStorageArea::ItemList items;
+};
+typedef std::vector<AreaSnapshot> AreaSnapshotList;
+
+// Take a snapshot of the areas in |namespace_id| matching |origin| and |key|.
+// If |origin| is empty all areas will be included. If |key| is empty all
+// pairs will be included. Returns the total number of pairs.
+unsigned int UIT_GetStorageSnapshots(int64 namespace_id,
+                                     const string16& origin,
+                                     const string16& key,
+                                     AreaSnapshotList& snapshots) {
   REQUIRE_UIT();
 
   DOMStorageContext* context = _Context->storage_context();
@@ -25,7 +46,7 @@ void UIT_VisitStorage(int64 namespace_id, const CefString& origin,
   DOMStorageNamespace* ns =
       context->GetStorageNamespace(namespace_id, allocation_allowed);
   if (!ns)
-    return;
+    return 0;
 
   typedef std::vector<DOMStorageArea*> AreaList;
   AreaList areas;
@@ -40,96 +61,231 @@ void UIT_VisitStorage(int64 namespace_id, const CefString& origin,
     ns->GetStorageAreas(areas, true);
   }
 
-  if (areas.empty())
-    return;
-
-  // Count the total number of matching keys.
   unsigned int total = 0;
-  {
-    NullableString16 value;
-    AreaList::iterator it = areas.begin();
-    for (; it != areas.end(); ) {
-      DOMStorageArea* area = (*it);
-      if (!key.empty()) {
-        value = area->GetItem(key);
-        if (value.is_null()) {
-          it = areas.erase(it);
-          // Don't increment the iterator.
-          continue;
-        } else {
-          total++;
-        }
-      } else {
-        total += area->Length();
-      }
-      ++it;
+  AreaList::const_iterator it = areas.begin();
+  for (; it != areas.end(); ++it) {
+    AreaSnapshot snapshot;
+    snapshot.area = *it;
+    snapshot.origin = (*it)->origin();
+
+    if (!key.empty()) {
+      // Include only the matching key.
+      NullableString16 value = (*it)->GetItem(key);
+      if (value.is_null())
+        continue;
+      snapshot.items.push_back(std::make_pair(key, value.string()));
+    } else {
+      (*it)->GetSnapshot(&snapshot.items);
+      if (snapshot.items.empty())
+        continue;
     }
+
+    total += snapshot.items.size();
+    snapshots.push_back(snapshot);
   }
 
+  return total;
+}
+
+void UIT_VisitStorage(int64 namespace_id, const CefString& origin,
+                      const CefString& key,
+                      CefRefPtr<CefStorageVisitor> visitor) {
+  REQUIRE_UIT();
+
+  AreaSnapshotList snapshots;
+  unsigned int total =
+      UIT_GetStorageSnapshots(namespace_id, origin, key, snapshots);
   if (total == 0)
     return;
 
-  DOMStorageArea* area;
   bool stop = false, deleteData;
-  unsigned int count = 0, i, len;
-  NullableString16 keyVal, valueVal;
-  string16 keyStr, valueStr;
+  unsigned int count = 0;
   typedef std::vector<string16> String16List;
   String16List delete_keys;
 
   // Visit all matching pairs.
-  AreaList::iterator it = areas.begin();
-  for (; it != areas.end() && !stop; ++it) {
-    // Each area.
-    area = *(it);
-    if (!key.empty()) {
-      // Visit only the matching key.
-      valueVal = area->GetItem(key);
-      if (valueVal.is_null())
-        valueStr.clear();
-      else
-        valueStr = valueVal.string();
-
+  AreaSnapshotList::const_iterator it = snapshots.begin();
+  for (; it != snapshots.end() && !stop; ++it) {
+    const DOMStorageArea::ItemList& items = it->items;
+    DOMStorageArea::ItemList::const_iterator item = items.begin();
+    for (; item != items.end() && !stop; ++item) {
       deleteData = false;
       stop = !visitor->Visit(static_cast<CefStorageType>(namespace_id),
-          area->origin(), key, valueStr, count, total, deleteData);
+          it->origin, item->first, item->second, count, total, deleteData);
       if (deleteData)
-        area->RemoveItem(key);
+        delete_keys.push_back(item->first);
       count++;
-    } else {
-      // Visit all keys.
-      len = area->Length();
-      for (i = 0; i < len && !stop; ++i) {
-        keyVal = area->Key(i);
-        if (keyVal.is_null()) {
-          keyStr.clear();
-          valueStr.clear();
-        } else {
-          keyStr = keyVal.string();
-          valueVal = area->GetItem(keyStr);
-          if (valueVal.is_null())
-            valueStr.clear();
-          else
-            valueStr = valueVal.string();
-        }
-
-        deleteData = false;
-        stop = !visitor->Visit(static_cast<CefStorageType>(namespace_id),
-            area->origin(), keyStr, valueStr, count, total, deleteData);
-        if (deleteData)
-          delete_keys.push_back(keyStr);
-        count++;
-      }
+    }
 
-      // Delete the requested keys.
-      if (!delete_keys.empty()) {
-        String16List::const_iterator it = delete_keys.begin();
-        for (; it != delete_keys.end(); ++it)
-          area->RemoveItem(*it);
-        delete_keys.clear();
-      }
+    // Delete the requested keys.
+    if (!delete_keys.empty()) {
+      String16List::const_iterator key_it = delete_keys.begin();
+      for (; key_it != delete_keys.end(); ++key_it)
+        it->area->RemoveItem(*key_it);
+      delete_keys.clear();
+    }
+  }
+}
+
+// Delivers a storage snapshot to a CefStorageBatchVisitor one batch per task.
+class VisitStorageBatchesHelper
+    : public base::RefCounted<VisitStorageBatchesHelper> {
+ public:
+  VisitStorageBatchesHelper(int64 namespace_id,
+                            int batch_size,
+                            CefRefPtr<CefStorageBatchVisitor> visitor)
+    : namespace_id_(namespace_id),
+      batch_size_(batch_size),
+      visitor_(visitor),
+      area_index_(0),
+      item_index_(0),
+      count_(0),
+      total_(0) {
+  }
+
+  void Start(const CefString& origin) {
+    REQUIRE_UIT();
+    total_ = UIT_GetStorageSnapshots(namespace_id_, origin, string16(),
+                                     snapshots_);
+    // The areas may change before the remaining batches are delivered.
+    AreaSnapshotList::iterator it = snapshots_.begin();
+    for (; it != snapshots_.end(); ++it)
+      it->area = NULL;
+
+    if (total_ > 0)
+      VisitNextBatch();
+  }
+
+ private:
+  void VisitNextBatch() {
+    REQUIRE_UIT();
+
+    const AreaSnapshot& snapshot = snapshots_[area_index_];
+    const DOMStorageArea::ItemList& items = snapshot.items;
+    size_t end = std::min(items.size(), item_index_ + batch_size_);
+
+    std::vector<CefString> keys, values;
+    keys.reserve(end - item_index_);
+    values.reserve(end - item_index_);
+    for (size_t i = item_index_; i < end; ++i) {
+      keys.push_back(items[i].first);
+      values.push_back(items[i].second);
+    }
+
+    bool keep_going = visitor_->Visit(
+        static_cast<CefStorageType>(namespace_id_), snapshot.origin, keys,
+        values, count_, total_);
+
+    count_ += end - item_index_;
+    item_index_ = end;
+    if (item_index_ == items.size()) {
+      area_index_++;
+      item_index_ = 0;
+    }
+
+    if (keep_going && area_index_ < snapshots_.size()) {
+      CefThread::PostTask(CefThread::UI, FROM_HERE,
+          base::Bind(&VisitStorageBatchesHelper::VisitNextBatch, this));
     }
   }
+
+  int64 namespace_id_;
+  size_t batch_size_;
+  CefRefPtr<CefStorageBatchVisitor> visitor_;
+  AreaSnapshotList snapshots_;
+  size_t area_index_;
+  size_t item_index_;
+  unsigned int count_;
+  unsigned int total_;
+};
+
+void UIT_VisitStorageBatches(int64 namespace_id, const CefString& origin,
+                             int batch_size,
+                             CefRefPtr<CefStorageBatchVisitor> visitor) {
+  scoped_refptr<VisitStorageBatchesHelper> helper(
+      new VisitStorageBatchesHelper(namespace_id, batch_size, visitor));
+  helper->Start(origin);
+}
+
+// Returns the namespace id for |type|.
+bool GetStorageNamespaceId(CefStorageType type, int64* namespace_id) {
+  if (type == ST_LOCALSTORAGE) {
+    *namespace_id = kLocalStorageNamespaceId;
+  } else if (type == ST_SESSIONSTORAGE) {
+    *namespace_id = kLocalStorageNamespaceId + 1;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+void UIT_SetStorageItems(int64 namespace_id, const CefString& origin,
+                         const std::vector<CefString>& keys,
+                         const std::vector<CefString>& values) {
+  REQUIRE_UIT();
+
+  DOMStorageArea* area =
+      _Context->storage_context()->GetStorageArea(namespace_id, origin, true);
+  if (!area)
+    return;
+
+  WebKit::WebStorageArea::Result result;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    area->SetItem(keys[i], values[i], &result);
+    if (result != WebKit::WebStorageArea::ResultOK) {
+      LOG(WARNING) << "Failed to set storage item for " << origin.ToString()
+                   << " (result " << result << ")";
+      break;
+    }
+  }
+}
+
+void UIT_GetStorageItems(int64 namespace_id, const CefString& origin,
+                         const std::vector<CefString>& keys,
+                         CefRefPtr<CefStorageBatchVisitor> visitor) {
+  REQUIRE_UIT();
+
+  // Allow storage to be allocated for localStorage so that on-disk data, if
+  // any, will be available.
+  bool allocation_allowed = (namespace_id == kLocalStorageNamespaceId);
+
+  DOMStorageArea* area = _Context->storage_context()->GetStorageArea(
+      namespace_id, origin, allocation_allowed);
+  if (!area)
+    return;
+
+  std::vector<CefString> found_keys, found_values;
+  std::vector<CefString>::const_iterator it = keys.begin();
+  for (; it != keys.end(); ++it) {
+    NullableString16 value = area->GetItem(*it);
+    if (value.is_null())
+      continue;
+    found_keys.push_back(*it);
+    found_values.push_back(value.string());
+  }
+
+  if (found_keys.empty())
+    return;
+
+  visitor->Visit(static_cast<CefStorageType>(namespace_id), area->origin(),
+                 found_keys, found_values, 0,
+                 static_cast<int>(found_keys.size()));
+}
+
+void UIT_DeleteStorageItems(int64 namespace_id, const CefString& origin,
+                            const std::vector<CefString>& keys) {
+  REQUIRE_UIT();
+
+  bool allocation_allowed = (namespace_id == kLocalStorageNamespaceId);
+
+  DOMStorageArea* area = _Context->storage_context()->GetStorageArea(
+      namespace_id, origin, allocation_allowed);
+  if (!area)
+    return;
+
+  std::vector<CefString>::const_iterator it = keys.begin();
+  for (; it != keys.end(); ++it)
+    area->RemoveItem(*it);
 }
 
 void UIT_SetStoragePath(int64 namespace_id, const CefString& path) {
@@ -148,6 +304,44 @@ void UIT_SetStoragePath(int64 namespace_id, const CefString& path) {
     context->SetLocalStoragePath(file_path);
 }
 
+void UIT_FlushStorage(int64 namespace_id, CefRefPtr<CefTask> task) {
+  REQUIRE_UIT();
+
+  if (namespace_id != kLocalStorageNamespaceId)
+    return;
+
+  base::Closure callback;
+  if (task.get())
+    callback = base::Bind(&CefTask::Execute, task, TID_FILE);
+
+  DOMStorageContext* context = _Context->storage_context();
+  DCHECK(context);
+  if (context)
+    context->FlushLocalStorage(callback);
+}
+
+// Used to generate storage observer ids.
+base::AtomicSequenceNumber g_storage_observer_seq(base::LINKER_INITIALIZED);
+
+void UIT_AddStorageObserver(int observer_id,
+                            CefRefPtr<CefStorageObserver> observer) {
+  REQUIRE_UIT();
+
+  DOMStorageContext* context = _Context->storage_context();
+  DCHECK(context);
+  if (context)
+    context->change_dispatcher()->AddObserver(observer_id, observer);
+}
+
+void UIT_RemoveStorageObserver(int observer_id) {
+  REQUIRE_UIT();
+
+  DOMStorageContext* context = _Context->storage_context();
+  DCHECK(context);
+  if (context)
+    context->change_dispatcher()->RemoveObserver(observer_id);
+}
+
 }  // namespace
 
 bool CefVisitStorage(CefStorageType type, const CefString& origin,
@@ -179,6 +373,35 @@ bool CefVisitStorage(CefStorageType type, const CefString& origin,
   return true;
 }
 
+bool CefVisitStorageBatches(CefStorageType type, const CefString& origin,
+                            int batch_size,
+                            CefRefPtr<CefStorageBatchVisitor> visitor) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  int64 namespace_id;
+  if (!GetStorageNamespaceId(type, &namespace_id)) {
+    NOTREACHED() << "invalid type";
+    return false;
+  }
+
+  if (batch_size <= 0)
+    batch_size = kDefaultBatchSize;
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_VisitStorageBatches(namespace_id, origin, batch_size, visitor);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_VisitStorageBatches, namespace_id, origin, batch_size,
+                   visitor));
+  }
+
+  return true;
+}
+
 bool CefSetStorage(CefStorageType type, const CefString& origin,
                    const CefString& key, const CefString& value) {
   // Verify that the context is in a valid state.
@@ -278,6 +501,101 @@ bool CefDeleteStorage(CefStorageType type, const CefString& origin,
   return true;
 }
 
+bool CefSetStorageItems(CefStorageType type, const CefString& origin,
+                        const std::vector<CefString>& keys,
+                        const std::vector<CefString>& values) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  int64 namespace_id;
+  if (!GetStorageNamespaceId(type, &namespace_id)) {
+    NOTREACHED() << "invalid type";
+    return false;
+  }
+
+  if (origin.empty()) {
+    NOTREACHED() << "invalid origin";
+    return false;
+  }
+
+  if (keys.size() != values.size()) {
+    NOTREACHED() << "keys and values do not match";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_SetStorageItems(namespace_id, origin, keys, values);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_SetStorageItems, namespace_id, origin, keys, values));
+  }
+
+  return true;
+}
+
+bool CefGetStorageItems(CefStorageType type, const CefString& origin,
+                        const std::vector<CefString>& keys,
+                        CefRefPtr<CefStorageBatchVisitor> visitor) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  int64 namespace_id;
+  if (!GetStorageNamespaceId(type, &namespace_id)) {
+    NOTREACHED() << "invalid type";
+    return false;
+  }
+
+  if (origin.empty()) {
+    NOTREACHED() << "invalid origin";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_GetStorageItems(namespace_id, origin, keys, visitor);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_GetStorageItems, namespace_id, origin, keys,
+                   visitor));
+  }
+
+  return true;
+}
+
+bool CefDeleteStorageItems(CefStorageType type, const CefString& origin,
+                           const std::vector<CefString>& keys) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  int64 namespace_id;
+  if (!GetStorageNamespaceId(type, &namespace_id)) {
+    NOTREACHED() << "invalid type";
+    return false;
+  }
+
+  if (origin.empty()) {
+    NOTREACHED() << "invalid origin";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_DeleteStorageItems(namespace_id, origin, keys);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_DeleteStorageItems, namespace_id, origin, keys));
+  }
+
+  return true;
+}
+
 bool CefSetStoragePath(CefStorageType type, const CefString& path) {
   // Verify that the context is in a valid state.
   if (!CONTEXT_STATE_VALID()) {
@@ -302,3 +620,100 @@ bool CefSetStoragePath(CefStorageType type, const CefString& path) {
 
   return true;
 }
+
+bool CefFlushStorage(CefStorageType type, CefRefPtr<CefTask> task) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  // Only localStorage is written to disk.
+  int64 namespace_id;
+  if (type != ST_LOCALSTORAGE ||
+      !GetStorageNamespaceId(type, &namespace_id)) {
+    NOTREACHED() << "invalid type";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_FlushStorage(namespace_id, task);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_FlushStorage, namespace_id, task));
+  }
+
+  return true;
+}
+
+int CefAddStorageObserver(CefRefPtr<CefStorageObserver> observer) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return 0;
+  }
+
+  if (!observer.get()) {
+    NOTREACHED() << "invalid observer";
+    return 0;
+  }
+
+  int observer_id = g_storage_observer_seq.GetNext() + 1;
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_AddStorageObserver(observer_id, observer);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_AddStorageObserver, observer_id, observer));
+  }
+
+  return observer_id;
+}
+
+bool CefRemoveStorageObserver(int observer_id) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (observer_id <= 0) {
+    NOTREACHED() << "invalid observer id";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_RemoveStorageObserver(observer_id);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_RemoveStorageObserver, observer_id));
+  }
+
+  return true;
+}
+
+int64 CefGetStorageMemoryUsage(CefStorageType type) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return 0;
+  }
+
+  // Verify that this function is being called on the UI thread.
+  if (!CefThread::CurrentlyOn(CefThread::UI)) {
+    NOTREACHED() << "called on invalid thread";
+    return 0;
+  }
+
+  DOMStorageType storage_type;
+  if (type == ST_LOCALSTORAGE) {
+    storage_type = DOM_STORAGE_LOCAL;
+  } else if (type == ST_SESSIONSTORAGE) {
+    storage_type = DOM_STORAGE_SESSION;
+  } else {
+    NOTREACHED() << "invalid type";
+    return 0;
+  }
+
+  return _Context->storage_context()->GetMemoryUsage(storage_type);
+}
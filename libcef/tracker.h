@@ -69,40 +69,49 @@ class CefTrackNode {
 // manager object is destroyed.  A manager object can be created as either a
 // member variable of another class or by using lazy initialization:
 // base::LazyInstance<CefTrackManager> g_singleton = LAZY_INSTANCE_INITIALIZER;
+// A manager that is only accessed on a single thread can be created with
+// |thread_safe| set to false to avoid locking.
 class CefTrackManager : public CefBase {
  public:
-  CefTrackManager() : object_count_(0) {}
+  explicit CefTrackManager(bool thread_safe = true)
+      : thread_safe_(thread_safe),
+        object_count_(0) {}
   virtual ~CefTrackManager() {
     DeleteAll();
   }
 
   // Add an object to be tracked by this manager.
   void Add(CefTrackNode* object) {
-    Lock();
+    if (thread_safe_)
+      Lock();
     if (!object->IsTracked()) {
       tracker_.InsertTrackNext(object);
       ++object_count_;
     }
-    Unlock();
+    if (thread_safe_)
+      Unlock();
   }
 
   // Delete an object tracked by this manager.
   bool Delete(CefTrackNode* object) {
     bool rv = false;
-    Lock();
+    if (thread_safe_)
+      Lock();
     if (object->IsTracked()) {
       object->RemoveTracking();
       delete object;
       --object_count_;
       rv = true;
     }
-    Unlock();
+    if (thread_safe_)
+      Unlock();
     return rv;
   }
 
   // Delete all objects tracked by this manager.
   void DeleteAll() {
-    Lock();
+    if (thread_safe_)
+      Lock();
     CefTrackNode* next;
     do {
       next = tracker_.GetTrackNext();
@@ -112,7 +121,8 @@ class CefTrackManager : public CefBase {
       }
     } while (next != NULL);
     object_count_ = 0;
-    Unlock();
+    if (thread_safe_)
+      Unlock();
   }
 
   // Returns the number of objects currently being tracked.
@@ -120,6 +130,7 @@ class CefTrackManager : public CefBase {
 
  private:
   CefTrackNode tracker_;
+  bool thread_safe_;
   int object_count_;
 
   IMPLEMENT_REFCOUNTING(CefTrackManager);
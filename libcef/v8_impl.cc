@@ -4,14 +4,23 @@
 
 #include "libcef/v8_impl.h"
 
+#include <algorithm>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "libcef/browser_impl.h"
+#include "libcef/browser_webkit_glue.h"
 #include "libcef/cef_context.h"
 #include "libcef/tracker.h"
+#include "libcef/v8_script_cache.h"
+#include "libcef/values_impl.h"
 
+#include "base/atomic_sequence_num.h"
 #include "base/bind.h"
 #include "base/lazy_instance.h"
+#include "base/threading/worker_pool.h"
+#include "base/time.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebKit.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebFrame.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebScriptController.h"
@@ -32,29 +41,165 @@ namespace {
 
 static const char kCefAccessor[] = "Cef::Accessor";
 static const char kCefHandler[] = "Cef::Handler";
+static const char kCefAsyncHandler[] = "Cef::AsyncHandler";
 static const char kCefUserData[] = "Cef::UserData";
-static const char kCefExternalMemory[] = "Cef::ExternalMemory";
+static const char kCefTrackObject[] = "Cef::TrackObject";
+
+// Maximum nesting depth for conversions between V8 values and
+// CefDictionaryValue/CefListValue trees.
+const int kMaxConversionDepth = 100;
 
 // Memory manager.
 
 base::LazyInstance<CefTrackManager> g_v8_tracker = LAZY_INSTANCE_INITIALIZER;
 
+// Associates each V8 context with its state. The context itself is used as the
+// key because the global object is replaced when a frame navigates and the
+// context is detached before it is released. Only accessed on the UI thread.
+class V8ContextStateMap {
+ public:
+  // The map holds a reference to |context_state| until Remove() is called.
+  void Add(v8::Handle<v8::Context> context,
+           CefV8ContextState* context_state) {
+    REQUIRE_UIT();
+    DCHECK(!Get(context));
+    context_state->AddRef();
+    entries_.push_back(
+        Entry(v8::Persistent<v8::Context>::New(context), context_state));
+  }
+
+  // Returns the state for |context|, if any.
+  CefV8ContextState* Get(v8::Handle<v8::Context> context) {
+    REQUIRE_UIT();
+    // There is one entry per frame so a linear search is sufficient.
+    for (EntryList::const_iterator it = entries_.begin();
+         it != entries_.end(); ++it) {
+      if (it->first == context)
+        return it->second;
+    }
+    return NULL;
+  }
+
+  // Removes |context| from the map. The caller takes ownership of the
+  // reference to the returned state.
+  CefV8ContextState* Remove(v8::Handle<v8::Context> context) {
+    REQUIRE_UIT();
+    for (EntryList::iterator it = entries_.begin(); it != entries_.end();
+         ++it) {
+      if (it->first == context) {
+        CefV8ContextState* context_state = it->second;
+        it->first.Dispose();
+        entries_.erase(it);
+        return context_state;
+      }
+    }
+    return NULL;
+  }
+
+ private:
+  typedef std::pair<v8::Persistent<v8::Context>, CefV8ContextState*> Entry;
+  typedef std::vector<Entry> EntryList;
+  EntryList entries_;
+};
+
+base::LazyInstance<V8ContextStateMap> g_v8_context_states =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Tracks the native objects referenced by a single V8 object. Trackers are
+// owned by the CefV8ContextState of the context that the V8 object was created
+// in or, if the context is unknown, by the global tracker.
 class V8TrackObject : public CefTrackNode {
  public:
-  V8TrackObject(CefBase* object = NULL, CefBase* user_data = NULL)
-      : object_(object),
+  V8TrackObject(CefV8ContextState* context_state,
+                CefBase* object = NULL,
+                CefBase* user_data = NULL)
+      : context_state_(context_state),
+        object_(object),
         user_data_(user_data),
-        external_memory_counter_(0) {
+        external_memory_(0) {
+    if (context_state_.get())
+      context_state_->AdjustObjectCount(1);
+  }
+  virtual ~V8TrackObject() {
+    if (IsOrphaned()) {
+      // The context was released while the V8 object was still alive and the
+      // object may remain reachable from another context. Remove all
+      // references to the native objects that are about to be released.
+      v8::HandleScope handle_scope;
+      v8::Local<v8::Object> obj = handle_->ToObject();
+      obj->DeleteHiddenValue(v8::String::NewSymbol(kCefTrackObject));
+      obj->DeleteHiddenValue(v8::String::NewSymbol(kCefHandler));
+      obj->DeleteHiddenValue(v8::String::NewSymbol(kCefAsyncHandler));
+      obj->DeleteHiddenValue(v8::String::NewSymbol(kCefAccessor));
+      obj->DeleteHiddenValue(v8::String::NewSymbol(kCefUserData));
+      if (external_memory_ != 0)
+        v8::V8::AdjustAmountOfExternalAllocatedMemory(-external_memory_);
+      handle_.Dispose();
+      handle_.Clear();
+    }
+
+    if (context_state_.get()) {
+      context_state_->AdjustObjectCount(-1);
+      context_state_->AdjustExternalMemory(-external_memory_);
+    }
   }
 
-  int* GetMemoryCounter() {
-    return &external_memory_counter_;
+  CefV8ContextState* context_state() { return context_state_.get(); }
+
+  // Take ownership of the weak persistent handle for the V8 object.
+  void SetHandle(v8::Persistent<v8::Value> handle) { handle_ = handle; }
+
+  int external_memory() { return external_memory_; }
+
+  // Adjust the amount of external memory reported for the V8 object.
+  void AdjustExternalMemory(int change_in_bytes) {
+    external_memory_ += change_in_bytes;
+    v8::V8::AdjustAmountOfExternalAllocatedMemory(change_in_bytes);
+    if (context_state_.get())
+      context_state_->AdjustExternalMemory(change_in_bytes);
+  }
+
+ protected:
+  // Returns true if the tracker is being deleted because its context was
+  // released before the V8 object was garbage collected.
+  bool IsOrphaned() {
+    return (context_state_.get() && !context_state_->IsValid() &&
+            !handle_.IsEmpty());
   }
 
+  v8::Persistent<v8::Value> handle_;
+
  private:
+  scoped_refptr<CefV8ContextState> context_state_;
   CefRefPtr<CefBase> object_;
   CefRefPtr<CefBase> user_data_;
-  int external_memory_counter_;
+  int external_memory_;
+};
+
+// Releases the memory backing a byte array when the V8 object is destroyed.
+class V8TrackByteArray : public V8TrackObject {
+ public:
+  V8TrackByteArray(CefV8ContextState* context_state,
+                   void* buffer,
+                   CefV8ByteArrayReleaseHandler* release_handler)
+      : V8TrackObject(context_state),
+        buffer_(buffer),
+        release_handler_(release_handler) {
+  }
+  virtual ~V8TrackByteArray() {
+    if (IsOrphaned()) {
+      // Prevent V8 from accessing the buffer after it has been released.
+      v8::HandleScope handle_scope;
+      handle_->ToObject()->SetIndexedPropertiesToExternalArrayData(
+          NULL, v8::kExternalUnsignedByteArray, 0);
+    }
+    if (release_handler_.get())
+      release_handler_->ReleaseBuffer(buffer_);
+  }
+
+ private:
+  void* buffer_;
+  CefRefPtr<CefV8ByteArrayReleaseHandler> release_handler_;
 };
 
 class V8TrackString : public CefTrackNode {
@@ -74,37 +219,70 @@ void TrackDelete(CefTrackNode* object) {
   g_v8_tracker.Pointer()->Delete(object);
 }
 
+// Add |object| to the tracker for its context, if any.
+void TrackObjectAdd(V8TrackObject* object) {
+  CefV8ContextState* context_state = object->context_state();
+  if (context_state)
+    context_state->AddTrackObject(object);
+  else
+    TrackAdd(object);
+}
+
+void TrackObjectDelete(V8TrackObject* object) {
+  CefV8ContextState* context_state = object->context_state();
+  if (context_state)
+    context_state->DeleteTrackObject(object);
+  else
+    TrackDelete(object);
+}
+
 // Callback for weak persistent reference destruction.
 void TrackDestructor(v8::Persistent<v8::Value> object, void* parameter) {
   if (parameter) {
-    if (object->IsObject()) {
-      V8TrackObject* tracker = static_cast<V8TrackObject*>(parameter);
-      DCHECK(tracker);
-      int adjustment = -(*tracker->GetMemoryCounter());
-      if (adjustment != 0)
-        v8::V8::AdjustAmountOfExternalAllocatedMemory(adjustment);
-    }
-    TrackDelete(static_cast<CefTrackNode*>(parameter));
+    V8TrackObject* tracker = static_cast<V8TrackObject*>(parameter);
+    int adjustment = -tracker->external_memory();
+    if (adjustment != 0)
+      v8::V8::AdjustAmountOfExternalAllocatedMemory(adjustment);
+    TrackObjectDelete(tracker);
   }
   object.Dispose();
   object.Clear();
 }
 
+// Returns the tracker attached to |object|, if any.
+V8TrackObject* GetTrackObject(v8::Handle<v8::Object> object) {
+  v8::Local<v8::Value> value =
+      object->GetHiddenValue(v8::String::NewSymbol(kCefTrackObject));
+  if (!value.IsEmpty())
+    return static_cast<V8TrackObject*>(v8::External::Unwrap(value));
+
+  return NULL;
+}
+
+// Returns the state for |context|, if any.
+CefV8ContextState* GetContextState(v8::Handle<v8::Context> context) {
+  return g_v8_context_states.Pointer()->Get(context);
+}
 
-// Return the browser associated with the specified WebFrame.
+
+// Return the browser associated with the specified main WebFrame.
 CefRefPtr<CefBrowserImpl> FindBrowserForFrame(WebKit::WebFrame *frame) {
-  CefContext::AutoLock lock_scope(_Context);
+  return _Context->UIT_GetBrowserByMainFrame(frame);
+}
 
-  CefContext::BrowserList *list = _Context->GetBrowserList();
-  CefContext::BrowserList::const_iterator i;
-  i = list->begin();
-  for (; i != list->end(); ++i) {
-    WebKit::WebFrame* thisframe = i->get()->UIT_GetMainWebFrame();
-    if (thisframe == frame)
-      return i->get();
+// Returns true if |obj| stores its indexed elements in external memory with one
+// byte per element.
+bool IsExternalByteArray(v8::Handle<v8::Object> obj) {
+  if (!obj->HasIndexedPropertiesInExternalArrayData())
+    return false;
+  switch (obj->GetIndexedPropertiesExternalArrayDataType()) {
+    case v8::kExternalByteArray:
+    case v8::kExternalUnsignedByteArray:
+    case v8::kExternalPixelArray:
+      return true;
+    default:
+      return false;
   }
-
-  return NULL;
 }
 
 // Convert a CefString to a V8::String.
@@ -169,12 +347,205 @@ void GetCefString(v8::Handle<v8::String> str, CefString& out) {
 #endif  // !defined(CEF_STRING_TYPE_WIDE)
 }
 
-// V8 function callback.
-v8::Handle<v8::Value> FunctionCallbackImpl(const v8::Arguments& args) {
+// Conversion from V8 values to CefDictionaryValue/CefListValue trees. The
+// objects on the current conversion path are kept in a stack to detect cycles.
+
+typedef std::vector<v8::Handle<v8::Object> > V8ObjectStack;
+
+bool V8ObjectToDictionary(v8::Handle<v8::Object> obj, V8ObjectStack* stack,
+                          CefDictionaryValueImpl* dict);
+bool V8ArrayToList(v8::Handle<v8::Array> arr, V8ObjectStack* stack,
+                   CefListValueImpl* list);
+
+// Returns false if |obj| is already on |stack| or the stack is too deep.
+bool PushV8Object(v8::Handle<v8::Object> obj, V8ObjectStack* stack) {
+  if (static_cast<int>(stack->size()) >= kMaxConversionDepth)
+    return false;
+  V8ObjectStack::const_iterator it = stack->begin();
+  for (; it != stack->end(); ++it) {
+    if (*it == obj)
+      return false;
+  }
+  stack->push_back(obj);
+  return true;
+}
+
+// Convert |value| to |entry|. Values that have no equivalent are assigned the
+// VTYPE_INVALID type. Returns false if the conversion failed.
+bool V8ValueToEntry(v8::Handle<v8::Value> value, V8ObjectStack* stack,
+                    CefValueEntry* entry) {
+  if (value.IsEmpty())
+    return false;
+
+  if (value->IsNull()) {
+    entry->type = VTYPE_NULL;
+  } else if (value->IsBoolean()) {
+    entry->type = VTYPE_BOOL;
+    entry->bool_value = value->BooleanValue();
+  } else if (value->IsInt32()) {
+    entry->type = VTYPE_INT;
+    entry->int_value = value->Int32Value();
+  } else if (value->IsNumber() || value->IsDate()) {
+    entry->type = VTYPE_DOUBLE;
+    entry->double_value = value->NumberValue();
+  } else if (value->IsString()) {
+    entry->type = VTYPE_STRING;
+    GetCefString(value->ToString(), entry->string_value);
+  } else if (value->IsArray()) {
+    CefRefPtr<CefListValueImpl> list = new CefListValueImpl();
+    if (!V8ArrayToList(v8::Handle<v8::Array>::Cast(value), stack, list.get()))
+      return false;
+    entry->type = VTYPE_LIST;
+    entry->list_value = list.get();
+  } else if (value->IsObject() && !value->IsFunction()) {
+    CefRefPtr<CefDictionaryValueImpl> dict = new CefDictionaryValueImpl();
+    if (!V8ObjectToDictionary(value->ToObject(), stack, dict.get()))
+      return false;
+    entry->type = VTYPE_DICTIONARY;
+    entry->dictionary_value = dict.get();
+  } else {
+    // Undefined and function values.
+    entry->type = VTYPE_INVALID;
+  }
+
+  return true;
+}
+
+bool V8ObjectToDictionary(v8::Handle<v8::Object> obj, V8ObjectStack* stack,
+                          CefDictionaryValueImpl* dict) {
   v8::HandleScope handle_scope;
 
-  CefV8Handler* handler =
-      static_cast<CefV8Handler*>(v8::External::Unwrap(args.Data()));
+  if (!PushV8Object(obj, stack))
+    return false;
+
+  bool success = true;
+  v8::Local<v8::Array> keys = obj->GetPropertyNames();
+  uint32_t len = keys->Length();
+  for (uint32_t i = 0; i < len && success; ++i) {
+    v8::Local<v8::Value> key = keys->Get(i);
+    CefValueEntry entry;
+    success = V8ValueToEntry(obj->Get(key), stack, &entry);
+    if (success && entry.type != VTYPE_INVALID) {
+      CefString key_str;
+      GetCefString(key->ToString(), key_str);
+      dict->Insert(key_str) = entry;
+    }
+  }
+
+  stack->pop_back();
+  return success;
+}
+
+bool V8ArrayToList(v8::Handle<v8::Array> arr, V8ObjectStack* stack,
+                   CefListValueImpl* list) {
+  v8::HandleScope handle_scope;
+
+  if (!PushV8Object(arr, stack))
+    return false;
+
+  bool success = true;
+  uint32_t len = arr->Length();
+  CefListValueImpl::EntryList& entries = list->mutable_entries();
+  entries.resize(len);
+  for (uint32_t i = 0; i < len && success; ++i) {
+    success = V8ValueToEntry(arr->Get(i), stack, &entries[i]);
+    if (success && entries[i].type == VTYPE_INVALID)
+      entries[i].type = VTYPE_NULL;
+  }
+
+  stack->pop_back();
+  return success;
+}
+
+// Conversion from CefDictionaryValue/CefListValue trees to V8 values. The
+// containers on the current conversion path are kept in a stack to detect
+// cycles. An empty handle is returned if the conversion failed.
+
+typedef std::vector<const void*> NativeValueStack;
+
+v8::Handle<v8::Value> DictionaryToV8Object(CefDictionaryValueImpl* dict,
+                                           NativeValueStack* stack);
+v8::Handle<v8::Value> ListToV8Array(CefListValueImpl* list,
+                                    NativeValueStack* stack);
+
+// Returns false if |value| is already on |stack| or the stack is too deep.
+bool PushNativeValue(const void* value, NativeValueStack* stack) {
+  if (static_cast<int>(stack->size()) >= kMaxConversionDepth)
+    return false;
+  if (std::find(stack->begin(), stack->end(), value) != stack->end())
+    return false;
+  stack->push_back(value);
+  return true;
+}
+
+v8::Handle<v8::Value> EntryToV8Value(const CefValueEntry& entry,
+                                     NativeValueStack* stack) {
+  switch (entry.type) {
+    case VTYPE_BOOL:
+      return v8::Boolean::New(entry.bool_value);
+    case VTYPE_INT:
+      return v8::Int32::New(entry.int_value);
+    case VTYPE_DOUBLE:
+      return v8::Number::New(entry.double_value);
+    case VTYPE_STRING:
+      return GetV8String(entry.string_value);
+    case VTYPE_DICTIONARY:
+      return DictionaryToV8Object(
+          static_cast<CefDictionaryValueImpl*>(entry.dictionary_value.get()),
+          stack);
+    case VTYPE_LIST:
+      return ListToV8Array(
+          static_cast<CefListValueImpl*>(entry.list_value.get()), stack);
+    default:
+      return v8::Null();
+  }
+}
+
+v8::Handle<v8::Value> DictionaryToV8Object(CefDictionaryValueImpl* dict,
+                                           NativeValueStack* stack) {
+  v8::HandleScope handle_scope;
+
+  if (!PushNativeValue(dict, stack))
+    return v8::Handle<v8::Value>();
+
+  v8::Local<v8::Object> obj = v8::Object::New();
+  const CefDictionaryValueImpl::EntryMap& entries = dict->entries();
+  CefDictionaryValueImpl::EntryMap::const_iterator it = entries.begin();
+  for (; it != entries.end(); ++it) {
+    v8::Handle<v8::Value> value = EntryToV8Value(it->second, stack);
+    if (value.IsEmpty())
+      return v8::Handle<v8::Value>();
+    obj->Set(GetV8String(it->first), value);
+  }
+
+  stack->pop_back();
+  return handle_scope.Close(obj);
+}
+
+v8::Handle<v8::Value> ListToV8Array(CefListValueImpl* list,
+                                    NativeValueStack* stack) {
+  v8::HandleScope handle_scope;
+
+  if (!PushNativeValue(list, stack))
+    return v8::Handle<v8::Value>();
+
+  const CefListValueImpl::EntryList& entries = list->entries();
+  v8::Local<v8::Array> arr = v8::Array::New(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    v8::Handle<v8::Value> value = EntryToV8Value(entries[i], stack);
+    if (value.IsEmpty())
+      return v8::Handle<v8::Value>();
+    arr->Set(i, value);
+  }
+
+  stack->pop_back();
+  return handle_scope.Close(arr);
+}
+
+// Execute |handler| for a V8 function call.
+v8::Handle<v8::Value> ExecuteFunctionHandler(CefV8Handler* handler,
+                                             const v8::Arguments& args) {
+  v8::HandleScope handle_scope;
 
   CefV8ValueList params;
   for (int i = 0; i < args.Length(); i++)
@@ -200,6 +571,224 @@ v8::Handle<v8::Value> FunctionCallbackImpl(const v8::Arguments& args) {
   return v8::Undefined();
 }
 
+// V8 function callback for extension functions. The handler is passed as the
+// callback data and is released when the application exits.
+v8::Handle<v8::Value> FunctionCallbackImpl(const v8::Arguments& args) {
+  CefV8Handler* handler =
+      static_cast<CefV8Handler*>(v8::External::Unwrap(args.Data()));
+  return ExecuteFunctionHandler(handler, args);
+}
+
+// V8 function callback for functions created by CefV8Value::CreateFunction()
+// and CefV8FunctionTemplate. The handler is attached to the function object
+// and is removed if the context is released before the function is garbage
+// collected.
+v8::Handle<v8::Value> TrackedFunctionCallbackImpl(const v8::Arguments& args) {
+  v8::Local<v8::Value> value =
+      args.Callee()->GetHiddenValue(v8::String::NewSymbol(kCefHandler));
+  if (value.IsEmpty())
+    return v8::Undefined();
+
+  CefV8Handler* handler =
+      static_cast<CefV8Handler*>(v8::External::Unwrap(value));
+  return ExecuteFunctionHandler(handler, args);
+}
+
+// Complete an asynchronous function call by executing the JavaScript callback
+// function in the context that the call originated from.
+void UIT_CompleteAsyncCall(scoped_refptr<CefV8ContextHandle> context,
+                           scoped_refptr<CefV8ValueHandle> function,
+                           scoped_refptr<CefV8ContextState> context_state,
+                           CefRefPtr<CefListValue> results,
+                           const CefString& exception) {
+  REQUIRE_UIT();
+
+  // The context may have been released while the call was executing.
+  if (context_state.get() && !context_state->IsValid())
+    return;
+
+  v8::HandleScope handle_scope;
+  v8::Context::Scope context_scope(context->GetHandle());
+
+  std::vector<v8::Handle<v8::Value> > argv;
+  if (exception.empty()) {
+    argv.push_back(v8::Null());
+    if (results.get()) {
+      NativeValueStack stack;
+      v8::Handle<v8::Value> arr = ListToV8Array(
+          static_cast<CefListValueImpl*>(results.get()), &stack);
+      if (arr.IsEmpty()) {
+        argv[0] = v8::Exception::Error(
+            v8::String::New("Results cannot be converted"));
+      } else {
+        v8::Handle<v8::Array> results_arr = v8::Handle<v8::Array>::Cast(arr);
+        uint32_t len = results_arr->Length();
+        for (uint32_t i = 0; i < len; ++i)
+          argv.push_back(results_arr->Get(i));
+      }
+    }
+  } else {
+    argv.push_back(v8::Exception::Error(GetV8String(exception)));
+  }
+
+  // Exceptions thrown by the callback are reported like any other uncaught
+  // exception.
+  v8::Local<v8::Function> func =
+      v8::Local<v8::Function>::Cast(function->GetHandle());
+  func->Call(context->GetHandle()->Global(), static_cast<int>(argv.size()),
+             &argv[0]);
+}
+
+// Implementation of CefV8AsyncCallback. The JavaScript callback function and
+// context are only accessed on the UI thread.
+class CefV8AsyncCallbackImpl : public CefV8AsyncCallback {
+ public:
+  CefV8AsyncCallbackImpl(v8::Handle<v8::Context> context,
+                         v8::Handle<v8::Function> function,
+                         CefV8ContextState* context_state)
+      : context_(new CefV8ContextHandle(context)),
+        context_state_(context_state),
+        completed_(false) {
+    if (!function.IsEmpty())
+      function_ = new CefV8ValueHandle(function, NULL);
+  }
+  virtual ~CefV8AsyncCallbackImpl() {
+    if (!completed_) {
+      Complete(CefRefPtr<CefListValue>(),
+               "The asynchronous call was not completed");
+    }
+  }
+
+  virtual void Success(CefRefPtr<CefListValue> results) OVERRIDE {
+    AutoLock lock_scope(this);
+    if (completed_) {
+      NOTREACHED() << "callback already executed";
+      return;
+    }
+    completed_ = true;
+    Complete(results, CefString());
+  }
+
+  virtual void Failure(const CefString& exception) OVERRIDE {
+    AutoLock lock_scope(this);
+    if (completed_) {
+      NOTREACHED() << "callback already executed";
+      return;
+    }
+    completed_ = true;
+    Complete(CefRefPtr<CefListValue>(),
+             exception.empty() ? CefString("Error") : exception);
+  }
+
+ private:
+  void Complete(CefRefPtr<CefListValue> results, const CefString& exception) {
+    if (!function_.get())
+      return;
+
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_CompleteAsyncCall, context_, function_,
+                   context_state_, results, exception));
+  }
+
+  scoped_refptr<CefV8ContextHandle> context_;
+  scoped_refptr<CefV8ValueHandle> function_;
+  scoped_refptr<CefV8ContextState> context_state_;
+  bool completed_;
+
+  IMPLEMENT_REFCOUNTING(CefV8AsyncCallbackImpl);
+  IMPLEMENT_LOCKING(CefV8AsyncCallbackImpl);
+};
+
+void ExecuteAsyncHandler(CefRefPtr<CefV8AsyncHandler> handler,
+                         const CefString& name,
+                         CefRefPtr<CefListValue> arguments,
+                         CefRefPtr<CefV8AsyncCallback> callback) {
+  handler->Execute(name, arguments, callback);
+}
+
+// V8 function callback for functions created by
+// CefV8Value::CreateAsyncFunction(). The arguments are converted on the UI
+// thread and the handler is executed on a worker thread so that slow handlers
+// do not delay the FILE thread tasks that CEF itself depends on.
+v8::Handle<v8::Value> AsyncFunctionCallbackImpl(const v8::Arguments& args) {
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Value> value =
+      args.Callee()->GetHiddenValue(v8::String::NewSymbol(kCefAsyncHandler));
+  if (value.IsEmpty())
+    return v8::Undefined();
+
+  CefV8AsyncHandler* handler =
+      static_cast<CefV8AsyncHandler*>(v8::External::Unwrap(value));
+
+  // A trailing function argument receives the result.
+  int argc = args.Length();
+  v8::Local<v8::Function> function;
+  if (argc > 0 && args[argc - 1]->IsFunction()) {
+    function = v8::Local<v8::Function>::Cast(args[argc - 1]);
+    argc--;
+  }
+
+  v8::Local<v8::Array> arr = v8::Array::New(argc);
+  for (int i = 0; i < argc; ++i)
+    arr->Set(i, args[i]);
+
+  // Convert the arguments to values that can be passed between threads.
+  CefRefPtr<CefListValueImpl> arguments = new CefListValueImpl();
+  bool converted;
+  {
+    // Exceptions thrown by property getters cause the conversion to fail.
+    v8::TryCatch try_catch;
+    try_catch.SetVerbose(false);
+
+    V8ObjectStack stack;
+    converted = V8ArrayToList(arr, &stack, arguments.get());
+  }
+  if (!converted) {
+    return v8::ThrowException(v8::Exception::Error(
+        v8::String::New("Arguments cannot be converted")));
+  }
+
+  CefString func_name;
+  GetCefString(v8::Handle<v8::String>::Cast(args.Callee()->GetName()),
+               func_name);
+
+  v8::Local<v8::Context> context = v8::Context::GetCurrent();
+  CefRefPtr<CefV8AsyncCallback> callback = new CefV8AsyncCallbackImpl(
+      context, function, GetContextState(context));
+
+  base::WorkerPool::PostTask(FROM_HERE,
+      base::Bind(&ExecuteAsyncHandler, CefRefPtr<CefV8AsyncHandler>(handler),
+                 func_name, CefRefPtr<CefListValue>(arguments.get()),
+                 callback),
+      true);
+
+  return v8::Undefined();
+}
+
+// Initialize a function object created from a template whose call handler is
+// TrackedFunctionCallbackImpl and return the CefV8Value that represents it.
+CefRefPtr<CefV8Value> InitFunction(v8::Handle<v8::Function> func,
+                                   const CefString& name,
+                                   CefV8Handler* handler) {
+  func->SetName(GetV8String(name));
+
+  V8TrackObject* tracker = new V8TrackObject(
+      GetContextState(v8::Context::GetCurrent()), handler);
+
+  // Attach the tracker.
+  func->SetHiddenValue(v8::String::NewSymbol(kCefTrackObject),
+                       v8::External::Wrap(tracker));
+
+  // Attach the handler instance to the V8 object.
+  func->SetHiddenValue(v8::String::NewSymbol(kCefHandler),
+                       v8::External::Wrap(handler));
+
+  // Create the CefV8ValueImpl and provide a tracker object that will cause
+  // the handler reference to be released when the V8 object is destroyed.
+  return new CefV8ValueImpl(func, tracker);
+}
+
 // V8 Accessor callbacks
 v8::Handle<v8::Value> AccessorGetterCallbackImpl(v8::Local<v8::String> property,
                                                  const v8::AccessorInfo& info) {
@@ -259,7 +848,7 @@ class ExtensionWrapper : public v8::Extension {
     : v8::Extension(extension_name, javascript_code), handler_(handler) {
     if (handler) {
       // The reference will be released when the application exits.
-      TrackAdd(new V8TrackObject(handler));
+      TrackAdd(new V8TrackObject(NULL, handler));
     }
   }
 
@@ -331,6 +920,182 @@ class CefV8ExceptionImpl : public CefV8Exception {
   IMPLEMENT_REFCOUNTING(CefV8ExceptionImpl);
 };
 
+
+// Garbage collection statistics.
+
+// Collects garbage collection counts and pause times for the V8 heap. V8 has a
+// single heap shared by all contexts so the values are global. Only accessed
+// on the UI thread.
+class V8GCTracker {
+ public:
+  typedef std::map<int, CefRefPtr<CefV8GCHandler> > HandlerMap;
+
+  V8GCTracker()
+      : registered_(false),
+        gc_count_(0),
+        full_gc_count_(0),
+        gc_pause_time_(0),
+        notification_pending_(false),
+        pending_full_(false),
+        pending_pause_time_(0) {
+  }
+
+  // Register the V8 callbacks. May be called multiple times.
+  void Register() {
+    REQUIRE_UIT();
+    if (registered_)
+      return;
+    registered_ = true;
+    v8::V8::AddGCPrologueCallback(&V8GCTracker::GCPrologue);
+    v8::V8::AddGCEpilogueCallback(&V8GCTracker::GCEpilogue);
+  }
+
+  void AddHandler(int handler_id, CefRefPtr<CefV8GCHandler> handler) {
+    REQUIRE_UIT();
+    handlers_[handler_id] = handler;
+  }
+
+  void RemoveHandler(int handler_id) {
+    REQUIRE_UIT();
+    handlers_.erase(handler_id);
+  }
+
+  void GetStatistics(CefV8HeapStatistics& statistics) {
+    REQUIRE_UIT();
+    v8::HeapStatistics heap_statistics;
+    v8::V8::GetHeapStatistics(&heap_statistics);
+
+    statistics.total_heap_size = heap_statistics.total_heap_size();
+    statistics.total_heap_size_executable =
+        heap_statistics.total_heap_size_executable();
+    statistics.used_heap_size = heap_statistics.used_heap_size();
+    statistics.heap_size_limit = heap_statistics.heap_size_limit();
+    statistics.gc_count = gc_count_;
+    statistics.full_gc_count = full_gc_count_;
+    statistics.gc_pause_time = gc_pause_time_;
+  }
+
+ private:
+  static void GCPrologue(v8::GCType type, v8::GCCallbackFlags flags);
+  static void GCEpilogue(v8::GCType type, v8::GCCallbackFlags flags);
+
+  // Notify the handlers outside of the collection because they may execute
+  // script. Collections that complete while a notification is pending are
+  // combined into that notification.
+  void UIT_NotifyHandlers() {
+    REQUIRE_UIT();
+    DCHECK(notification_pending_);
+
+    bool full = pending_full_;
+    double pause_time = pending_pause_time_;
+    notification_pending_ = false;
+    pending_full_ = false;
+    pending_pause_time_ = 0;
+
+    if (handlers_.empty())
+      return;
+
+    CefV8HeapStatistics statistics;
+    GetStatistics(statistics);
+
+    // Copy the map so that handlers may remove themselves or each other.
+    HandlerMap handlers(handlers_);
+    HandlerMap::const_iterator it = handlers.begin();
+    for (; it != handlers.end(); ++it) {
+      // Skip handlers that were removed by a previous handler.
+      if (handlers_.find(it->first) == handlers_.end())
+        continue;
+      it->second->OnGarbageCollection(full, pause_time, statistics);
+    }
+  }
+
+  bool registered_;
+  int gc_count_;
+  int full_gc_count_;
+  double gc_pause_time_;
+  base::TimeTicks gc_start_time_;
+  HandlerMap handlers_;
+
+  // Values accumulated for the pending handler notification.
+  bool notification_pending_;
+  bool pending_full_;
+  double pending_pause_time_;
+};
+
+base::LazyInstance<V8GCTracker> g_v8_gc_tracker = LAZY_INSTANCE_INITIALIZER;
+
+// Used to generate GC handler ids.
+base::AtomicSequenceNumber g_v8_gc_handler_seq(base::LINKER_INITIALIZED);
+
+// static
+void V8GCTracker::GCPrologue(v8::GCType type, v8::GCCallbackFlags flags) {
+  g_v8_gc_tracker.Pointer()->gc_start_time_ = base::TimeTicks::Now();
+}
+
+// static
+void V8GCTracker::GCEpilogue(v8::GCType type, v8::GCCallbackFlags flags) {
+  V8GCTracker* tracker = g_v8_gc_tracker.Pointer();
+  bool full = (type == v8::kGCTypeMarkSweepCompact);
+  double pause_time =
+      (base::TimeTicks::Now() - tracker->gc_start_time_).InMillisecondsF();
+
+  tracker->gc_count_++;
+  if (full)
+    tracker->full_gc_count_++;
+  tracker->gc_pause_time_ += pause_time;
+
+  if (tracker->handlers_.empty())
+    return;
+
+  if (full)
+    tracker->pending_full_ = true;
+  tracker->pending_pause_time_ += pause_time;
+
+  // Scavenges may occur in rapid succession so only post a single task.
+  if (!tracker->notification_pending_) {
+    tracker->notification_pending_ = true;
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&V8GCTracker::UIT_NotifyHandlers,
+                   base::Unretained(tracker)));
+  }
+}
+
+void UIT_AddV8GCHandler(int handler_id, CefRefPtr<CefV8GCHandler> handler) {
+  V8GCTracker* tracker = g_v8_gc_tracker.Pointer();
+  tracker->Register();
+  tracker->AddHandler(handler_id, handler);
+}
+
+void UIT_RemoveV8GCHandler(int handler_id) {
+  g_v8_gc_tracker.Pointer()->RemoveHandler(handler_id);
+}
+
+void UIT_V8LowMemoryNotification() {
+  REQUIRE_UIT();
+  v8::V8::LowMemoryNotification();
+}
+
+// Compile |code| using the script cache, if any, and run it in the current
+// context of |frame|. Returns an empty handle if the script could not be
+// compiled or threw an exception.
+v8::Local<v8::Value> CompileAndRunScript(WebKit::WebFrame* frame,
+                                         const CefString& code,
+                                         v8::ScriptOrigin* origin,
+                                         const std::string& script_url,
+                                         int start_line) {
+  v8::Handle<v8::String> source = GetV8String(code);
+  v8::Local<v8::Script> script;
+  CefV8ScriptCache* script_cache = _Context->script_cache();
+  if (script_cache)
+    script = script_cache->Compile(source, code, origin);
+  else
+    script = v8::Script::Compile(source, origin);
+
+  if (script.IsEmpty())
+    return v8::Local<v8::Value>();
+  return webkit_glue::RunV8Script(frame, script, script_url, start_line);
+}
+
 }  // namespace
 
 bool CefRegisterExtension(const CefString& extension_name,
@@ -352,6 +1117,254 @@ bool CefRegisterExtension(const CefString& extension_name,
   return true;
 }
 
+bool CefGetV8HeapStatistics(CefV8HeapStatistics& statistics) {
+  // Verify that this method is being called on the UI thread.
+  CEF_REQUIRE_UI_THREAD(false);
+
+  g_v8_gc_tracker.Pointer()->GetStatistics(statistics);
+  return true;
+}
+
+int CefAddV8GCHandler(CefRefPtr<CefV8GCHandler> handler) {
+  // Verify that the context is in a valid state.
+  CEF_REQUIRE_VALID_CONTEXT(0);
+
+  if (!handler.get()) {
+    NOTREACHED() << "invalid parameter";
+    return 0;
+  }
+
+  int handler_id = g_v8_gc_handler_seq.GetNext() + 1;
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_AddV8GCHandler(handler_id, handler);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_AddV8GCHandler, handler_id, handler));
+  }
+  return handler_id;
+}
+
+bool CefRemoveV8GCHandler(int handler_id) {
+  // Verify that the context is in a valid state.
+  CEF_REQUIRE_VALID_CONTEXT(false);
+
+  if (handler_id <= 0) {
+    NOTREACHED() << "invalid handler id";
+    return false;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_RemoveV8GCHandler(handler_id);
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_RemoveV8GCHandler, handler_id));
+  }
+  return true;
+}
+
+bool CefV8IdleNotification(int hint) {
+  // Verify that this method is being called on the UI thread.
+  CEF_REQUIRE_UI_THREAD(false);
+
+  if (hint < 1 || hint > 1000) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+
+  return v8::V8::IdleNotification(hint);
+}
+
+bool CefGetV8ScriptCacheStatistics(CefV8ScriptCacheStatistics& statistics) {
+  // Verify that this method is being called on the UI thread.
+  CEF_REQUIRE_UI_THREAD(false);
+
+  CefV8ScriptCache* script_cache = _Context->script_cache();
+  if (!script_cache)
+    return false;
+
+  script_cache->GetStatistics(statistics);
+  return true;
+}
+
+void CefV8LowMemoryNotification() {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return;
+  }
+
+  if (CefThread::CurrentlyOn(CefThread::UI)) {
+    UIT_V8LowMemoryNotification();
+  } else {
+    CefThread::PostTask(CefThread::UI, FROM_HERE,
+        base::Bind(&UIT_V8LowMemoryNotification));
+  }
+}
+
+void CefV8ContextCreated(v8::Handle<v8::Context> context) {
+  REQUIRE_UIT();
+
+  // Begin collecting garbage collection statistics.
+  g_v8_gc_tracker.Pointer()->Register();
+
+  // The reference is released in CefV8ContextReleased().
+  g_v8_context_states.Pointer()->Add(context, new CefV8ContextState());
+}
+
+bool CefV8ExecuteScript(WebKit::WebFrame* frame,
+                        const CefString& code,
+                        const CefString& script_url,
+                        int start_line) {
+  REQUIRE_UIT();
+
+  CefV8ScriptCache* script_cache = _Context->script_cache();
+  if (!script_cache)
+    return false;
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> context = frame->mainWorldScriptContext();
+  if (context.IsEmpty())
+    return false;
+
+  v8::Context::Scope context_scope(context);
+
+  // Line numbers are 1-based to match WebScriptSource.
+  v8::ScriptOrigin origin(GetV8String(script_url),
+                          v8::Integer::New(start_line - 1));
+
+  // Uncaught exceptions are reported to the console by WebKit's message
+  // listener.
+  v8::Local<v8::Script> script =
+      script_cache->Compile(GetV8String(code), code, &origin);
+  if (!script.IsEmpty()) {
+    webkit_glue::RunV8Script(frame, script, script_url.ToString(),
+                             start_line);
+  }
+  return true;
+}
+
+bool CefV8EvaluateScripts(WebKit::WebFrame* frame,
+                          const std::vector<CefString>& scripts,
+                          const CefString& script_url,
+                          int start_line,
+                          CefListValueImpl* results,
+                          CefListValueImpl* exceptions) {
+  REQUIRE_UIT();
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> context = frame->mainWorldScriptContext();
+  if (context.IsEmpty())
+    return false;
+
+  v8::Context::Scope context_scope(context);
+
+  // Line numbers are 1-based to match WebScriptSource.
+  v8::ScriptOrigin origin(GetV8String(script_url),
+                          v8::Integer::New(start_line - 1));
+
+  std::string script_url_str = script_url.ToString();
+
+  if (!results) {
+    DCHECK(!exceptions);
+    for (size_t i = 0; i < scripts.size(); ++i) {
+      // Release the handles for each script before executing the next.
+      v8::HandleScope script_scope;
+
+      // Uncaught exceptions are reported to the console by WebKit's message
+      // listener.
+      CompileAndRunScript(frame, scripts[i], &origin, script_url_str,
+                          start_line);
+    }
+    return true;
+  }
+
+  CefListValueImpl::EntryList& result_entries = results->mutable_entries();
+  CefListValueImpl::EntryList& exception_entries =
+      exceptions->mutable_entries();
+  result_entries.resize(scripts.size());
+  exception_entries.resize(scripts.size());
+
+  for (size_t i = 0; i < scripts.size(); ++i) {
+    // Release the handles for each script before executing the next.
+    v8::HandleScope script_scope;
+
+    v8::TryCatch try_catch;
+    v8::Local<v8::Value> result =
+        CompileAndRunScript(frame, scripts[i], &origin, script_url_str,
+                            start_line);
+
+    CefValueEntry& exception_entry = exception_entries[i];
+    exception_entry.type = VTYPE_STRING;
+
+    if (try_catch.HasCaught()) {
+      v8::Local<v8::Message> message = try_catch.Message();
+      if (!message.IsEmpty()) {
+        GetCefString(message->Get(), exception_entry.string_value);
+      } else {
+        GetCefString(try_catch.Exception()->ToString(),
+                     exception_entry.string_value);
+      }
+      continue;
+    }
+
+    // Values that cannot be converted are returned as null.
+    V8ObjectStack stack;
+    CefValueEntry& result_entry = result_entries[i];
+    if (!V8ValueToEntry(result, &stack, &result_entry) ||
+        result_entry.type == VTYPE_INVALID) {
+      result_entry = CefValueEntry();
+    }
+  }
+
+  return true;
+}
+
+void CefV8ContextReleased(v8::Handle<v8::Context> context) {
+  REQUIRE_UIT();
+
+  CefV8ContextState* context_state =
+      g_v8_context_states.Pointer()->Remove(context);
+  if (!context_state)
+    return;
+
+  context_state->Detach();
+  context_state->Release();
+}
+
+
+// CefV8ContextState
+
+CefV8ContextState::CefV8ContextState()
+    : valid_(true),
+      track_manager_(false),
+      object_count_(0),
+      external_memory_(0) {
+}
+
+CefV8ContextState::~CefV8ContextState() {
+}
+
+void CefV8ContextState::Detach() {
+  DCHECK(valid_);
+  valid_ = false;
+
+  // Objects that are still alive will be detached from their native state by
+  // the tracker destructor.
+  track_manager_.DeleteAll();
+}
+
+void CefV8ContextState::AddTrackObject(CefTrackNode* object) {
+  DCHECK(valid_);
+  track_manager_.Add(object);
+}
+
+void CefV8ContextState::DeleteTrackObject(CefTrackNode* object) {
+  track_manager_.Delete(object);
+}
+
 
 // CefV8Context
 
@@ -430,70 +1443,215 @@ CefRefPtr<CefFrame> CefV8ContextImpl::GetFrame() {
 CefRefPtr<CefV8Value> CefV8ContextImpl::GetGlobal() {
   CEF_REQUIRE_UI_THREAD(NULL);
 
-  v8::HandleScope handle_scope;
-  v8::Context::Scope context_scope(v8_context_->GetHandle());
-  return new CefV8ValueImpl(v8_context_->GetHandle()->Global());
-}
+  v8::HandleScope handle_scope;
+  v8::Context::Scope context_scope(v8_context_->GetHandle());
+  return new CefV8ValueImpl(v8_context_->GetHandle()->Global());
+}
+
+bool CefV8ContextImpl::Enter() {
+  CEF_REQUIRE_UI_THREAD(false);
+  v8_context_->GetHandle()->Enter();
+#ifndef NDEBUG
+  ++enter_count_;
+#endif
+  return true;
+}
+
+bool CefV8ContextImpl::Exit() {
+  CEF_REQUIRE_UI_THREAD(false);
+  DLOG_ASSERT(enter_count_ > 0);
+  v8_context_->GetHandle()->Exit();
+#ifndef NDEBUG
+  --enter_count_;
+#endif
+  return true;
+}
+
+bool CefV8ContextImpl::IsSame(CefRefPtr<CefV8Context> that) {
+  CEF_REQUIRE_UI_THREAD(false);
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> thatHandle;
+  v8::Local<v8::Context> thisHandle = GetContext();
+
+  CefV8ContextImpl* impl = static_cast<CefV8ContextImpl*>(that.get());
+  if (impl)
+    thatHandle = impl->GetContext();
+
+  return (thisHandle == thatHandle);
+}
+
+int CefV8ContextImpl::GetTrackedObjectCount() {
+  CEF_REQUIRE_UI_THREAD(0);
+
+  v8::HandleScope handle_scope;
+  CefV8ContextState* context_state = GetContextState(GetContext());
+  return context_state ? context_state->object_count() : 0;
+}
+
+int CefV8ContextImpl::GetExternallyAllocatedMemory() {
+  CEF_REQUIRE_UI_THREAD(0);
+
+  v8::HandleScope handle_scope;
+  CefV8ContextState* context_state = GetContextState(GetContext());
+  return context_state ? context_state->external_memory() : 0;
+}
+
+v8::Local<v8::Context> CefV8ContextImpl::GetContext() {
+  return v8::Local<v8::Context>::New(v8_context_->GetHandle());
+}
+
+WebKit::WebFrame* CefV8ContextImpl::GetWebFrame() {
+  v8::HandleScope handle_scope;
+  v8::Context::Scope context_scope(v8_context_->GetHandle());
+  WebKit::WebFrame* frame = WebKit::WebFrame::frameForCurrentContext();
+  return frame;
+}
+
+
+// CefV8ValueHandle
+
+// Custom destructor for a v8 value handle which gets called only on the UI
+// thread.
+CefV8ValueHandle::~CefV8ValueHandle() {
+  if (tracker_) {
+    V8TrackObject* object = static_cast<V8TrackObject*>(tracker_);
+    object->SetHandle(v8_handle_);
+
+    CefV8ContextState* context_state = object->context_state();
+    if (context_state && !context_state->IsValid()) {
+      // The context has already been released so release the tracked objects
+      // immediately.
+      delete object;
+    } else {
+      TrackObjectAdd(object);
+      v8_handle_.MakeWeak(tracker_, TrackDestructor);
+    }
+  } else {
+    v8_handle_.Dispose();
+    v8_handle_.Clear();
+  }
+  tracker_ = NULL;
+}
+
+
+// CefV8PropertyName
+
+// static
+CefRefPtr<CefV8PropertyName> CefV8PropertyName::Create(const CefString& name) {
+  CEF_REQUIRE_VALID_CONTEXT(NULL);
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  if (name.empty()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  // Symbols are unique within the V8 heap so the same handle can be used
+  // with objects from any context.
+#if defined(CEF_STRING_TYPE_UTF8)
+  v8::Local<v8::String> symbol =
+      v8::String::NewSymbol(name.c_str(), name.length());
+#else
+  std::string name_str = name;
+  v8::Local<v8::String> symbol =
+      v8::String::NewSymbol(name_str.c_str(), name_str.length());
+#endif
+
+  return new CefV8PropertyNameImpl(name, symbol);
+}
+
+
+// CefV8PropertyNameImpl
+
+CefV8PropertyNameImpl::CefV8PropertyNameImpl(const CefString& name,
+                                             v8::Handle<v8::String> symbol)
+    : name_(name) {
+  v8_symbol_ = new CefV8StringHandle(symbol);
+}
+
+CefV8PropertyNameImpl::~CefV8PropertyNameImpl() {
+}
+
+CefString CefV8PropertyNameImpl::GetName() {
+  return name_;
+}
+
+
+// CefV8FunctionTemplate
+
+// static
+CefRefPtr<CefV8FunctionTemplate> CefV8FunctionTemplate::Create(
+    const CefString& name,
+    CefRefPtr<CefV8Handler> handler) {
+  CEF_REQUIRE_VALID_CONTEXT(NULL);
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  if (!handler.get()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
 
-bool CefV8ContextImpl::Enter() {
-  CEF_REQUIRE_UI_THREAD(false);
-  v8_context_->GetHandle()->Enter();
-#ifndef NDEBUG
-  ++enter_count_;
-#endif
-  return true;
+  return new CefV8FunctionTemplateImpl(name, handler);
 }
 
-bool CefV8ContextImpl::Exit() {
-  CEF_REQUIRE_UI_THREAD(false);
-  DLOG_ASSERT(enter_count_ > 0);
-  v8_context_->GetHandle()->Exit();
-#ifndef NDEBUG
-  --enter_count_;
-#endif
-  return true;
-}
 
-bool CefV8ContextImpl::IsSame(CefRefPtr<CefV8Context> that) {
-  CEF_REQUIRE_UI_THREAD(false);
+// CefV8FunctionTemplateImpl
 
+CefV8FunctionTemplateImpl::CefV8FunctionTemplateImpl(
+    const CefString& name,
+    CefRefPtr<CefV8Handler> handler)
+    : name_(name),
+      handler_(handler) {
   v8::HandleScope handle_scope;
 
-  v8::Local<v8::Context> thatHandle;
-  v8::Local<v8::Context> thisHandle = GetContext();
-
-  CefV8ContextImpl* impl = static_cast<CefV8ContextImpl*>(that.get());
-  if (impl)
-    thatHandle = impl->GetContext();
+  // The template is not bound to a context. V8 creates at most one function
+  // object from it per context.
+  v8::Local<v8::FunctionTemplate> tmpl = v8::FunctionTemplate::New();
+  tmpl->SetCallHandler(TrackedFunctionCallbackImpl);
+  v8_template_ = new CefV8FunctionTemplateHandle(tmpl);
+}
 
-  return (thisHandle == thatHandle);
+CefV8FunctionTemplateImpl::~CefV8FunctionTemplateImpl() {
 }
 
-v8::Local<v8::Context> CefV8ContextImpl::GetContext() {
-  return v8::Local<v8::Context>::New(v8_context_->GetHandle());
+CefString CefV8FunctionTemplateImpl::GetName() {
+  return name_;
 }
 
-WebKit::WebFrame* CefV8ContextImpl::GetWebFrame() {
-  v8::HandleScope handle_scope;
-  v8::Context::Scope context_scope(v8_context_->GetHandle());
-  WebKit::WebFrame* frame = WebKit::WebFrame::frameForCurrentContext();
-  return frame;
+CefRefPtr<CefV8Handler> CefV8FunctionTemplateImpl::GetHandler() {
+  return handler_;
 }
 
+CefRefPtr<CefV8Value> CefV8FunctionTemplateImpl::GetFunction() {
+  CEF_REQUIRE_UI_THREAD(NULL);
 
-// CefV8ValueHandle
+  v8::HandleScope handle_scope;
 
-// Custom destructor for a v8 value handle which gets called only on the UI
-// thread.
-CefV8ValueHandle::~CefV8ValueHandle() {
-  if (tracker_) {
-    TrackAdd(tracker_);
-    v8_handle_.MakeWeak(tracker_, TrackDestructor);
-  } else {
-    v8_handle_.Dispose();
-    v8_handle_.Clear();
+  v8::Local<v8::Context> context = v8::Context::GetCurrent();
+  if (context.IsEmpty()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
   }
-  tracker_ = NULL;
+
+  // Returns the existing function object if one has already been created for
+  // the current context.
+  v8::Local<v8::Function> func = GetHandle()->GetFunction();
+  if (func.IsEmpty()) {
+    NOTREACHED() << "failed to create V8 function";
+    return NULL;
+  }
+
+  // Only a newly created function object needs to be initialized. The tracker
+  // attached by InitFunction() keeps the handler alive for as long as the
+  // function object exists, independent of this template.
+  if (func->GetHiddenValue(v8::String::NewSymbol(kCefHandler)).IsEmpty())
+    return InitFunction(func, name_, handler_.get());
+
+  return new CefV8ValueImpl(func);
 }
 
 
@@ -575,30 +1733,31 @@ CefRefPtr<CefV8Value> CefV8Value::CreateObject(
 
   // Provide a tracker object that will cause the user data and/or accessor
   // reference to be released when the V8 object is destroyed.
+  CefV8ContextState* context_state = GetContextState(context);
   V8TrackObject* tracker = NULL;
   if (user_data.get() && accessor.get()) {
-    tracker = new V8TrackObject(accessor, user_data);
+    tracker = new V8TrackObject(context_state, accessor, user_data);
   } else if (user_data.get() || accessor.get()) {
     CefBase* object = user_data.get() ? user_data.get() : accessor.get();
-    tracker = new V8TrackObject(object);
+    tracker = new V8TrackObject(context_state, object);
   } else {
-    tracker = new V8TrackObject();
+    tracker = new V8TrackObject(context_state);
   }
 
-  // Attach the memory counter.
-  obj->SetHiddenValue(v8::String::New(kCefExternalMemory),
-                      v8::External::Wrap(tracker->GetMemoryCounter()));
+  // Attach the tracker.
+  obj->SetHiddenValue(v8::String::NewSymbol(kCefTrackObject),
+                      v8::External::Wrap(tracker));
 
   // Attach the user data to the V8 object.
   if (user_data.get()) {
     v8::Local<v8::Value> data = v8::External::Wrap(user_data.get());
-    obj->SetHiddenValue(v8::String::New(kCefUserData), data);
+    obj->SetHiddenValue(v8::String::NewSymbol(kCefUserData), data);
   }
 
   // Attach the accessor to the V8 object.
   if (accessor.get()) {
     v8::Local<v8::Value> data = v8::External::Wrap(accessor.get());
-    obj->SetHiddenValue(v8::String::New(kCefAccessor), data);
+    obj->SetHiddenValue(v8::String::NewSymbol(kCefAccessor), data);
   }
 
   return new CefV8ValueImpl(obj, tracker);
@@ -620,6 +1779,105 @@ CefRefPtr<CefV8Value> CefV8Value::CreateArray() {
   return new CefV8ValueImpl(v8::Array::New());
 }
 
+// static
+CefRefPtr<CefV8Value> CefV8Value::CreateFromDictionary(
+    CefRefPtr<CefDictionaryValue> value) {
+  CEF_REQUIRE_VALID_CONTEXT(NULL);
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  if (!value.get()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> context = v8::Context::GetCurrent();
+  if (context.IsEmpty()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
+  }
+
+  NativeValueStack stack;
+  v8::Handle<v8::Value> obj = DictionaryToV8Object(
+      static_cast<CefDictionaryValueImpl*>(value.get()), &stack);
+  if (obj.IsEmpty())
+    return NULL;
+
+  return new CefV8ValueImpl(obj);
+}
+
+// static
+CefRefPtr<CefV8Value> CefV8Value::CreateFromList(
+    CefRefPtr<CefListValue> value) {
+  CEF_REQUIRE_VALID_CONTEXT(NULL);
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  if (!value.get()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> context = v8::Context::GetCurrent();
+  if (context.IsEmpty()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
+  }
+
+  NativeValueStack stack;
+  v8::Handle<v8::Value> arr = ListToV8Array(
+      static_cast<CefListValueImpl*>(value.get()), &stack);
+  if (arr.IsEmpty())
+    return NULL;
+
+  return new CefV8ValueImpl(arr);
+}
+
+// static
+CefRefPtr<CefV8Value> CefV8Value::CreateByteArray(
+    void* buffer, int length,
+    CefRefPtr<CefV8ByteArrayReleaseHandler> release_handler) {
+  CEF_REQUIRE_VALID_CONTEXT(NULL);
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  if (length < 0 || (!buffer && length > 0)) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> context = v8::Context::GetCurrent();
+  if (context.IsEmpty()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
+  }
+
+  // Create the new V8 object and use |buffer| directly as its elements.
+  v8::Local<v8::Object> obj = v8::Object::New();
+  obj->SetIndexedPropertiesToExternalArrayData(
+      buffer, v8::kExternalUnsignedByteArray, length);
+  obj->Set(v8::String::New("length"), v8::Integer::New(length),
+           static_cast<v8::PropertyAttribute>(
+               v8::ReadOnly | v8::DontEnum | v8::DontDelete));
+
+  // Provide a tracker object that will cause the buffer to be released when
+  // the V8 object is destroyed.
+  V8TrackByteArray* tracker = new V8TrackByteArray(
+      GetContextState(context), buffer, release_handler.get());
+
+  // Attach the tracker and report the buffer size so that V8 can account for
+  // it when scheduling garbage collection.
+  obj->SetHiddenValue(v8::String::NewSymbol(kCefTrackObject),
+                      v8::External::Wrap(tracker));
+  if (length > 0)
+    tracker->AdjustExternalMemory(length);
+
+  return new CefV8ValueImpl(obj, tracker);
+}
+
 // static
 CefRefPtr<CefV8Value> CefV8Value::CreateFunction(
     const CefString& name, CefRefPtr<CefV8Handler> handler) {
@@ -642,12 +1900,40 @@ CefRefPtr<CefV8Value> CefV8Value::CreateFunction(
   // Create a new V8 function template with one internal field.
   v8::Local<v8::FunctionTemplate> tmpl = v8::FunctionTemplate::New();
 
-  v8::Local<v8::Value> data = v8::External::Wrap(handler.get());
-
   // Set the function handler callback.
-  tmpl->SetCallHandler(FunctionCallbackImpl, data);
+  tmpl->SetCallHandler(TrackedFunctionCallbackImpl);
+
+  // Retrieve the function object.
+  v8::Local<v8::Function> func = tmpl->GetFunction();
+  if (func.IsEmpty()) {
+    NOTREACHED() << "failed to create V8 function";
+    return NULL;
+  }
+
+  return InitFunction(func, name, handler.get());
+}
+
+// static
+CefRefPtr<CefV8Value> CefV8Value::CreateAsyncFunction(
+    const CefString& name, CefRefPtr<CefV8AsyncHandler> handler) {
+  CEF_REQUIRE_VALID_CONTEXT(NULL);
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  if (!handler.get()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  v8::Local<v8::Context> context = v8::Context::GetCurrent();
+  if (context.IsEmpty()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
+  }
 
-  // Retrieve the function object and set the name.
+  v8::Local<v8::FunctionTemplate> tmpl =
+      v8::FunctionTemplate::New(AsyncFunctionCallbackImpl);
   v8::Local<v8::Function> func = tmpl->GetFunction();
   if (func.IsEmpty()) {
     NOTREACHED() << "failed to create V8 function";
@@ -656,14 +1942,16 @@ CefRefPtr<CefV8Value> CefV8Value::CreateFunction(
 
   func->SetName(GetV8String(name));
 
-  V8TrackObject* tracker = new V8TrackObject(handler.get());
+  V8TrackObject* tracker =
+      new V8TrackObject(GetContextState(context), handler.get());
 
-  // Attach the memory counter.
-  func->SetHiddenValue(v8::String::New(kCefExternalMemory),
-                       v8::External::Wrap(tracker->GetMemoryCounter()));
+  // Attach the tracker.
+  func->SetHiddenValue(v8::String::NewSymbol(kCefTrackObject),
+                       v8::External::Wrap(tracker));
 
   // Attach the handler instance to the V8 object.
-  func->SetHiddenValue(v8::String::New(kCefHandler), data);
+  func->SetHiddenValue(v8::String::NewSymbol(kCefAsyncHandler),
+                       v8::External::Wrap(handler.get()));
 
   // Create the CefV8ValueImpl and provide a tracker object that will cause
   // the handler reference to be released when the V8 object is destroyed.
@@ -727,6 +2015,15 @@ bool CefV8ValueImpl::IsArray() {
   return GetHandle()->IsArray();
 }
 
+bool CefV8ValueImpl::IsByteArray() {
+  CEF_REQUIRE_UI_THREAD(false);
+  if (!GetHandle()->IsObject())
+    return false;
+
+  v8::HandleScope handle_scope;
+  return IsExternalByteArray(GetHandle()->ToObject());
+}
+
 bool CefV8ValueImpl::IsFunction() {
   CEF_REQUIRE_UI_THREAD(false);
   return GetHandle()->IsFunction();
@@ -823,6 +2120,25 @@ bool CefV8ValueImpl::HasValue(int index) {
   return obj->Has(index);
 }
 
+bool CefV8ValueImpl::HasValue(CefRefPtr<CefV8PropertyName> name) {
+  CEF_REQUIRE_UI_THREAD(false);
+  if (!GetHandle()->IsObject()) {
+    NOTREACHED() << "V8 value is not an object";
+    return false;
+  }
+
+  CefV8PropertyNameImpl* impl =
+      static_cast<CefV8PropertyNameImpl*>(name.get());
+  if (!impl) {
+    NOTREACHED() << "invalid input parameter";
+    return false;
+  }
+
+  v8::HandleScope handle_scope;
+  v8::Local<v8::Object> obj = GetHandle()->ToObject();
+  return obj->Has(impl->GetHandle());
+}
+
 bool CefV8ValueImpl::DeleteValue(const CefString& key) {
   CEF_REQUIRE_UI_THREAD(false);
   if (!GetHandle()->IsObject()) {
@@ -889,6 +2205,26 @@ CefRefPtr<CefV8Value> CefV8ValueImpl::GetValue(int index) {
   return new CefV8ValueImpl(obj->Get(v8::Number::New(index)));
 }
 
+CefRefPtr<CefV8Value> CefV8ValueImpl::GetValue(
+    CefRefPtr<CefV8PropertyName> name) {
+  CEF_REQUIRE_UI_THREAD(NULL);
+  if (!GetHandle()->IsObject()) {
+    NOTREACHED() << "V8 value is not an object";
+    return NULL;
+  }
+
+  CefV8PropertyNameImpl* impl =
+      static_cast<CefV8PropertyNameImpl*>(name.get());
+  if (!impl) {
+    NOTREACHED() << "invalid input parameter";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+  v8::Local<v8::Object> obj = GetHandle()->ToObject();
+  return new CefV8ValueImpl(obj->Get(impl->GetHandle()));
+}
+
 bool CefV8ValueImpl::SetValue(const CefString& key,
                               CefRefPtr<CefV8Value> value,
                               PropertyAttribute attribute) {
@@ -933,6 +2269,29 @@ bool CefV8ValueImpl::SetValue(int index, CefRefPtr<CefV8Value> value) {
   }
 }
 
+bool CefV8ValueImpl::SetValue(CefRefPtr<CefV8PropertyName> name,
+                              CefRefPtr<CefV8Value> value,
+                              PropertyAttribute attribute) {
+  CEF_REQUIRE_UI_THREAD(false);
+  if (!GetHandle()->IsObject()) {
+    NOTREACHED() << "V8 value is not an object";
+    return false;
+  }
+
+  CefV8PropertyNameImpl* name_impl =
+      static_cast<CefV8PropertyNameImpl*>(name.get());
+  CefV8ValueImpl* impl = static_cast<CefV8ValueImpl*>(value.get());
+  if (name_impl && impl) {
+    v8::HandleScope handle_scope;
+    v8::Local<v8::Object> obj = GetHandle()->ToObject();
+    return obj->Set(name_impl->GetHandle(), impl->GetHandle(),
+                    static_cast<v8::PropertyAttribute>(attribute));
+  } else {
+    NOTREACHED() << "invalid input parameter";
+    return false;
+  }
+}
+
 bool CefV8ValueImpl::SetValue(const CefString& key, AccessControl settings,
                               PropertyAttribute attribute) {
   CEF_REQUIRE_UI_THREAD(false);
@@ -994,7 +2353,7 @@ CefRefPtr<CefBase> CefV8ValueImpl::GetUserData() {
   v8::Local<v8::Object> obj = GetHandle()->ToObject();
 
   v8::Local<v8::Value> value =
-      obj->GetHiddenValue(v8::String::New(kCefUserData));
+      obj->GetHiddenValue(v8::String::NewSymbol(kCefUserData));
   if (!value.IsEmpty())
     return static_cast<CefBase*>(v8::External::Unwrap(value));
 
@@ -1008,8 +2367,9 @@ int CefV8ValueImpl::GetExternallyAllocatedMemory() {
     return 0;
   }
 
-  int* counter = GetExternallyAllocatedMemoryCounter();
-  return counter != NULL ? *counter : 0;
+  v8::HandleScope handle_scope;
+  V8TrackObject* tracker = GetTrackObject(GetHandle()->ToObject());
+  return tracker != NULL ? tracker->external_memory() : 0;
 }
 
 int CefV8ValueImpl::AdjustExternallyAllocatedMemory(int change_in_bytes) {
@@ -1019,24 +2379,45 @@ int CefV8ValueImpl::AdjustExternallyAllocatedMemory(int change_in_bytes) {
     return 0;
   }
 
-  int* counter = GetExternallyAllocatedMemoryCounter();
-  if (counter == NULL)
+  v8::HandleScope handle_scope;
+  V8TrackObject* tracker = GetTrackObject(GetHandle()->ToObject());
+  if (tracker == NULL)
     return 0;
 
-  int new_value = *counter + change_in_bytes;
+  int new_value = tracker->external_memory() + change_in_bytes;
   if (new_value < 0) {
     NOTREACHED() << "External memory usage cannot be less than 0 bytes";
-    change_in_bytes = -(*counter);
+    change_in_bytes = -tracker->external_memory();
     new_value = 0;
   }
 
   if (change_in_bytes != 0)
-    v8::V8::AdjustAmountOfExternalAllocatedMemory(change_in_bytes);
-  *counter = new_value;
+    tracker->AdjustExternalMemory(change_in_bytes);
 
   return new_value;
 }
 
+CefRefPtr<CefDictionaryValue> CefV8ValueImpl::GetDictionaryValue() {
+  CEF_REQUIRE_UI_THREAD(NULL);
+  if (!GetHandle()->IsObject()) {
+    NOTREACHED() << "V8 value is not an object";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  // Exceptions thrown by property getters cause the conversion to fail.
+  v8::TryCatch try_catch;
+  try_catch.SetVerbose(false);
+
+  CefRefPtr<CefDictionaryValueImpl> dict = new CefDictionaryValueImpl();
+  V8ObjectStack stack;
+  if (!V8ObjectToDictionary(GetHandle()->ToObject(), &stack, dict.get()))
+    return NULL;
+
+  return dict.get();
+}
+
 int CefV8ValueImpl::GetArrayLength() {
   CEF_REQUIRE_UI_THREAD(0);
   if (!GetHandle()->IsArray()) {
@@ -1050,6 +2431,55 @@ int CefV8ValueImpl::GetArrayLength() {
   return arr->Length();
 }
 
+void* CefV8ValueImpl::GetByteArrayData() {
+  CEF_REQUIRE_UI_THREAD(NULL);
+
+  v8::HandleScope handle_scope;
+  if (!GetHandle()->IsObject() ||
+      !IsExternalByteArray(GetHandle()->ToObject())) {
+    NOTREACHED() << "V8 value is not a byte array";
+    return NULL;
+  }
+
+  return GetHandle()->ToObject()->GetIndexedPropertiesExternalArrayData();
+}
+
+int CefV8ValueImpl::GetByteArrayLength() {
+  CEF_REQUIRE_UI_THREAD(0);
+
+  v8::HandleScope handle_scope;
+  if (!GetHandle()->IsObject() ||
+      !IsExternalByteArray(GetHandle()->ToObject())) {
+    NOTREACHED() << "V8 value is not a byte array";
+    return 0;
+  }
+
+  return GetHandle()->ToObject()->GetIndexedPropertiesExternalArrayDataLength();
+}
+
+CefRefPtr<CefListValue> CefV8ValueImpl::GetListValue() {
+  CEF_REQUIRE_UI_THREAD(NULL);
+  if (!GetHandle()->IsArray()) {
+    NOTREACHED() << "V8 value is not an array";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope;
+
+  // Exceptions thrown by property getters cause the conversion to fail.
+  v8::TryCatch try_catch;
+  try_catch.SetVerbose(false);
+
+  CefRefPtr<CefListValueImpl> list = new CefListValueImpl();
+  V8ObjectStack stack;
+  v8::Local<v8::Array> arr =
+      v8::Local<v8::Array>::Cast(GetHandle()->ToObject());
+  if (!V8ArrayToList(arr, &stack, list.get()))
+    return NULL;
+
+  return list.get();
+}
+
 CefString CefV8ValueImpl::GetFunctionName() {
   CefString rv;
   CEF_REQUIRE_UI_THREAD(rv);
@@ -1076,7 +2506,7 @@ CefRefPtr<CefV8Handler> CefV8ValueImpl::GetFunctionHandler() {
   v8::Local<v8::Object> obj = GetHandle()->ToObject();
 
   v8::Local<v8::Value> value =
-      obj->GetHiddenValue(v8::String::New(kCefHandler));
+      obj->GetHiddenValue(v8::String::NewSymbol(kCefHandler));
   if (!value.IsEmpty())
     return static_cast<CefV8Handler*>(v8::External::Unwrap(value));
 
@@ -1159,19 +2589,9 @@ bool CefV8ValueImpl::ExecuteFunctionWithContext(
 // static
 CefV8Accessor* CefV8ValueImpl::GetAccessor(v8::Handle<v8::Object> object) {
   v8::Local<v8::Value> value =
-      object->GetHiddenValue(v8::String::New(kCefAccessor));
+      object->GetHiddenValue(v8::String::NewSymbol(kCefAccessor));
   if (!value.IsEmpty())
     return static_cast<CefV8Accessor*>(v8::External::Unwrap(value));
 
   return NULL;
 }
-
-int* CefV8ValueImpl::GetExternallyAllocatedMemoryCounter() {
-  v8::HandleScope handle_scope;
-  v8::Local<v8::Object> obj = GetHandle()->ToObject();
-  v8::Local<v8::Value> value =
-      obj->GetHiddenValue(v8::String::New(kCefExternalMemory));
-
-  return value.IsEmpty() ? NULL : static_cast<int*>(
-      v8::External::Unwrap(value));
-}
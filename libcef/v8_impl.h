@@ -10,14 +10,80 @@
 #include "include/cef_v8.h"
 #include "v8/include/v8.h"
 #include "libcef/cef_thread.h"
+#include "libcef/tracker.h"
 #include "base/memory/ref_counted.h"
 
-class CefTrackNode;
+class CefListValueImpl;
 
 namespace WebKit {
 class WebFrame;
 };
 
+// Call after a V8 context has been created to begin tracking the native
+// objects referenced by V8 objects in that context.
+void CefV8ContextCreated(v8::Handle<v8::Context> context);
+
+// Call before a V8 context is released to release all native objects tracked
+// for that context.
+void CefV8ContextReleased(v8::Handle<v8::Context> context);
+
+// Execute |code| in the main world context of |frame| using the precompiled
+// script cache. Returns false if the script could not be executed this way.
+bool CefV8ExecuteScript(WebKit::WebFrame* frame,
+                        const CefString& code,
+                        const CefString& script_url,
+                        int start_line);
+
+// Evaluate |scripts| in order in the main world context of |frame|. The
+// converted result of each script is added to |results| and the exception
+// message, or an empty string, is added to |exceptions|. If |results| and
+// |exceptions| are both NULL the results are not converted and uncaught
+// exceptions are reported to the console. Returns false if the frame has no
+// script context.
+bool CefV8EvaluateScripts(WebKit::WebFrame* frame,
+                          const std::vector<CefString>& scripts,
+                          const CefString& script_url,
+                          int start_line,
+                          CefListValueImpl* results,
+                          CefListValueImpl* exceptions);
+
+// State associated with a single V8 context. Native objects referenced by V8
+// objects that were created in the context are tracked here and released in
+// bulk when the context is released. References to this class may be held on
+// any thread but its methods should only be called on the UI thread.
+class CefV8ContextState
+    : public base::RefCountedThreadSafe<CefV8ContextState,
+                                        CefThread::DeleteOnUIThread> {
+ public:
+  CefV8ContextState();
+  virtual ~CefV8ContextState();
+
+  // Returns false after the context has been released.
+  bool IsValid() { return valid_; }
+
+  // Release all tracked objects and mark the state as invalid.
+  void Detach();
+
+  // Add or delete an object tracked for this context.
+  void AddTrackObject(CefTrackNode* object);
+  void DeleteTrackObject(CefTrackNode* object);
+
+  // Adjust the counters reported by CefV8Context.
+  void AdjustObjectCount(int change) { object_count_ += change; }
+  void AdjustExternalMemory(int change) { external_memory_ += change; }
+
+  int object_count() { return object_count_; }
+  int external_memory() { return external_memory_; }
+
+ private:
+  bool valid_;
+  CefTrackManager track_manager_;
+  int object_count_;
+  int external_memory_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefV8ContextState);
+};
+
 // Template for V8 Handle types. This class is used to ensure that V8 objects
 // are only released on the UI thread.
 template <class v8class>
@@ -57,6 +123,79 @@ class CefV8ContextHandle : public CefReleaseV8HandleOnUIThread<v8::Context> {
   }
 };
 
+// Special class for a v8::String to ensure that it is deleted from the UI
+// thread.
+class CefV8StringHandle : public CefReleaseV8HandleOnUIThread<v8::String> {
+ public:
+  explicit CefV8StringHandle(handleType str)
+    : superType(str) {
+  }
+
+  ~CefV8StringHandle() {
+    v8_handle_.Dispose();
+    v8_handle_.Clear();
+  }
+};
+
+class CefV8PropertyNameImpl : public CefV8PropertyName {
+ public:
+  CefV8PropertyNameImpl(const CefString& name, v8::Handle<v8::String> symbol);
+  virtual ~CefV8PropertyNameImpl();
+
+  virtual CefString GetName() OVERRIDE;
+
+  inline v8::Handle<v8::String> GetHandle() {
+    DCHECK(v8_symbol_.get());
+    return v8_symbol_->GetHandle();
+  }
+
+ protected:
+  CefString name_;
+  scoped_refptr<CefV8StringHandle> v8_symbol_;
+
+  IMPLEMENT_REFCOUNTING(CefV8PropertyNameImpl);
+  DISALLOW_COPY_AND_ASSIGN(CefV8PropertyNameImpl);
+};
+
+// Special class for a v8::FunctionTemplate to ensure that it is deleted from
+// the UI thread.
+class CefV8FunctionTemplateHandle
+    : public CefReleaseV8HandleOnUIThread<v8::FunctionTemplate> {
+ public:
+  explicit CefV8FunctionTemplateHandle(handleType tmpl)
+    : superType(tmpl) {
+  }
+
+  ~CefV8FunctionTemplateHandle() {
+    v8_handle_.Dispose();
+    v8_handle_.Clear();
+  }
+};
+
+class CefV8FunctionTemplateImpl : public CefV8FunctionTemplate {
+ public:
+  CefV8FunctionTemplateImpl(const CefString& name,
+                            CefRefPtr<CefV8Handler> handler);
+  virtual ~CefV8FunctionTemplateImpl();
+
+  virtual CefString GetName() OVERRIDE;
+  virtual CefRefPtr<CefV8Handler> GetHandler() OVERRIDE;
+  virtual CefRefPtr<CefV8Value> GetFunction() OVERRIDE;
+
+  inline v8::Handle<v8::FunctionTemplate> GetHandle() {
+    DCHECK(v8_template_.get());
+    return v8_template_->GetHandle();
+  }
+
+ protected:
+  CefString name_;
+  CefRefPtr<CefV8Handler> handler_;
+  scoped_refptr<CefV8FunctionTemplateHandle> v8_template_;
+
+  IMPLEMENT_REFCOUNTING(CefV8FunctionTemplateImpl);
+  DISALLOW_COPY_AND_ASSIGN(CefV8FunctionTemplateImpl);
+};
+
 class CefV8ContextImpl : public CefV8Context {
  public:
   explicit CefV8ContextImpl(v8::Handle<v8::Context> context);
@@ -68,6 +207,8 @@ class CefV8ContextImpl : public CefV8Context {
   virtual bool Enter() OVERRIDE;
   virtual bool Exit() OVERRIDE;
   virtual bool IsSame(CefRefPtr<CefV8Context> that) OVERRIDE;
+  virtual int GetTrackedObjectCount() OVERRIDE;
+  virtual int GetExternallyAllocatedMemory() OVERRIDE;
 
   v8::Local<v8::Context> GetContext();
   WebKit::WebFrame* GetWebFrame();
@@ -120,6 +261,7 @@ class CefV8ValueImpl : public CefV8Value {
   virtual bool IsString() OVERRIDE;
   virtual bool IsObject() OVERRIDE;
   virtual bool IsArray() OVERRIDE;
+  virtual bool IsByteArray() OVERRIDE;
   virtual bool IsFunction() OVERRIDE;
   virtual bool IsSame(CefRefPtr<CefV8Value> value) OVERRIDE;
   virtual bool GetBoolValue() OVERRIDE;
@@ -129,20 +271,30 @@ class CefV8ValueImpl : public CefV8Value {
   virtual CefString GetStringValue() OVERRIDE;
   virtual bool HasValue(const CefString& key) OVERRIDE;
   virtual bool HasValue(int index) OVERRIDE;
+  virtual bool HasValue(CefRefPtr<CefV8PropertyName> name) OVERRIDE;
   virtual bool DeleteValue(const CefString& key) OVERRIDE;
   virtual bool DeleteValue(int index) OVERRIDE;
   virtual CefRefPtr<CefV8Value> GetValue(const CefString& key) OVERRIDE;
   virtual CefRefPtr<CefV8Value> GetValue(int index) OVERRIDE;
+  virtual CefRefPtr<CefV8Value> GetValue(
+      CefRefPtr<CefV8PropertyName> name) OVERRIDE;
   virtual bool SetValue(const CefString& key, CefRefPtr<CefV8Value> value,
                         PropertyAttribute attribute) OVERRIDE;
   virtual bool SetValue(int index, CefRefPtr<CefV8Value> value) OVERRIDE;
+  virtual bool SetValue(CefRefPtr<CefV8PropertyName> name,
+                        CefRefPtr<CefV8Value> value,
+                        PropertyAttribute attribute) OVERRIDE;
   virtual bool SetValue(const CefString& key, AccessControl settings,
                         PropertyAttribute attribute) OVERRIDE;
   virtual bool GetKeys(std::vector<CefString>& keys) OVERRIDE;
   virtual CefRefPtr<CefBase> GetUserData() OVERRIDE;
   virtual int GetExternallyAllocatedMemory() OVERRIDE;
   virtual int AdjustExternallyAllocatedMemory(int change_in_bytes) OVERRIDE;
+  virtual CefRefPtr<CefDictionaryValue> GetDictionaryValue() OVERRIDE;
   virtual int GetArrayLength() OVERRIDE;
+  virtual CefRefPtr<CefListValue> GetListValue() OVERRIDE;
+  virtual void* GetByteArrayData() OVERRIDE;
+  virtual int GetByteArrayLength() OVERRIDE;
   virtual CefString GetFunctionName() OVERRIDE;
   virtual CefRefPtr<CefV8Handler> GetFunctionHandler() OVERRIDE;
   virtual bool ExecuteFunction(CefRefPtr<CefV8Value> object,
@@ -166,9 +318,6 @@ class CefV8ValueImpl : public CefV8Value {
   // Returns the accessor assigned for the specified object, if any.
   static CefV8Accessor* GetAccessor(v8::Handle<v8::Object> object);
 
- private:
-  int* GetExternallyAllocatedMemoryCounter();
-
  protected:
   scoped_refptr<CefV8ValueHandle> v8_value_;
 
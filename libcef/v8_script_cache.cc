@@ -0,0 +1,292 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/v8_script_cache.h"
+#include "libcef/cef_thread.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/bind_helpers.h"
+#include "base/file_util.h"
+#include "base/logging.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/sha1.h"
+#include "base/string_number_conversions.h"
+#include "base/time.h"
+
+namespace {
+
+const FilePath::CharType kScriptCacheDirectory[] =
+    FILE_PATH_LITERAL("Script Cache");
+const FilePath::CharType kScriptCacheExtension[] =
+    FILE_PATH_LITERAL(".preparse");
+const FilePath::CharType kScriptCachePattern[] =
+    FILE_PATH_LITERAL("*.preparse");
+
+// V8 ignores precompiled data for scripts with fewer characters than this.
+const size_t kMinSourceLength = 1024;
+
+// Maximum number of bytes of precompiled data held in memory. The cache
+// directory is trimmed to the same size when entries are loaded.
+const size_t kMaxDataSize = 16 * 1024 * 1024;
+
+struct CacheFile {
+  FilePath path;
+  base::Time last_used;
+  int64 size;
+};
+
+// Orders cache files from most to least recently used.
+bool CompareLastUsed(const CacheFile& a, const CacheFile& b) {
+  return a.last_used > b.last_used;
+}
+
+// Hashes the string data in place to avoid converting large scripts to UTF8
+// on every call.
+std::string GetCacheKey(const CefString& code) {
+  unsigned char hash[base::kSHA1Length];
+  base::SHA1HashBytes(reinterpret_cast<const unsigned char*>(code.c_str()),
+                      code.length() * sizeof(CefString::char_type), hash);
+  return base::HexEncode(hash, sizeof(hash));
+}
+
+FilePath GetEntryPath(const FilePath& directory, const std::string& key) {
+  return directory.AppendASCII(key).AddExtension(kScriptCacheExtension);
+}
+
+}  // namespace
+
+CefV8ScriptCache::CefV8ScriptCache(const FilePath& cache_path)
+    : load_started_(false),
+      data_size_(0),
+      hit_count_(0),
+      miss_count_(0),
+      compile_time_(0),
+      precompile_time_(0),
+      ALLOW_THIS_IN_INITIALIZER_LIST(weak_ptr_factory_(this)) {
+  if (!cache_path.empty())
+    directory_ = cache_path.Append(kScriptCacheDirectory);
+}
+
+CefV8ScriptCache::~CefV8ScriptCache() {
+}
+
+v8::Local<v8::Script> CefV8ScriptCache::Compile(
+    v8::Handle<v8::String> source,
+    const CefString& code,
+    v8::ScriptOrigin* origin) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  base::TimeTicks compile_start = base::TimeTicks::Now();
+
+  scoped_ptr<v8::ScriptData> script_data;
+
+  // Check the length first to avoid hashing small scripts.
+  if (code.length() >= kMinSourceLength) {
+    std::string key = GetCacheKey(code);
+    EntryMap::iterator it = entries_.find(key);
+    if (it != entries_.end()) {
+      const std::string& data = it->second.data;
+      script_data.reset(v8::ScriptData::New(data.data(), data.size()));
+      hit_count_++;
+
+      lru_keys_.splice(lru_keys_.begin(), lru_keys_,
+                       it->second.lru_position);
+
+      // Mark the entry as recently used so that it is kept when the cache
+      // directory is trimmed.
+      if (!directory_.empty() && used_keys_.insert(key).second) {
+        CefThread::PostTask(CefThread::FILE, FROM_HERE,
+            base::Bind(&CefV8ScriptCache::FILET_TouchEntry, directory_, key));
+      }
+    } else {
+      base::TimeTicks precompile_start = base::TimeTicks::Now();
+      script_data.reset(v8::ScriptData::PreCompile(source));
+      precompile_time_ +=
+          (base::TimeTicks::Now() - precompile_start).InMillisecondsF();
+      miss_count_++;
+
+      if (script_data->HasError()) {
+        script_data.reset();
+      } else {
+        std::string data(script_data->Data(), script_data->Length());
+        if (AddEntry(key, data) && !directory_.empty()) {
+          used_keys_.insert(key);
+          CefThread::PostTask(CefThread::FILE, FROM_HERE,
+              base::Bind(&CefV8ScriptCache::FILET_WriteEntry, directory_, key,
+                         data));
+        }
+      }
+    }
+  }
+
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(source, origin, script_data.get());
+
+  compile_time_ += (base::TimeTicks::Now() - compile_start).InMillisecondsF();
+  return script;
+}
+
+void CefV8ScriptCache::GetStatistics(CefV8ScriptCacheStatistics& statistics) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  statistics.hit_count = hit_count_;
+  statistics.miss_count = miss_count_;
+  statistics.entry_count = static_cast<int>(entries_.size());
+  statistics.data_size = data_size_;
+  statistics.compile_time = compile_time_;
+  statistics.precompile_time = precompile_time_;
+}
+
+bool CefV8ScriptCache::AddEntry(const std::string& key,
+                                const std::string& data) {
+  if (data.size() > kMaxDataSize || entries_.find(key) != entries_.end())
+    return false;
+
+  while (data_size_ + data.size() > kMaxDataSize)
+    EvictEntry();
+
+  Entry& entry = entries_[key];
+  entry.data = data;
+  entry.lru_position = lru_keys_.insert(lru_keys_.begin(), key);
+  data_size_ += data.size();
+  return true;
+}
+
+void CefV8ScriptCache::EvictEntry() {
+  DCHECK(!lru_keys_.empty());
+
+  const std::string key = lru_keys_.back();
+  lru_keys_.pop_back();
+
+  EntryMap::iterator it = entries_.find(key);
+  DCHECK(it != entries_.end());
+  data_size_ -= it->second.data.size();
+  entries_.erase(it);
+
+  if (!directory_.empty()) {
+    used_keys_.erase(key);
+    CefThread::PostTask(CefThread::FILE, FROM_HERE,
+        base::Bind(&CefV8ScriptCache::FILET_DeleteEntry, directory_, key));
+  }
+}
+
+void CefV8ScriptCache::LoadEntries() {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  if (load_started_ || directory_.empty())
+    return;
+  load_started_ = true;
+
+  CefThread::PostTask(CefThread::FILE, FROM_HERE,
+      base::Bind(&CefV8ScriptCache::FILET_LoadEntries, directory_,
+                 weak_ptr_factory_.GetWeakPtr()));
+}
+
+// static
+void CefV8ScriptCache::FILET_LoadEntries(
+    const FilePath& directory,
+    base::WeakPtr<CefV8ScriptCache> cache) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  std::vector<CacheFile> files;
+
+  file_util::FileEnumerator file_enumerator(directory, false,
+      file_util::FileEnumerator::FILES, kScriptCachePattern);
+  for (FilePath file_path = file_enumerator.Next(); !file_path.empty();
+       file_path = file_enumerator.Next()) {
+    file_util::FileEnumerator::FindInfo info;
+    file_enumerator.GetFindInfo(&info);
+
+    CacheFile file;
+    file.path = file_path;
+    file.last_used = file_util::FileEnumerator::GetLastModifiedTime(info);
+    file.size = file_util::FileEnumerator::GetFilesize(info);
+    files.push_back(file);
+  }
+
+  std::sort(files.begin(), files.end(), CompareLastUsed);
+
+  LoadedEntryList* entries = new LoadedEntryList();
+  size_t data_size = 0;
+
+  // Load the most recently used entries that fit within the size limit and
+  // delete the rest.
+  std::vector<CacheFile>::const_iterator it = files.begin();
+  for (; it != files.end(); ++it) {
+    std::string key = it->path.BaseName().RemoveExtension().MaybeAsASCII();
+    std::string data;
+    if (key.empty() || it->size <= 0 ||
+        data_size + static_cast<size_t>(it->size) > kMaxDataSize ||
+        !file_util::ReadFileToString(it->path, &data) || data.empty()) {
+      file_util::Delete(it->path, false);
+      continue;
+    }
+
+    entries->push_back(std::make_pair(key, data));
+    data_size += data.size();
+  }
+
+  CefThread::PostTask(CefThread::UI, FROM_HERE,
+      base::Bind(&CefV8ScriptCache::UIT_AddLoadedEntries, cache,
+                 base::Owned(entries)));
+}
+
+void CefV8ScriptCache::UIT_AddLoadedEntries(LoadedEntryList* entries) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::UI));
+
+  LoadedEntryList::const_iterator it = entries->begin();
+  for (; it != entries->end(); ++it) {
+    const std::string& key = it->first;
+    const std::string& data = it->second;
+    if (data_size_ + data.size() > kMaxDataSize)
+      break;
+    if (entries_.find(key) != entries_.end())
+      continue;
+
+    Entry& entry = entries_[key];
+    entry.data = data;
+    entry.lru_position = lru_keys_.insert(lru_keys_.end(), key);
+    data_size_ += data.size();
+  }
+}
+
+// static
+void CefV8ScriptCache::FILET_WriteEntry(const FilePath& directory,
+                                        const std::string& key,
+                                        const std::string& data) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  if (!file_util::DirectoryExists(directory) &&
+      !file_util::CreateDirectory(directory)) {
+    LOG(WARNING) << "Failed to create script cache directory";
+    return;
+  }
+
+  FilePath file_path = GetEntryPath(directory, key);
+  int size = static_cast<int>(data.size());
+  if (file_util::WriteFile(file_path, data.data(), size) != size) {
+    LOG(WARNING) << "Failed to write script cache entry";
+    file_util::Delete(file_path, false);
+  }
+}
+
+// static
+void CefV8ScriptCache::FILET_TouchEntry(const FilePath& directory,
+                                        const std::string& key) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  base::Time now = base::Time::Now();
+  file_util::TouchFile(GetEntryPath(directory, key), now, now);
+}
+
+// static
+void CefV8ScriptCache::FILET_DeleteEntry(const FilePath& directory,
+                                         const std::string& key) {
+  DCHECK(CefThread::CurrentlyOn(CefThread::FILE));
+
+  file_util::Delete(GetEntryPath(directory, key), false);
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_V8_SCRIPT_CACHE_H_
+#define CEF_LIBCEF_V8_SCRIPT_CACHE_H_
+#pragma once
+
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/internal/cef_types_wrappers.h"
+#include "v8/include/v8.h"
+
+#include "base/file_path.h"
+#include "base/memory/weak_ptr.h"
+
+// Caches the V8 precompiled (preparse) data for scripts executed using
+// CefFrame::ExecuteJavaScript(). Entries are keyed by a hash of the script
+// source so that the same script injected into multiple frames is only
+// precompiled once. When the size limit is reached the least recently used
+// entries are evicted. If a cache directory is specified entries are also
+// written to disk and loaded at startup so that they can be reused across
+// sessions.
+// This object is owned by CefContext and should only be accessed on the UI
+// thread.
+class CefV8ScriptCache {
+ public:
+  // If |cache_path| is empty entries will be stored in memory only.
+  explicit CefV8ScriptCache(const FilePath& cache_path);
+  ~CefV8ScriptCache();
+
+  // Compile |source| in the current context using cached precompiled data if
+  // available. |code| is the same source and is hashed in place to generate
+  // the cache key. Returns an empty handle if compilation fails.
+  v8::Local<v8::Script> Compile(v8::Handle<v8::String> source,
+                                const CefString& code,
+                                v8::ScriptOrigin* origin);
+
+  // Begin loading existing entries from disk. Must be called after the FILE
+  // thread has been created. Does nothing for an in-memory cache.
+  void LoadEntries();
+
+  // Retrieve the cache statistics.
+  void GetStatistics(CefV8ScriptCacheStatistics& statistics);
+
+ private:
+  // Keys ordered from most to least recently used.
+  typedef std::list<std::string> KeyList;
+
+  struct Entry {
+    std::string data;
+    // Position of the entry's key in |lru_keys_|.
+    KeyList::iterator lru_position;
+  };
+  typedef std::map<std::string, Entry> EntryMap;
+
+  // Entries loaded from disk ordered from most to least recently used.
+  typedef std::vector<std::pair<std::string, std::string> > LoadedEntryList;
+
+  // Add a newly precompiled entry to the in-memory cache as the most recently
+  // used entry. Least recently used entries are evicted until the new entry
+  // fits within the size limit. Returns false if the entry already exists or
+  // is larger than the size limit.
+  bool AddEntry(const std::string& key, const std::string& data);
+
+  // Evict the least recently used entry.
+  void EvictEntry();
+
+  // Load existing entries from disk on the FILE thread. Entries that do not
+  // fit within the size limit are deleted, least recently used first.
+  static void FILET_LoadEntries(const FilePath& directory,
+                                base::WeakPtr<CefV8ScriptCache> cache);
+  // Loaded entries are older than any entry added in this session so they
+  // are only added while space remains.
+  void UIT_AddLoadedEntries(LoadedEntryList* entries);
+
+  // Write an entry to disk on the FILE thread.
+  static void FILET_WriteEntry(const FilePath& directory,
+                               const std::string& key,
+                               const std::string& data);
+
+  // Update the last used time of an entry on disk on the FILE thread.
+  static void FILET_TouchEntry(const FilePath& directory,
+                               const std::string& key);
+
+  // Delete an evicted entry from disk on the FILE thread.
+  static void FILET_DeleteEntry(const FilePath& directory,
+                                const std::string& key);
+
+  // Directory where entries are stored on disk. Empty if entries are stored
+  // in memory only.
+  FilePath directory_;
+  bool load_started_;
+
+  EntryMap entries_;
+  KeyList lru_keys_;
+  size_t data_size_;
+
+  // Keys of entries that have been used in this session.
+  std::set<std::string> used_keys_;
+
+  int hit_count_;
+  int miss_count_;
+  double compile_time_;
+  double precompile_time_;
+
+  base::WeakPtrFactory<CefV8ScriptCache> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefV8ScriptCache);
+};
+
+#endif  // CEF_LIBCEF_V8_SCRIPT_CACHE_H_
@@ -0,0 +1,305 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/values_impl.h"
+
+#include "base/logging.h"
+
+// static
+CefRefPtr<CefDictionaryValue> CefDictionaryValue::Create() {
+  return new CefDictionaryValueImpl();
+}
+
+// static
+CefRefPtr<CefListValue> CefListValue::Create() {
+  return new CefListValueImpl();
+}
+
+
+// CefDictionaryValueImpl
+
+CefDictionaryValueImpl::CefDictionaryValueImpl() {
+}
+
+int CefDictionaryValueImpl::GetSize() {
+  return static_cast<int>(entries_.size());
+}
+
+void CefDictionaryValueImpl::Clear() {
+  entries_.clear();
+}
+
+bool CefDictionaryValueImpl::HasKey(const CefString& key) {
+  return (entries_.find(key) != entries_.end());
+}
+
+bool CefDictionaryValueImpl::GetKeys(KeyList& keys) {
+  EntryMap::const_iterator it = entries_.begin();
+  for (; it != entries_.end(); ++it)
+    keys.push_back(it->first);
+  return true;
+}
+
+bool CefDictionaryValueImpl::Remove(const CefString& key) {
+  return (entries_.erase(key) > 0);
+}
+
+CefValueType CefDictionaryValueImpl::GetType(const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return entry ? entry->type : VTYPE_INVALID;
+}
+
+bool CefDictionaryValueImpl::GetBool(const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return (entry && entry->type == VTYPE_BOOL) ? entry->bool_value : false;
+}
+
+int CefDictionaryValueImpl::GetInt(const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return (entry && entry->type == VTYPE_INT) ? entry->int_value : 0;
+}
+
+double CefDictionaryValueImpl::GetDouble(const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return (entry && entry->type == VTYPE_DOUBLE) ? entry->double_value : 0;
+}
+
+CefString CefDictionaryValueImpl::GetString(const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return (entry && entry->type == VTYPE_STRING) ?
+      entry->string_value : CefString();
+}
+
+CefRefPtr<CefDictionaryValue> CefDictionaryValueImpl::GetDictionary(
+    const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return (entry && entry->type == VTYPE_DICTIONARY) ?
+      entry->dictionary_value : NULL;
+}
+
+CefRefPtr<CefListValue> CefDictionaryValueImpl::GetList(const CefString& key) {
+  const CefValueEntry* entry = Find(key);
+  return (entry && entry->type == VTYPE_LIST) ? entry->list_value : NULL;
+}
+
+bool CefDictionaryValueImpl::SetNull(const CefString& key) {
+  Insert(key);
+  return true;
+}
+
+bool CefDictionaryValueImpl::SetBool(const CefString& key, bool value) {
+  CefValueEntry& entry = Insert(key);
+  entry.type = VTYPE_BOOL;
+  entry.bool_value = value;
+  return true;
+}
+
+bool CefDictionaryValueImpl::SetInt(const CefString& key, int value) {
+  CefValueEntry& entry = Insert(key);
+  entry.type = VTYPE_INT;
+  entry.int_value = value;
+  return true;
+}
+
+bool CefDictionaryValueImpl::SetDouble(const CefString& key, double value) {
+  CefValueEntry& entry = Insert(key);
+  entry.type = VTYPE_DOUBLE;
+  entry.double_value = value;
+  return true;
+}
+
+bool CefDictionaryValueImpl::SetString(const CefString& key,
+                                       const CefString& value) {
+  CefValueEntry& entry = Insert(key);
+  entry.type = VTYPE_STRING;
+  entry.string_value = value;
+  return true;
+}
+
+bool CefDictionaryValueImpl::SetDictionary(
+    const CefString& key, CefRefPtr<CefDictionaryValue> value) {
+  if (!value.get()) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+  CefValueEntry& entry = Insert(key);
+  entry.type = VTYPE_DICTIONARY;
+  entry.dictionary_value = value;
+  return true;
+}
+
+bool CefDictionaryValueImpl::SetList(const CefString& key,
+                                     CefRefPtr<CefListValue> value) {
+  if (!value.get()) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+  CefValueEntry& entry = Insert(key);
+  entry.type = VTYPE_LIST;
+  entry.list_value = value;
+  return true;
+}
+
+CefValueEntry& CefDictionaryValueImpl::Insert(const CefString& key) {
+  CefValueEntry& entry = entries_[key];
+  entry = CefValueEntry();
+  return entry;
+}
+
+const CefValueEntry* CefDictionaryValueImpl::Find(const CefString& key) const {
+  EntryMap::const_iterator it = entries_.find(key);
+  return (it != entries_.end()) ? &it->second : NULL;
+}
+
+
+// CefListValueImpl
+
+CefListValueImpl::CefListValueImpl() {
+}
+
+bool CefListValueImpl::SetSize(int size) {
+  if (size < 0) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+  entries_.resize(size);
+  return true;
+}
+
+int CefListValueImpl::GetSize() {
+  return static_cast<int>(entries_.size());
+}
+
+void CefListValueImpl::Clear() {
+  entries_.clear();
+}
+
+bool CefListValueImpl::Remove(int index) {
+  if (!Find(index))
+    return false;
+  entries_.erase(entries_.begin() + index);
+  return true;
+}
+
+CefValueType CefListValueImpl::GetType(int index) {
+  const CefValueEntry* entry = Find(index);
+  return entry ? entry->type : VTYPE_INVALID;
+}
+
+bool CefListValueImpl::GetBool(int index) {
+  const CefValueEntry* entry = Find(index);
+  return (entry && entry->type == VTYPE_BOOL) ? entry->bool_value : false;
+}
+
+int CefListValueImpl::GetInt(int index) {
+  const CefValueEntry* entry = Find(index);
+  return (entry && entry->type == VTYPE_INT) ? entry->int_value : 0;
+}
+
+double CefListValueImpl::GetDouble(int index) {
+  const CefValueEntry* entry = Find(index);
+  return (entry && entry->type == VTYPE_DOUBLE) ? entry->double_value : 0;
+}
+
+CefString CefListValueImpl::GetString(int index) {
+  const CefValueEntry* entry = Find(index);
+  return (entry && entry->type == VTYPE_STRING) ?
+      entry->string_value : CefString();
+}
+
+CefRefPtr<CefDictionaryValue> CefListValueImpl::GetDictionary(int index) {
+  const CefValueEntry* entry = Find(index);
+  return (entry && entry->type == VTYPE_DICTIONARY) ?
+      entry->dictionary_value : NULL;
+}
+
+CefRefPtr<CefListValue> CefListValueImpl::GetList(int index) {
+  const CefValueEntry* entry = Find(index);
+  return (entry && entry->type == VTYPE_LIST) ? entry->list_value : NULL;
+}
+
+bool CefListValueImpl::SetNull(int index) {
+  return (Insert(index) != NULL);
+}
+
+bool CefListValueImpl::SetBool(int index, bool value) {
+  CefValueEntry* entry = Insert(index);
+  if (!entry)
+    return false;
+  entry->type = VTYPE_BOOL;
+  entry->bool_value = value;
+  return true;
+}
+
+bool CefListValueImpl::SetInt(int index, int value) {
+  CefValueEntry* entry = Insert(index);
+  if (!entry)
+    return false;
+  entry->type = VTYPE_INT;
+  entry->int_value = value;
+  return true;
+}
+
+bool CefListValueImpl::SetDouble(int index, double value) {
+  CefValueEntry* entry = Insert(index);
+  if (!entry)
+    return false;
+  entry->type = VTYPE_DOUBLE;
+  entry->double_value = value;
+  return true;
+}
+
+bool CefListValueImpl::SetString(int index, const CefString& value) {
+  CefValueEntry* entry = Insert(index);
+  if (!entry)
+    return false;
+  entry->type = VTYPE_STRING;
+  entry->string_value = value;
+  return true;
+}
+
+bool CefListValueImpl::SetDictionary(int index,
+                                     CefRefPtr<CefDictionaryValue> value) {
+  if (!value.get()) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+  CefValueEntry* entry = Insert(index);
+  if (!entry)
+    return false;
+  entry->type = VTYPE_DICTIONARY;
+  entry->dictionary_value = value;
+  return true;
+}
+
+bool CefListValueImpl::SetList(int index, CefRefPtr<CefListValue> value) {
+  if (!value.get()) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+  CefValueEntry* entry = Insert(index);
+  if (!entry)
+    return false;
+  entry->type = VTYPE_LIST;
+  entry->list_value = value;
+  return true;
+}
+
+const CefValueEntry* CefListValueImpl::Find(int index) const {
+  if (index < 0 || index >= static_cast<int>(entries_.size()))
+    return NULL;
+  return &entries_[index];
+}
+
+CefValueEntry* CefListValueImpl::Insert(int index) {
+  if (index < 0) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+  if (index >= static_cast<int>(entries_.size()))
+    entries_.resize(index + 1);
+  CefValueEntry* entry = &entries_[index];
+  *entry = CefValueEntry();
+  return entry;
+}
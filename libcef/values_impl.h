@@ -0,0 +1,121 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_VALUES_IMPL_H_
+#define CEF_LIBCEF_VALUES_IMPL_H_
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "include/cef_values.h"
+
+// A single dictionary or list entry. Only the member matching |type| is used.
+struct CefValueEntry {
+  CefValueEntry()
+    : type(VTYPE_NULL),
+      bool_value(false),
+      int_value(0),
+      double_value(0) {
+  }
+
+  CefValueType type;
+  bool bool_value;
+  int int_value;
+  double double_value;
+  CefString string_value;
+  CefRefPtr<CefDictionaryValue> dictionary_value;
+  CefRefPtr<CefListValue> list_value;
+};
+
+// Implementation of CefDictionaryValue.
+class CefDictionaryValueImpl : public CefDictionaryValue {
+ public:
+  typedef std::map<CefString, CefValueEntry> EntryMap;
+
+  CefDictionaryValueImpl();
+
+  virtual int GetSize() OVERRIDE;
+  virtual void Clear() OVERRIDE;
+  virtual bool HasKey(const CefString& key) OVERRIDE;
+  virtual bool GetKeys(KeyList& keys) OVERRIDE;
+  virtual bool Remove(const CefString& key) OVERRIDE;
+  virtual CefValueType GetType(const CefString& key) OVERRIDE;
+  virtual bool GetBool(const CefString& key) OVERRIDE;
+  virtual int GetInt(const CefString& key) OVERRIDE;
+  virtual double GetDouble(const CefString& key) OVERRIDE;
+  virtual CefString GetString(const CefString& key) OVERRIDE;
+  virtual CefRefPtr<CefDictionaryValue> GetDictionary(
+      const CefString& key) OVERRIDE;
+  virtual CefRefPtr<CefListValue> GetList(const CefString& key) OVERRIDE;
+  virtual bool SetNull(const CefString& key) OVERRIDE;
+  virtual bool SetBool(const CefString& key, bool value) OVERRIDE;
+  virtual bool SetInt(const CefString& key, int value) OVERRIDE;
+  virtual bool SetDouble(const CefString& key, double value) OVERRIDE;
+  virtual bool SetString(const CefString& key,
+                         const CefString& value) OVERRIDE;
+  virtual bool SetDictionary(const CefString& key,
+                             CefRefPtr<CefDictionaryValue> value) OVERRIDE;
+  virtual bool SetList(const CefString& key,
+                       CefRefPtr<CefListValue> value) OVERRIDE;
+
+  // Direct access to the entries for bulk conversion.
+  const EntryMap& entries() const { return entries_; }
+  CefValueEntry& Insert(const CefString& key);
+
+ private:
+  // Returns the entry for |key| or NULL if no such entry exists.
+  const CefValueEntry* Find(const CefString& key) const;
+
+  EntryMap entries_;
+
+  IMPLEMENT_REFCOUNTING(CefDictionaryValueImpl);
+  DISALLOW_COPY_AND_ASSIGN(CefDictionaryValueImpl);
+};
+
+// Implementation of CefListValue.
+class CefListValueImpl : public CefListValue {
+ public:
+  typedef std::vector<CefValueEntry> EntryList;
+
+  CefListValueImpl();
+
+  virtual bool SetSize(int size) OVERRIDE;
+  virtual int GetSize() OVERRIDE;
+  virtual void Clear() OVERRIDE;
+  virtual bool Remove(int index) OVERRIDE;
+  virtual CefValueType GetType(int index) OVERRIDE;
+  virtual bool GetBool(int index) OVERRIDE;
+  virtual int GetInt(int index) OVERRIDE;
+  virtual double GetDouble(int index) OVERRIDE;
+  virtual CefString GetString(int index) OVERRIDE;
+  virtual CefRefPtr<CefDictionaryValue> GetDictionary(int index) OVERRIDE;
+  virtual CefRefPtr<CefListValue> GetList(int index) OVERRIDE;
+  virtual bool SetNull(int index) OVERRIDE;
+  virtual bool SetBool(int index, bool value) OVERRIDE;
+  virtual bool SetInt(int index, int value) OVERRIDE;
+  virtual bool SetDouble(int index, double value) OVERRIDE;
+  virtual bool SetString(int index, const CefString& value) OVERRIDE;
+  virtual bool SetDictionary(int index,
+                             CefRefPtr<CefDictionaryValue> value) OVERRIDE;
+  virtual bool SetList(int index, CefRefPtr<CefListValue> value) OVERRIDE;
+
+  // Direct access to the entries for bulk conversion.
+  const EntryList& entries() const { return entries_; }
+  EntryList& mutable_entries() { return entries_; }
+
+ private:
+  // Returns the entry at |index| or NULL if |index| is out of range.
+  const CefValueEntry* Find(int index) const;
+
+  // Returns a reset entry at |index|, expanding the list if necessary.
+  CefValueEntry* Insert(int index);
+
+  EntryList entries_;
+
+  IMPLEMENT_REFCOUNTING(CefListValueImpl);
+  DISALLOW_COPY_AND_ASSIGN(CefListValueImpl);
+};
+
+#endif  // CEF_LIBCEF_VALUES_IMPL_H_
@@ -469,6 +469,18 @@ void CEF_CALLBACK browser_close_dev_tools(struct _cef_browser_t* self) {
   CefBrowserCppToC::Get(self)->CloseDevTools();
 }
 
+void CEF_CALLBACK browser_invalidate_cookie_manager(
+    struct _cef_browser_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserCppToC::Get(self)->InvalidateCookieManager();
+}
+
 int CEF_CALLBACK browser_is_window_rendering_disabled(
     struct _cef_browser_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -726,6 +738,7 @@ CefBrowserCppToC::CefBrowserCppToC(CefBrowser* cls)
   struct_.struct_.clear_history = browser_clear_history;
   struct_.struct_.show_dev_tools = browser_show_dev_tools;
   struct_.struct_.close_dev_tools = browser_close_dev_tools;
+  struct_.struct_.invalidate_cookie_manager = browser_invalidate_cookie_manager;
   struct_.struct_.is_window_rendering_disabled =
       browser_is_window_rendering_disabled;
   struct_.struct_.get_size = browser_get_size;
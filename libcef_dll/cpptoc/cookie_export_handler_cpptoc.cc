@@ -0,0 +1,52 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cookie_export_handler_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK cookie_export_handler_on_cookies_exported(
+    struct _cef_cookie_export_handler_t* self, const cef_string_t* data,
+    int count) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: data; type: string_byref_const
+  DCHECK(data);
+  if (!data)
+    return;
+
+  // Execute
+  CefCookieExportHandlerCppToC::Get(self)->OnCookiesExported(
+      CefString(data),
+      count);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCookieExportHandlerCppToC::CefCookieExportHandlerCppToC(
+    CefCookieExportHandler* cls)
+    : CefCppToC<CefCookieExportHandlerCppToC, CefCookieExportHandler,
+        cef_cookie_export_handler_t>(cls) {
+  struct_.struct_.on_cookies_exported =
+      cookie_export_handler_on_cookies_exported;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefCookieExportHandlerCppToC, CefCookieExportHandler,
+    cef_cookie_export_handler_t>::DebugObjCt = 0;
+#endif
+
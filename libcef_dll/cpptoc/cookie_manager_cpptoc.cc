@@ -11,7 +11,10 @@
 //
 
 #include "libcef_dll/cpptoc/cookie_manager_cpptoc.h"
+#include "libcef_dll/ctocpp/cookie_export_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/cookie_page_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_visitor_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
 
 
 // GLOBAL FUNCTIONS - Body may be edited by hand.
@@ -40,6 +43,22 @@ CEF_EXPORT cef_cookie_manager_t* cef_cookie_manager_create_manager(
   return CefCookieManagerCppToC::Wrap(_retval);
 }
 
+CEF_EXPORT cef_cookie_manager_t* cef_cookie_manager_create_partitioned_manager(
+    const cef_string_t* path, const cef_string_t* partition) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: path, partition
+
+  // Execute
+  CefRefPtr<CefCookieManager> _retval =
+      CefCookieManager::CreatePartitionedManager(
+      CefString(path),
+      CefString(partition));
+
+  // Return type: refptr_same
+  return CefCookieManagerCppToC::Wrap(_retval);
+}
+
 
 // MEMBER FUNCTIONS - Body may be edited by hand.
 
@@ -91,6 +110,33 @@ int CEF_CALLBACK cookie_manager_visit_url_cookies(
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_visit_cookie_pages(
+    struct _cef_cookie_manager_t* self, const cef_string_t* domain,
+    const cef_string_t* name, int page_size, const cef_string_t* cursor,
+    struct _cef_cookie_page_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return 0;
+  // Unverified params: domain, name, cursor
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->VisitCookiePages(
+      CefString(domain),
+      CefString(name),
+      page_size,
+      CefString(cursor),
+      CefCookiePageVisitorCToCpp::Wrap(visitor));
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK cookie_manager_set_cookie(struct _cef_cookie_manager_t* self,
     const cef_string_t* url, const struct _cef_cookie_t* cookie) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -140,6 +186,103 @@ int CEF_CALLBACK cookie_manager_delete_cookies(
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_set_cookies(struct _cef_cookie_manager_t* self,
+    const cef_string_t* url, cef_string_list_t cookie_lines) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: url; type: string_byref_const
+  DCHECK(url);
+  if (!url)
+    return 0;
+  // Verify param: cookie_lines; type: string_vec_byref_const
+  DCHECK(cookie_lines);
+  if (!cookie_lines)
+    return 0;
+
+  // Translate param: cookie_lines; type: string_vec_byref_const
+  std::vector<CefString> cookie_linesList;
+  transfer_string_list_contents(cookie_lines, cookie_linesList);
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->SetCookies(
+      CefString(url),
+      cookie_linesList);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_delete_url_cookies(
+    struct _cef_cookie_manager_t* self, cef_string_list_t urls,
+    const cef_string_t* cookie_name) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: urls; type: string_vec_byref_const
+  DCHECK(urls);
+  if (!urls)
+    return 0;
+  // Unverified params: cookie_name
+
+  // Translate param: urls; type: string_vec_byref_const
+  std::vector<CefString> urlsList;
+  transfer_string_list_contents(urls, urlsList);
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->DeleteUrlCookies(
+      urlsList,
+      CefString(cookie_name));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_export_cookies(
+    struct _cef_cookie_manager_t* self,
+    struct _cef_cookie_export_handler_t* handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler);
+  if (!handler)
+    return 0;
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->ExportCookies(
+      CefCookieExportHandlerCToCpp::Wrap(handler));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_import_cookies(
+    struct _cef_cookie_manager_t* self, const cef_string_t* data) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: data; type: string_byref_const
+  DCHECK(data);
+  if (!data)
+    return 0;
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->ImportCookies(
+      CefString(data));
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK cookie_manager_set_storage_path(
     struct _cef_cookie_manager_t* self, const cef_string_t* path) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -157,6 +300,36 @@ int CEF_CALLBACK cookie_manager_set_storage_path(
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_get_load_metrics(
+    struct _cef_cookie_manager_t* self,
+    struct _cef_cookie_load_metrics_t* metrics) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: metrics; type: struct_byref
+  DCHECK(metrics);
+  if (!metrics)
+    return 0;
+
+  // Translate param: metrics; type: struct_byref
+  CefCookieLoadMetrics metricsObj;
+  if (metrics)
+    metricsObj.AttachTo(*metrics);
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->GetLoadMetrics(
+      metricsObj);
+
+  // Restore param: metrics; type: struct_byref
+  if (metrics)
+    metricsObj.DetachTo(*metrics);
+
+  // Return type: bool
+  return _retval;
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
@@ -165,9 +338,15 @@ CefCookieManagerCppToC::CefCookieManagerCppToC(CefCookieManager* cls)
         cls) {
   struct_.struct_.visit_all_cookies = cookie_manager_visit_all_cookies;
   struct_.struct_.visit_url_cookies = cookie_manager_visit_url_cookies;
+  struct_.struct_.visit_cookie_pages = cookie_manager_visit_cookie_pages;
   struct_.struct_.set_cookie = cookie_manager_set_cookie;
   struct_.struct_.delete_cookies = cookie_manager_delete_cookies;
+  struct_.struct_.set_cookies = cookie_manager_set_cookies;
+  struct_.struct_.delete_url_cookies = cookie_manager_delete_url_cookies;
+  struct_.struct_.export_cookies = cookie_manager_export_cookies;
+  struct_.struct_.import_cookies = cookie_manager_import_cookies;
   struct_.struct_.set_storage_path = cookie_manager_set_storage_path;
+  struct_.struct_.get_load_metrics = cookie_manager_get_load_metrics;
 }
 
 #ifndef NDEBUG
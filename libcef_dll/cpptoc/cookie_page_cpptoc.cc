@@ -0,0 +1,75 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cookie_page_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK cookie_page_get_count(struct _cef_cookie_page_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int _retval = CefCookiePageCppToC::Get(self)->GetCount();
+
+  // Return type: simple
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_page_get_cookie(struct _cef_cookie_page_t* self,
+    int index, struct _cef_cookie_t* cookie) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: cookie; type: struct_byref
+  DCHECK(cookie);
+  if (!cookie)
+    return 0;
+
+  // Translate param: cookie; type: struct_byref
+  CefCookie cookieObj;
+  if (cookie)
+    cookieObj.AttachTo(*cookie);
+
+  // Execute
+  bool _retval = CefCookiePageCppToC::Get(self)->GetCookie(
+      index,
+      cookieObj);
+
+  // Restore param: cookie; type: struct_byref
+  if (cookie)
+    cookieObj.DetachTo(*cookie);
+
+  // Return type: bool
+  return _retval;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCookiePageCppToC::CefCookiePageCppToC(CefCookiePage* cls)
+    : CefCppToC<CefCookiePageCppToC, CefCookiePage, cef_cookie_page_t>(cls) {
+  struct_.struct_.get_count = cookie_page_get_count;
+  struct_.struct_.get_cookie = cookie_page_get_cookie;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefCookiePageCppToC, CefCookiePage,
+    cef_cookie_page_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,57 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cookie_page_visitor_cpptoc.h"
+#include "libcef_dll/ctocpp/cookie_page_ctocpp.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK cookie_page_visitor_visit(
+    struct _cef_cookie_page_visitor_t* self, cef_cookie_page_t* page,
+    const cef_string_t* next_cursor, int total) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: page; type: refptr_diff
+  DCHECK(page);
+  if (!page)
+    return 0;
+  // Unverified params: next_cursor
+
+  // Execute
+  bool _retval = CefCookiePageVisitorCppToC::Get(self)->Visit(
+      CefCookiePageCToCpp::Wrap(page),
+      CefString(next_cursor),
+      total);
+
+  // Return type: bool
+  return _retval;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCookiePageVisitorCppToC::CefCookiePageVisitorCppToC(
+    CefCookiePageVisitor* cls)
+    : CefCppToC<CefCookiePageVisitorCppToC, CefCookiePageVisitor,
+        cef_cookie_page_visitor_t>(cls) {
+  struct_.struct_.visit = cookie_page_visitor_visit;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefCookiePageVisitorCppToC, CefCookiePageVisitor,
+    cef_cookie_page_visitor_t>::DebugObjCt = 0;
+#endif
+
@@ -16,6 +16,8 @@
 #include "libcef_dll/cpptoc/stream_reader_cpptoc.h"
 #include "libcef_dll/cpptoc/v8context_cpptoc.h"
 #include "libcef_dll/ctocpp/domvisitor_ctocpp.h"
+#include "libcef_dll/ctocpp/java_script_result_callback_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
 
 
 // MEMBER FUNCTIONS - Body may be edited by hand.
@@ -246,6 +248,53 @@ void CEF_CALLBACK frame_execute_java_script(struct _cef_frame_t* self,
       startLine);
 }
 
+void CEF_CALLBACK frame_evaluate_java_script(struct _cef_frame_t* self,
+    const cef_string_t* jsCode, const cef_string_t* scriptUrl, int startLine,
+    cef_java_script_result_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback);
+  if (!callback)
+    return;
+  // Unverified params: jsCode, scriptUrl
+
+  // Execute
+  CefFrameCppToC::Get(self)->EvaluateJavaScript(
+      CefString(jsCode),
+      CefString(scriptUrl),
+      startLine,
+      CefJavaScriptResultCallbackCToCpp::Wrap(callback));
+}
+
+void CEF_CALLBACK frame_execute_java_script_batch(struct _cef_frame_t* self,
+    cef_string_list_t jsCodes, const cef_string_t* scriptUrl,
+    cef_java_script_result_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: jsCodes; type: string_vec_byref_const
+  DCHECK(jsCodes);
+  if (!jsCodes)
+    return;
+  // Unverified params: scriptUrl, callback
+
+  // Translate param: jsCodes; type: string_vec_byref_const
+  std::vector<CefString> jsCodesList;
+  transfer_string_list_contents(jsCodes, jsCodesList);
+
+  // Execute
+  CefFrameCppToC::Get(self)->ExecuteJavaScriptBatch(
+      jsCodesList,
+      CefString(scriptUrl),
+      CefJavaScriptResultCallbackCToCpp::Wrap(callback));
+}
+
 int CEF_CALLBACK frame_is_main(struct _cef_frame_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -397,6 +446,8 @@ CefFrameCppToC::CefFrameCppToC(CefFrame* cls)
   struct_.struct_.load_string = frame_load_string;
   struct_.struct_.load_stream = frame_load_stream;
   struct_.struct_.execute_java_script = frame_execute_java_script;
+  struct_.struct_.evaluate_java_script = frame_evaluate_java_script;
+  struct_.struct_.execute_java_script_batch = frame_execute_java_script_batch;
   struct_.struct_.is_main = frame_is_main;
   struct_.struct_.is_focused = frame_is_focused;
   struct_.struct_.get_name = frame_get_name;
@@ -0,0 +1,57 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/java_script_result_callback_cpptoc.h"
+#include "libcef_dll/ctocpp/list_value_ctocpp.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK java_script_result_callback_on_complete(
+    struct _cef_java_script_result_callback_t* self,
+    struct _cef_list_value_t* results, struct _cef_list_value_t* exceptions) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: results; type: refptr_diff
+  DCHECK(results);
+  if (!results)
+    return;
+  // Verify param: exceptions; type: refptr_diff
+  DCHECK(exceptions);
+  if (!exceptions)
+    return;
+
+  // Execute
+  CefJavaScriptResultCallbackCppToC::Get(self)->OnComplete(
+      CefListValueCToCpp::Wrap(results),
+      CefListValueCToCpp::Wrap(exceptions));
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefJavaScriptResultCallbackCppToC::CefJavaScriptResultCallbackCppToC(
+    CefJavaScriptResultCallback* cls)
+    : CefCppToC<CefJavaScriptResultCallbackCppToC, CefJavaScriptResultCallback,
+        cef_java_script_result_callback_t>(cls) {
+  struct_.struct_.on_complete = java_script_result_callback_on_complete;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefJavaScriptResultCallbackCppToC,
+    CefJavaScriptResultCallback,
+    cef_java_script_result_callback_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,75 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/storage_batch_visitor_cpptoc.h"
+#include "libcef_dll/transfer_util.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK storage_batch_visitor_visit(
+    struct _cef_storage_batch_visitor_t* self, enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys,
+    cef_string_list_t values, int count, int total) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: origin; type: string_byref_const
+  DCHECK(origin);
+  if (!origin)
+    return 0;
+  // Verify param: keys; type: string_vec_byref_const
+  DCHECK(keys);
+  if (!keys)
+    return 0;
+  // Verify param: values; type: string_vec_byref_const
+  DCHECK(values);
+  if (!values)
+    return 0;
+
+  // Translate param: keys; type: string_vec_byref_const
+  std::vector<CefString> keysList;
+  transfer_string_list_contents(keys, keysList);
+  // Translate param: values; type: string_vec_byref_const
+  std::vector<CefString> valuesList;
+  transfer_string_list_contents(values, valuesList);
+
+  // Execute
+  bool _retval = CefStorageBatchVisitorCppToC::Get(self)->Visit(
+      type,
+      CefString(origin),
+      keysList,
+      valuesList,
+      count,
+      total);
+
+  // Return type: bool
+  return _retval;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefStorageBatchVisitorCppToC::CefStorageBatchVisitorCppToC(
+    CefStorageBatchVisitor* cls)
+    : CefCppToC<CefStorageBatchVisitorCppToC, CefStorageBatchVisitor,
+        cef_storage_batch_visitor_t>(cls) {
+  struct_.struct_.visit = storage_batch_visitor_visit;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefStorageBatchVisitorCppToC, CefStorageBatchVisitor,
+    cef_storage_batch_visitor_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,150 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/storage_changes_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK storage_changes_get_count(
+    struct _cef_storage_changes_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int _retval = CefStorageChangesCppToC::Get(self)->GetCount();
+
+  // Return type: simple
+  return _retval;
+}
+
+enum cef_storage_type_t CEF_CALLBACK storage_changes_get_storage_type(
+    struct _cef_storage_changes_t* self, int index) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return ST_LOCALSTORAGE;
+
+  // Execute
+  cef_storage_type_t _retval = CefStorageChangesCppToC::Get(
+      self)->GetStorageType(
+      index);
+
+  // Return type: simple
+  return _retval;
+}
+
+enum cef_storage_change_type_t CEF_CALLBACK storage_changes_get_change_type(
+    struct _cef_storage_changes_t* self, int index) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return SCT_SET;
+
+  // Execute
+  cef_storage_change_type_t _retval = CefStorageChangesCppToC::Get(
+      self)->GetChangeType(
+      index);
+
+  // Return type: simple
+  return _retval;
+}
+
+cef_string_userfree_t CEF_CALLBACK storage_changes_get_origin(
+    struct _cef_storage_changes_t* self, int index) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefString _retval = CefStorageChangesCppToC::Get(self)->GetOrigin(
+      index);
+
+  // Return type: string
+  return _retval.DetachToUserFree();
+}
+
+cef_string_userfree_t CEF_CALLBACK storage_changes_get_key(
+    struct _cef_storage_changes_t* self, int index) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefString _retval = CefStorageChangesCppToC::Get(self)->GetKey(
+      index);
+
+  // Return type: string
+  return _retval.DetachToUserFree();
+}
+
+cef_string_userfree_t CEF_CALLBACK storage_changes_get_old_value(
+    struct _cef_storage_changes_t* self, int index) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefString _retval = CefStorageChangesCppToC::Get(self)->GetOldValue(
+      index);
+
+  // Return type: string
+  return _retval.DetachToUserFree();
+}
+
+cef_string_userfree_t CEF_CALLBACK storage_changes_get_new_value(
+    struct _cef_storage_changes_t* self, int index) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefString _retval = CefStorageChangesCppToC::Get(self)->GetNewValue(
+      index);
+
+  // Return type: string
+  return _retval.DetachToUserFree();
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefStorageChangesCppToC::CefStorageChangesCppToC(CefStorageChanges* cls)
+    : CefCppToC<CefStorageChangesCppToC, CefStorageChanges,
+        cef_storage_changes_t>(cls) {
+  struct_.struct_.get_count = storage_changes_get_count;
+  struct_.struct_.get_storage_type = storage_changes_get_storage_type;
+  struct_.struct_.get_change_type = storage_changes_get_change_type;
+  struct_.struct_.get_origin = storage_changes_get_origin;
+  struct_.struct_.get_key = storage_changes_get_key;
+  struct_.struct_.get_old_value = storage_changes_get_old_value;
+  struct_.struct_.get_new_value = storage_changes_get_new_value;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefStorageChangesCppToC, CefStorageChanges,
+    cef_storage_changes_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,49 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/storage_observer_cpptoc.h"
+#include "libcef_dll/ctocpp/storage_changes_ctocpp.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK storage_observer_on_storage_changed(
+    struct _cef_storage_observer_t* self, cef_storage_changes_t* changes) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: changes; type: refptr_diff
+  DCHECK(changes);
+  if (!changes)
+    return;
+
+  // Execute
+  CefStorageObserverCppToC::Get(self)->OnStorageChanged(
+      CefStorageChangesCToCpp::Wrap(changes));
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefStorageObserverCppToC::CefStorageObserverCppToC(CefStorageObserver* cls)
+    : CefCppToC<CefStorageObserverCppToC, CefStorageObserver,
+        cef_storage_observer_t>(cls) {
+  struct_.struct_.on_storage_changed = storage_observer_on_storage_changed;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefStorageObserverCppToC, CefStorageObserver,
+    cef_storage_observer_t>::DebugObjCt = 0;
+#endif
+
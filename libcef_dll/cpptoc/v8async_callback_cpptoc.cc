@@ -0,0 +1,64 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/list_value_cpptoc.h"
+#include "libcef_dll/cpptoc/v8async_callback_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK v8async_callback_success(struct _cef_v8async_callback_t* self,
+    struct _cef_list_value_t* results) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Unverified params: results
+
+  // Execute
+  CefV8AsyncCallbackCppToC::Get(self)->Success(
+      CefListValueCppToC::Unwrap(results));
+}
+
+void CEF_CALLBACK v8async_callback_failure(struct _cef_v8async_callback_t* self,
+    const cef_string_t* exception) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: exception; type: string_byref_const
+  DCHECK(exception);
+  if (!exception)
+    return;
+
+  // Execute
+  CefV8AsyncCallbackCppToC::Get(self)->Failure(
+      CefString(exception));
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8AsyncCallbackCppToC::CefV8AsyncCallbackCppToC(CefV8AsyncCallback* cls)
+    : CefCppToC<CefV8AsyncCallbackCppToC, CefV8AsyncCallback,
+        cef_v8async_callback_t>(cls) {
+  struct_.struct_.success = v8async_callback_success;
+  struct_.struct_.failure = v8async_callback_failure;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefV8AsyncCallbackCppToC, CefV8AsyncCallback,
+    cef_v8async_callback_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,61 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/v8async_handler_cpptoc.h"
+#include "libcef_dll/ctocpp/list_value_ctocpp.h"
+#include "libcef_dll/ctocpp/v8async_callback_ctocpp.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK v8async_handler_execute(struct _cef_v8async_handler_t* self,
+    const cef_string_t* name, struct _cef_list_value_t* arguments,
+    cef_v8async_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: name; type: string_byref_const
+  DCHECK(name);
+  if (!name)
+    return;
+  // Verify param: arguments; type: refptr_diff
+  DCHECK(arguments);
+  if (!arguments)
+    return;
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback);
+  if (!callback)
+    return;
+
+  // Execute
+  CefV8AsyncHandlerCppToC::Get(self)->Execute(
+      CefString(name),
+      CefListValueCToCpp::Wrap(arguments),
+      CefV8AsyncCallbackCToCpp::Wrap(callback));
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8AsyncHandlerCppToC::CefV8AsyncHandlerCppToC(CefV8AsyncHandler* cls)
+    : CefCppToC<CefV8AsyncHandlerCppToC, CefV8AsyncHandler,
+        cef_v8async_handler_t>(cls) {
+  struct_.struct_.execute = v8async_handler_execute;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefV8AsyncHandlerCppToC, CefV8AsyncHandler,
+    cef_v8async_handler_t>::DebugObjCt = 0;
+#endif
+
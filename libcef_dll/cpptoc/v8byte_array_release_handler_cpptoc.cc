@@ -0,0 +1,51 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/v8byte_array_release_handler_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK v8byte_array_release_handler_release_buffer(
+    struct _cef_v8byte_array_release_handler_t* self, void* buffer) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: buffer; type: simple_byaddr
+  DCHECK(buffer);
+  if (!buffer)
+    return;
+
+  // Execute
+  CefV8ByteArrayReleaseHandlerCppToC::Get(self)->ReleaseBuffer(
+      buffer);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8ByteArrayReleaseHandlerCppToC::CefV8ByteArrayReleaseHandlerCppToC(
+    CefV8ByteArrayReleaseHandler* cls)
+    : CefCppToC<CefV8ByteArrayReleaseHandlerCppToC,
+        CefV8ByteArrayReleaseHandler, cef_v8byte_array_release_handler_t>(
+        cls) {
+  struct_.struct_.release_buffer = v8byte_array_release_handler_release_buffer;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefV8ByteArrayReleaseHandlerCppToC,
+    CefV8ByteArrayReleaseHandler,
+    cef_v8byte_array_release_handler_t>::DebugObjCt = 0;
+#endif
+
@@ -143,6 +143,36 @@ int CEF_CALLBACK v8context_is_same(struct _cef_v8context_t* self,
   return _retval;
 }
 
+int CEF_CALLBACK v8context_get_tracked_object_count(
+    struct _cef_v8context_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int _retval = CefV8ContextCppToC::Get(self)->GetTrackedObjectCount();
+
+  // Return type: simple
+  return _retval;
+}
+
+int CEF_CALLBACK v8context_get_externally_allocated_memory(
+    struct _cef_v8context_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int _retval = CefV8ContextCppToC::Get(self)->GetExternallyAllocatedMemory();
+
+  // Return type: simple
+  return _retval;
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
@@ -154,6 +184,9 @@ CefV8ContextCppToC::CefV8ContextCppToC(CefV8Context* cls)
   struct_.struct_.enter = v8context_enter;
   struct_.struct_.exit = v8context_exit;
   struct_.struct_.is_same = v8context_is_same;
+  struct_.struct_.get_tracked_object_count = v8context_get_tracked_object_count;
+  struct_.struct_.get_externally_allocated_memory =
+      v8context_get_externally_allocated_memory;
 }
 
 #ifndef NDEBUG
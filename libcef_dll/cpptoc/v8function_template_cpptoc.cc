@@ -0,0 +1,108 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/v8function_template_cpptoc.h"
+#include "libcef_dll/cpptoc/v8value_cpptoc.h"
+#include "libcef_dll/ctocpp/v8handler_ctocpp.h"
+
+
+// GLOBAL FUNCTIONS - Body may be edited by hand.
+
+CEF_EXPORT cef_v8function_template_t* cef_v8function_template_create(
+    const cef_string_t* name, cef_v8handler_t* handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(name);
+  if (!name)
+    return NULL;
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler);
+  if (!handler)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8FunctionTemplate> _retval = CefV8FunctionTemplate::Create(
+      CefString(name),
+      CefV8HandlerCToCpp::Wrap(handler));
+
+  // Return type: refptr_same
+  return CefV8FunctionTemplateCppToC::Wrap(_retval);
+}
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+cef_string_userfree_t CEF_CALLBACK v8function_template_get_name(
+    struct _cef_v8function_template_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefString _retval = CefV8FunctionTemplateCppToC::Get(self)->GetName();
+
+  // Return type: string
+  return _retval.DetachToUserFree();
+}
+
+cef_v8handler_t* CEF_CALLBACK v8function_template_get_handler(
+    struct _cef_v8function_template_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8Handler> _retval = CefV8FunctionTemplateCppToC::Get(
+      self)->GetHandler();
+
+  // Return type: refptr_diff
+  return CefV8HandlerCToCpp::Unwrap(_retval);
+}
+
+struct _cef_v8value_t* CEF_CALLBACK v8function_template_get_function(
+    struct _cef_v8function_template_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8Value> _retval = CefV8FunctionTemplateCppToC::Get(
+      self)->GetFunction();
+
+  // Return type: refptr_same
+  return CefV8ValueCppToC::Wrap(_retval);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8FunctionTemplateCppToC::CefV8FunctionTemplateCppToC(
+    CefV8FunctionTemplate* cls)
+    : CefCppToC<CefV8FunctionTemplateCppToC, CefV8FunctionTemplate,
+        cef_v8function_template_t>(cls) {
+  struct_.struct_.get_name = v8function_template_get_name;
+  struct_.struct_.get_handler = v8function_template_get_handler;
+  struct_.struct_.get_function = v8function_template_get_function;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefV8FunctionTemplateCppToC, CefV8FunctionTemplate,
+    cef_v8function_template_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,54 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/v8gchandler_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK v8gchandler_on_garbage_collection(
+    struct _cef_v8gchandler_t* self, int full, double pause_time,
+    const cef_v8heap_statistics_t* statistics) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: statistics; type: simple_byref_const
+  DCHECK(statistics);
+  if (!statistics)
+    return;
+
+  // Translate param: statistics; type: simple_byref_const
+  CefV8HeapStatistics statisticsVal =
+      statistics?*statistics:CefV8HeapStatistics();
+
+  // Execute
+  CefV8GCHandlerCppToC::Get(self)->OnGarbageCollection(
+      full?true:false,
+      pause_time,
+      statisticsVal);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8GCHandlerCppToC::CefV8GCHandlerCppToC(CefV8GCHandler* cls)
+    : CefCppToC<CefV8GCHandlerCppToC, CefV8GCHandler, cef_v8gchandler_t>(cls) {
+  struct_.struct_.on_garbage_collection = v8gchandler_on_garbage_collection;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefV8GCHandlerCppToC, CefV8GCHandler,
+    cef_v8gchandler_t>::DebugObjCt = 0;
+#endif
+
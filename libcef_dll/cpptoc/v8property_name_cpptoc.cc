@@ -0,0 +1,66 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/v8property_name_cpptoc.h"
+
+
+// GLOBAL FUNCTIONS - Body may be edited by hand.
+
+CEF_EXPORT cef_v8property_name_t* cef_v8property_name_create(
+    const cef_string_t* name) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(name);
+  if (!name)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8PropertyName> _retval = CefV8PropertyName::Create(
+      CefString(name));
+
+  // Return type: refptr_same
+  return CefV8PropertyNameCppToC::Wrap(_retval);
+}
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+cef_string_userfree_t CEF_CALLBACK v8property_name_get_name(
+    struct _cef_v8property_name_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefString _retval = CefV8PropertyNameCppToC::Get(self)->GetName();
+
+  // Return type: string
+  return _retval.DetachToUserFree();
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8PropertyNameCppToC::CefV8PropertyNameCppToC(CefV8PropertyName* cls)
+    : CefCppToC<CefV8PropertyNameCppToC, CefV8PropertyName,
+        cef_v8property_name_t>(cls) {
+  struct_.struct_.get_name = v8property_name_get_name;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefV8PropertyNameCppToC, CefV8PropertyName,
+    cef_v8property_name_t>::DebugObjCt = 0;
+#endif
+
@@ -10,11 +10,16 @@
 // for more information.
 //
 
+#include "libcef_dll/cpptoc/dictionary_value_cpptoc.h"
+#include "libcef_dll/cpptoc/list_value_cpptoc.h"
 #include "libcef_dll/cpptoc/v8context_cpptoc.h"
 #include "libcef_dll/cpptoc/v8exception_cpptoc.h"
+#include "libcef_dll/cpptoc/v8property_name_cpptoc.h"
 #include "libcef_dll/cpptoc/v8value_cpptoc.h"
 #include "libcef_dll/ctocpp/base_ctocpp.h"
 #include "libcef_dll/ctocpp/v8accessor_ctocpp.h"
+#include "libcef_dll/ctocpp/v8async_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/v8byte_array_release_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/v8handler_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
 
@@ -131,6 +136,22 @@ CEF_EXPORT cef_v8value_t* cef_v8value_create_array() {
   return CefV8ValueCppToC::Wrap(_retval);
 }
 
+CEF_EXPORT cef_v8value_t* cef_v8value_create_byte_array(void* buffer,
+    int length, cef_v8byte_array_release_handler_t* release_handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: buffer, release_handler
+
+  // Execute
+  CefRefPtr<CefV8Value> _retval = CefV8Value::CreateByteArray(
+      buffer,
+      length,
+      CefV8ByteArrayReleaseHandlerCToCpp::Wrap(release_handler));
+
+  // Return type: refptr_same
+  return CefV8ValueCppToC::Wrap(_retval);
+}
+
 CEF_EXPORT cef_v8value_t* cef_v8value_create_function(const cef_string_t* name,
     cef_v8handler_t* handler) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -153,6 +174,62 @@ CEF_EXPORT cef_v8value_t* cef_v8value_create_function(const cef_string_t* name,
   return CefV8ValueCppToC::Wrap(_retval);
 }
 
+CEF_EXPORT cef_v8value_t* cef_v8value_create_async_function(
+    const cef_string_t* name, cef_v8async_handler_t* handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(name);
+  if (!name)
+    return NULL;
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler);
+  if (!handler)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8Value> _retval = CefV8Value::CreateAsyncFunction(
+      CefString(name),
+      CefV8AsyncHandlerCToCpp::Wrap(handler));
+
+  // Return type: refptr_same
+  return CefV8ValueCppToC::Wrap(_retval);
+}
+
+CEF_EXPORT cef_v8value_t* cef_v8value_create_from_dictionary(
+    struct _cef_dictionary_value_t* value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: value; type: refptr_same
+  DCHECK(value);
+  if (!value)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8Value> _retval = CefV8Value::CreateFromDictionary(
+      CefDictionaryValueCppToC::Unwrap(value));
+
+  // Return type: refptr_same
+  return CefV8ValueCppToC::Wrap(_retval);
+}
+
+CEF_EXPORT cef_v8value_t* cef_v8value_create_from_list(
+    struct _cef_list_value_t* value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: value; type: refptr_same
+  DCHECK(value);
+  if (!value)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8Value> _retval = CefV8Value::CreateFromList(
+      CefListValueCppToC::Unwrap(value));
+
+  // Return type: refptr_same
+  return CefV8ValueCppToC::Wrap(_retval);
+}
+
 
 // MEMBER FUNCTIONS - Body may be edited by hand.
 
@@ -282,6 +359,20 @@ int CEF_CALLBACK v8value_is_array(struct _cef_v8value_t* self) {
   return _retval;
 }
 
+int CEF_CALLBACK v8value_is_byte_array(struct _cef_v8value_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefV8ValueCppToC::Get(self)->IsByteArray();
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK v8value_is_function(struct _cef_v8value_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -427,6 +518,26 @@ int CEF_CALLBACK v8value_has_value_byindex(struct _cef_v8value_t* self,
   return _retval;
 }
 
+int CEF_CALLBACK v8value_has_value_byname(struct _cef_v8value_t* self,
+    cef_v8property_name_t* name) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: name; type: refptr_same
+  DCHECK(name);
+  if (!name)
+    return 0;
+
+  // Execute
+  bool _retval = CefV8ValueCppToC::Get(self)->HasValue(
+      CefV8PropertyNameCppToC::Unwrap(name));
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK v8value_delete_value_bykey(struct _cef_v8value_t* self,
     const cef_string_t* key) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -507,6 +618,26 @@ struct _cef_v8value_t* CEF_CALLBACK v8value_get_value_byindex(
   return CefV8ValueCppToC::Wrap(_retval);
 }
 
+struct _cef_v8value_t* CEF_CALLBACK v8value_get_value_byname(
+    struct _cef_v8value_t* self, cef_v8property_name_t* name) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+  // Verify param: name; type: refptr_same
+  DCHECK(name);
+  if (!name)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefV8Value> _retval = CefV8ValueCppToC::Get(self)->GetValue(
+      CefV8PropertyNameCppToC::Unwrap(name));
+
+  // Return type: refptr_same
+  return CefV8ValueCppToC::Wrap(_retval);
+}
+
 int CEF_CALLBACK v8value_set_value_bykey(struct _cef_v8value_t* self,
     const cef_string_t* key, struct _cef_v8value_t* value,
     enum cef_v8_propertyattribute_t attribute) {
@@ -559,6 +690,33 @@ int CEF_CALLBACK v8value_set_value_byindex(struct _cef_v8value_t* self,
   return _retval;
 }
 
+int CEF_CALLBACK v8value_set_value_byname(struct _cef_v8value_t* self,
+    cef_v8property_name_t* name, struct _cef_v8value_t* value,
+    enum cef_v8_propertyattribute_t attribute) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: name; type: refptr_same
+  DCHECK(name);
+  if (!name)
+    return 0;
+  // Verify param: value; type: refptr_same
+  DCHECK(value);
+  if (!value)
+    return 0;
+
+  // Execute
+  bool _retval = CefV8ValueCppToC::Get(self)->SetValue(
+      CefV8PropertyNameCppToC::Unwrap(name),
+      CefV8ValueCppToC::Unwrap(value),
+      attribute);
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK v8value_set_value_byaccessor(struct _cef_v8value_t* self,
     const cef_string_t* key, enum cef_v8_accesscontrol_t settings,
     enum cef_v8_propertyattribute_t attribute) {
@@ -655,6 +813,22 @@ int CEF_CALLBACK v8value_adjust_externally_allocated_memory(
   return _retval;
 }
 
+struct _cef_dictionary_value_t* CEF_CALLBACK v8value_get_dictionary_value(
+    struct _cef_v8value_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefDictionaryValue> _retval = CefV8ValueCppToC::Get(
+      self)->GetDictionaryValue();
+
+  // Return type: refptr_same
+  return CefDictionaryValueCppToC::Wrap(_retval);
+}
+
 int CEF_CALLBACK v8value_get_array_length(struct _cef_v8value_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -669,6 +843,49 @@ int CEF_CALLBACK v8value_get_array_length(struct _cef_v8value_t* self) {
   return _retval;
 }
 
+struct _cef_list_value_t* CEF_CALLBACK v8value_get_list_value(
+    struct _cef_v8value_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefListValue> _retval = CefV8ValueCppToC::Get(self)->GetListValue();
+
+  // Return type: refptr_same
+  return CefListValueCppToC::Wrap(_retval);
+}
+
+void* CEF_CALLBACK v8value_get_byte_array_data(struct _cef_v8value_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  void* _retval = CefV8ValueCppToC::Get(self)->GetByteArrayData();
+
+  // Return type: simple
+  return _retval;
+}
+
+int CEF_CALLBACK v8value_get_byte_array_length(struct _cef_v8value_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int _retval = CefV8ValueCppToC::Get(self)->GetByteArrayLength();
+
+  // Return type: simple
+  return _retval;
+}
+
 cef_string_userfree_t CEF_CALLBACK v8value_get_function_name(
     struct _cef_v8value_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -868,6 +1085,7 @@ CefV8ValueCppToC::CefV8ValueCppToC(CefV8Value* cls)
   struct_.struct_.is_string = v8value_is_string;
   struct_.struct_.is_object = v8value_is_object;
   struct_.struct_.is_array = v8value_is_array;
+  struct_.struct_.is_byte_array = v8value_is_byte_array;
   struct_.struct_.is_function = v8value_is_function;
   struct_.struct_.is_same = v8value_is_same;
   struct_.struct_.get_bool_value = v8value_get_bool_value;
@@ -877,12 +1095,15 @@ CefV8ValueCppToC::CefV8ValueCppToC(CefV8Value* cls)
   struct_.struct_.get_string_value = v8value_get_string_value;
   struct_.struct_.has_value_bykey = v8value_has_value_bykey;
   struct_.struct_.has_value_byindex = v8value_has_value_byindex;
+  struct_.struct_.has_value_byname = v8value_has_value_byname;
   struct_.struct_.delete_value_bykey = v8value_delete_value_bykey;
   struct_.struct_.delete_value_byindex = v8value_delete_value_byindex;
   struct_.struct_.get_value_bykey = v8value_get_value_bykey;
   struct_.struct_.get_value_byindex = v8value_get_value_byindex;
+  struct_.struct_.get_value_byname = v8value_get_value_byname;
   struct_.struct_.set_value_bykey = v8value_set_value_bykey;
   struct_.struct_.set_value_byindex = v8value_set_value_byindex;
+  struct_.struct_.set_value_byname = v8value_set_value_byname;
   struct_.struct_.set_value_byaccessor = v8value_set_value_byaccessor;
   struct_.struct_.get_keys = v8value_get_keys;
   struct_.struct_.get_user_data = v8value_get_user_data;
@@ -890,7 +1111,11 @@ CefV8ValueCppToC::CefV8ValueCppToC(CefV8Value* cls)
       v8value_get_externally_allocated_memory;
   struct_.struct_.adjust_externally_allocated_memory =
       v8value_adjust_externally_allocated_memory;
+  struct_.struct_.get_dictionary_value = v8value_get_dictionary_value;
   struct_.struct_.get_array_length = v8value_get_array_length;
+  struct_.struct_.get_list_value = v8value_get_list_value;
+  struct_.struct_.get_byte_array_data = v8value_get_byte_array_data;
+  struct_.struct_.get_byte_array_length = v8value_get_byte_array_length;
   struct_.struct_.get_function_name = v8value_get_function_name;
   struct_.struct_.get_function_handler = v8value_get_function_handler;
   struct_.struct_.execute_function = v8value_execute_function;
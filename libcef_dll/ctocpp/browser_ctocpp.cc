@@ -392,6 +392,16 @@ void CefBrowserCToCpp::CloseDevTools() {
   struct_->close_dev_tools(struct_);
 }
 
+void CefBrowserCToCpp::InvalidateCookieManager() {
+  if (CEF_MEMBER_MISSING(struct_, invalidate_cookie_manager))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->invalidate_cookie_manager(struct_);
+}
+
 bool CefBrowserCToCpp::IsWindowRenderingDisabled() {
   if (CEF_MEMBER_MISSING(struct_, is_window_rendering_disabled))
     return false;
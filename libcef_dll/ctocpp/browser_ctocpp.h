@@ -62,6 +62,7 @@ class CefBrowserCToCpp
   virtual void ClearHistory() OVERRIDE;
   virtual void ShowDevTools() OVERRIDE;
   virtual void CloseDevTools() OVERRIDE;
+  virtual void InvalidateCookieManager() OVERRIDE;
   virtual bool IsWindowRenderingDisabled() OVERRIDE;
   virtual bool GetSize(PaintElementType type, int& width, int& height) OVERRIDE;
   virtual void SetSize(PaintElementType type, int width, int height) OVERRIDE;
@@ -0,0 +1,41 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/cookie_export_handler_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefCookieExportHandlerCToCpp::OnCookiesExported(const CefString& data,
+    int count) {
+  if (CEF_MEMBER_MISSING(struct_, on_cookies_exported))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: data; type: string_byref_const
+  DCHECK(!data.empty());
+  if (data.empty())
+    return;
+
+  // Execute
+  struct_->on_cookies_exported(struct_,
+      data.GetStruct(),
+      count);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefCookieExportHandlerCToCpp, CefCookieExportHandler,
+    cef_cookie_export_handler_t>::DebugObjCt = 0;
+#endif
+
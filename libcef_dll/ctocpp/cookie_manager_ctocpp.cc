@@ -10,8 +10,11 @@
 // for more information.
 //
 
+#include "libcef_dll/cpptoc/cookie_export_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/cookie_page_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_visitor_cpptoc.h"
 #include "libcef_dll/ctocpp/cookie_manager_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
 
 
 // STATIC METHODS - Body may be edited by hand.
@@ -40,6 +43,21 @@ CefRefPtr<CefCookieManager> CefCookieManager::CreateManager(
   return CefCookieManagerCToCpp::Wrap(_retval);
 }
 
+CefRefPtr<CefCookieManager> CefCookieManager::CreatePartitionedManager(
+    const CefString& path, const CefString& partition) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: path, partition
+
+  // Execute
+  cef_cookie_manager_t* _retval = cef_cookie_manager_create_partitioned_manager(
+      path.GetStruct(),
+      partition.GetStruct());
+
+  // Return type: refptr_same
+  return CefCookieManagerCToCpp::Wrap(_retval);
+}
+
 
 // VIRTUAL METHODS - Body may be edited by hand.
 
@@ -89,6 +107,32 @@ bool CefCookieManagerCToCpp::VisitUrlCookies(const CefString& url,
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::VisitCookiePages(const CefString& domain,
+    const CefString& name, int page_size, const CefString& cursor,
+    CefRefPtr<CefCookiePageVisitor> visitor) {
+  if (CEF_MEMBER_MISSING(struct_, visit_cookie_pages))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return false;
+  // Unverified params: domain, name, cursor
+
+  // Execute
+  int _retval = struct_->visit_cookie_pages(struct_,
+      domain.GetStruct(),
+      name.GetStruct(),
+      page_size,
+      cursor.GetStruct(),
+      CefCookiePageVisitorCppToC::Wrap(visitor));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefCookieManagerCToCpp::SetCookie(const CefString& url,
     const CefCookie& cookie) {
   if (CEF_MEMBER_MISSING(struct_, set_cookie))
@@ -128,6 +172,104 @@ bool CefCookieManagerCToCpp::DeleteCookies(const CefString& url,
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::SetCookies(const CefString& url,
+    const std::vector<CefString>& cookie_lines) {
+  if (CEF_MEMBER_MISSING(struct_, set_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: url; type: string_byref_const
+  DCHECK(!url.empty());
+  if (url.empty())
+    return false;
+
+  // Translate param: cookie_lines; type: string_vec_byref_const
+  cef_string_list_t cookie_linesList = cef_string_list_alloc();
+  DCHECK(cookie_linesList);
+  if (cookie_linesList)
+    transfer_string_list_contents(cookie_lines, cookie_linesList);
+
+  // Execute
+  int _retval = struct_->set_cookies(struct_,
+      url.GetStruct(),
+      cookie_linesList);
+
+  // Restore param:cookie_lines; type: string_vec_byref_const
+  if (cookie_linesList)
+    cef_string_list_free(cookie_linesList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::DeleteUrlCookies(
+    const std::vector<CefString>& urls, const CefString& cookie_name) {
+  if (CEF_MEMBER_MISSING(struct_, delete_url_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: cookie_name
+
+  // Translate param: urls; type: string_vec_byref_const
+  cef_string_list_t urlsList = cef_string_list_alloc();
+  DCHECK(urlsList);
+  if (urlsList)
+    transfer_string_list_contents(urls, urlsList);
+
+  // Execute
+  int _retval = struct_->delete_url_cookies(struct_,
+      urlsList,
+      cookie_name.GetStruct());
+
+  // Restore param:urls; type: string_vec_byref_const
+  if (urlsList)
+    cef_string_list_free(urlsList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::ExportCookies(
+    CefRefPtr<CefCookieExportHandler> handler) {
+  if (CEF_MEMBER_MISSING(struct_, export_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler.get());
+  if (!handler.get())
+    return false;
+
+  // Execute
+  int _retval = struct_->export_cookies(struct_,
+      CefCookieExportHandlerCppToC::Wrap(handler));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::ImportCookies(const CefString& data) {
+  if (CEF_MEMBER_MISSING(struct_, import_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: data; type: string_byref_const
+  DCHECK(!data.empty());
+  if (data.empty())
+    return false;
+
+  // Execute
+  int _retval = struct_->import_cookies(struct_,
+      data.GetStruct());
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefCookieManagerCToCpp::SetStoragePath(const CefString& path) {
   if (CEF_MEMBER_MISSING(struct_, set_storage_path))
     return false;
@@ -144,6 +286,20 @@ bool CefCookieManagerCToCpp::SetStoragePath(const CefString& path) {
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::GetLoadMetrics(CefCookieLoadMetrics& metrics) {
+  if (CEF_MEMBER_MISSING(struct_, get_load_metrics))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_load_metrics(struct_,
+      &metrics);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 
 #ifndef NDEBUG
 template<> long CefCToCpp<CefCookieManagerCToCpp, CefCookieManager,
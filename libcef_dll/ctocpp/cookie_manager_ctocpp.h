@@ -18,6 +18,7 @@
 #pragma message("Warning: "__FILE__" may be accessed wrapper-side only")
 #else  // USING_CEF_SHARED
 
+#include <vector>
 #include "include/cef_cookie.h"
 #include "include/capi/cef_cookie_capi.h"
 #include "libcef_dll/ctocpp/ctocpp.h"
@@ -37,11 +38,22 @@ class CefCookieManagerCToCpp
   virtual bool VisitAllCookies(CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
   virtual bool VisitUrlCookies(const CefString& url, bool includeHttpOnly,
       CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
+  virtual bool VisitCookiePages(const CefString& domain, const CefString& name,
+      int page_size, const CefString& cursor,
+      CefRefPtr<CefCookiePageVisitor> visitor) OVERRIDE;
   virtual bool SetCookie(const CefString& url,
       const CefCookie& cookie) OVERRIDE;
   virtual bool DeleteCookies(const CefString& url,
       const CefString& cookie_name) OVERRIDE;
+  virtual bool SetCookies(const CefString& url,
+      const std::vector<CefString>& cookie_lines) OVERRIDE;
+  virtual bool DeleteUrlCookies(const std::vector<CefString>& urls,
+      const CefString& cookie_name) OVERRIDE;
+  virtual bool ExportCookies(
+      CefRefPtr<CefCookieExportHandler> handler) OVERRIDE;
+  virtual bool ImportCookies(const CefString& data) OVERRIDE;
   virtual bool SetStoragePath(const CefString& path) OVERRIDE;
+  virtual bool GetLoadMetrics(CefCookieLoadMetrics& metrics) OVERRIDE;
 };
 
 #endif  // USING_CEF_SHARED
@@ -0,0 +1,51 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/cookie_page_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+int CefCookiePageCToCpp::GetCount() {
+  if (CEF_MEMBER_MISSING(struct_, get_count))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_count(struct_);
+
+  // Return type: simple
+  return _retval;
+}
+
+bool CefCookiePageCToCpp::GetCookie(int index, CefCookie& cookie) {
+  if (CEF_MEMBER_MISSING(struct_, get_cookie))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_cookie(struct_,
+      index,
+      &cookie);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefCookiePageCToCpp, CefCookiePage,
+    cef_cookie_page_t>::DebugObjCt = 0;
+#endif
+
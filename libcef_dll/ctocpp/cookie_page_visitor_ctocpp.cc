@@ -0,0 +1,47 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cookie_page_cpptoc.h"
+#include "libcef_dll/ctocpp/cookie_page_visitor_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefCookiePageVisitorCToCpp::Visit(CefRefPtr<CefCookiePage> page,
+    const CefString& next_cursor, int total) {
+  if (CEF_MEMBER_MISSING(struct_, visit))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: page; type: refptr_diff
+  DCHECK(page.get());
+  if (!page.get())
+    return false;
+  // Unverified params: next_cursor
+
+  // Execute
+  int _retval = struct_->visit(struct_,
+      CefCookiePageCppToC::Wrap(page),
+      next_cursor.GetStruct(),
+      total);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefCookiePageVisitorCToCpp, CefCookiePageVisitor,
+    cef_cookie_page_visitor_t>::DebugObjCt = 0;
+#endif
+
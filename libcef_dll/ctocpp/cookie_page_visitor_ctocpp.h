@@ -0,0 +1,43 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_COOKIE_PAGE_VISITOR_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_COOKIE_PAGE_VISITOR_CTOCPP_H_
+#pragma once
+
+#ifndef BUILDING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed DLL-side only")
+#else  // BUILDING_CEF_SHARED
+
+#include "include/cef_cookie.h"
+#include "include/capi/cef_cookie_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed DLL-side only.
+class CefCookiePageVisitorCToCpp
+    : public CefCToCpp<CefCookiePageVisitorCToCpp, CefCookiePageVisitor,
+        cef_cookie_page_visitor_t> {
+ public:
+  explicit CefCookiePageVisitorCToCpp(cef_cookie_page_visitor_t* str)
+      : CefCToCpp<CefCookiePageVisitorCToCpp, CefCookiePageVisitor,
+          cef_cookie_page_visitor_t>(str) {}
+  virtual ~CefCookiePageVisitorCToCpp() {}
+
+  // CefCookiePageVisitor methods
+  virtual bool Visit(CefRefPtr<CefCookiePage> page,
+      const CefString& next_cursor, int total) OVERRIDE;
+};
+
+#endif  // BUILDING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_COOKIE_PAGE_VISITOR_CTOCPP_H_
+
@@ -11,11 +11,13 @@
 //
 
 #include "libcef_dll/cpptoc/domvisitor_cpptoc.h"
+#include "libcef_dll/cpptoc/java_script_result_callback_cpptoc.h"
 #include "libcef_dll/ctocpp/browser_ctocpp.h"
 #include "libcef_dll/ctocpp/frame_ctocpp.h"
 #include "libcef_dll/ctocpp/request_ctocpp.h"
 #include "libcef_dll/ctocpp/stream_reader_ctocpp.h"
 #include "libcef_dll/ctocpp/v8context_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
 
 
 // VIRTUAL METHODS - Body may be edited by hand.
@@ -236,6 +238,55 @@ void CefFrameCToCpp::ExecuteJavaScript(const CefString& jsCode,
       startLine);
 }
 
+void CefFrameCToCpp::EvaluateJavaScript(const CefString& jsCode,
+    const CefString& scriptUrl, int startLine,
+    CefRefPtr<CefJavaScriptResultCallback> callback) {
+  if (CEF_MEMBER_MISSING(struct_, evaluate_java_script))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback.get());
+  if (!callback.get())
+    return;
+  // Unverified params: jsCode, scriptUrl
+
+  // Execute
+  struct_->evaluate_java_script(struct_,
+      jsCode.GetStruct(),
+      scriptUrl.GetStruct(),
+      startLine,
+      CefJavaScriptResultCallbackCppToC::Wrap(callback));
+}
+
+void CefFrameCToCpp::ExecuteJavaScriptBatch(
+    const std::vector<CefString>& jsCodes, const CefString& scriptUrl,
+    CefRefPtr<CefJavaScriptResultCallback> callback) {
+  if (CEF_MEMBER_MISSING(struct_, execute_java_script_batch))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: scriptUrl, callback
+
+  // Translate param: jsCodes; type: string_vec_byref_const
+  cef_string_list_t jsCodesList = cef_string_list_alloc();
+  DCHECK(jsCodesList);
+  if (jsCodesList)
+    transfer_string_list_contents(jsCodes, jsCodesList);
+
+  // Execute
+  struct_->execute_java_script_batch(struct_,
+      jsCodesList,
+      scriptUrl.GetStruct(),
+      CefJavaScriptResultCallbackCppToC::Wrap(callback));
+
+  // Restore param:jsCodes; type: string_vec_byref_const
+  if (jsCodesList)
+    cef_string_list_free(jsCodesList);
+}
+
 bool CefFrameCToCpp::IsMain() {
   if (CEF_MEMBER_MISSING(struct_, is_main))
     return false;
@@ -18,6 +18,7 @@
 #pragma message("Warning: "__FILE__" may be accessed wrapper-side only")
 #else  // USING_CEF_SHARED
 
+#include <vector>
 #include "include/cef_frame.h"
 #include "include/capi/cef_frame_capi.h"
 #include "include/cef_browser.h"
@@ -55,6 +56,12 @@ class CefFrameCToCpp
       const CefString& url) OVERRIDE;
   virtual void ExecuteJavaScript(const CefString& jsCode,
       const CefString& scriptUrl, int startLine) OVERRIDE;
+  virtual void EvaluateJavaScript(const CefString& jsCode,
+      const CefString& scriptUrl, int startLine,
+      CefRefPtr<CefJavaScriptResultCallback> callback) OVERRIDE;
+  virtual void ExecuteJavaScriptBatch(const std::vector<CefString>& jsCodes,
+      const CefString& scriptUrl,
+      CefRefPtr<CefJavaScriptResultCallback> callback) OVERRIDE;
   virtual bool IsMain() OVERRIDE;
   virtual bool IsFocused() OVERRIDE;
   virtual CefString GetName() OVERRIDE;
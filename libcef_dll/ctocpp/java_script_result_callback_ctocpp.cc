@@ -0,0 +1,47 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/list_value_cpptoc.h"
+#include "libcef_dll/ctocpp/java_script_result_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefJavaScriptResultCallbackCToCpp::OnComplete(
+    CefRefPtr<CefListValue> results, CefRefPtr<CefListValue> exceptions) {
+  if (CEF_MEMBER_MISSING(struct_, on_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: results; type: refptr_diff
+  DCHECK(results.get());
+  if (!results.get())
+    return;
+  // Verify param: exceptions; type: refptr_diff
+  DCHECK(exceptions.get());
+  if (!exceptions.get())
+    return;
+
+  // Execute
+  struct_->on_complete(struct_,
+      CefListValueCppToC::Wrap(results),
+      CefListValueCppToC::Wrap(exceptions));
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefJavaScriptResultCallbackCToCpp,
+    CefJavaScriptResultCallback,
+    cef_java_script_result_callback_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,68 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/storage_batch_visitor_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefStorageBatchVisitorCToCpp::Visit(CefStorageType type,
+    const CefString& origin, const std::vector<CefString>& keys,
+    const std::vector<CefString>& values, int count, int total) {
+  if (CEF_MEMBER_MISSING(struct_, visit))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(!origin.empty());
+  if (origin.empty())
+    return false;
+
+  // Translate param: keys; type: string_vec_byref_const
+  cef_string_list_t keysList = cef_string_list_alloc();
+  DCHECK(keysList);
+  if (keysList)
+    transfer_string_list_contents(keys, keysList);
+  // Translate param: values; type: string_vec_byref_const
+  cef_string_list_t valuesList = cef_string_list_alloc();
+  DCHECK(valuesList);
+  if (valuesList)
+    transfer_string_list_contents(values, valuesList);
+
+  // Execute
+  int _retval = struct_->visit(struct_,
+      type,
+      origin.GetStruct(),
+      keysList,
+      valuesList,
+      count,
+      total);
+
+  // Restore param:keys; type: string_vec_byref_const
+  if (keysList)
+    cef_string_list_free(keysList);
+  // Restore param:values; type: string_vec_byref_const
+  if (valuesList)
+    cef_string_list_free(valuesList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefStorageBatchVisitorCToCpp, CefStorageBatchVisitor,
+    cef_storage_batch_visitor_t>::DebugObjCt = 0;
+#endif
+
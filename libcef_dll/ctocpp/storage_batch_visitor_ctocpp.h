@@ -0,0 +1,45 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_STORAGE_BATCH_VISITOR_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_STORAGE_BATCH_VISITOR_CTOCPP_H_
+#pragma once
+
+#ifndef BUILDING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed DLL-side only")
+#else  // BUILDING_CEF_SHARED
+
+#include <vector>
+#include "include/cef_storage.h"
+#include "include/capi/cef_storage_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed DLL-side only.
+class CefStorageBatchVisitorCToCpp
+    : public CefCToCpp<CefStorageBatchVisitorCToCpp, CefStorageBatchVisitor,
+        cef_storage_batch_visitor_t> {
+ public:
+  explicit CefStorageBatchVisitorCToCpp(cef_storage_batch_visitor_t* str)
+      : CefCToCpp<CefStorageBatchVisitorCToCpp, CefStorageBatchVisitor,
+          cef_storage_batch_visitor_t>(str) {}
+  virtual ~CefStorageBatchVisitorCToCpp() {}
+
+  // CefStorageBatchVisitor methods
+  virtual bool Visit(CefStorageType type, const CefString& origin,
+      const std::vector<CefString>& keys, const std::vector<CefString>& values,
+      int count, int total) OVERRIDE;
+};
+
+#endif  // BUILDING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_STORAGE_BATCH_VISITOR_CTOCPP_H_
+
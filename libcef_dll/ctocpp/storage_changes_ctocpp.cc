@@ -0,0 +1,130 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/storage_changes_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+int CefStorageChangesCToCpp::GetCount() {
+  if (CEF_MEMBER_MISSING(struct_, get_count))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_count(struct_);
+
+  // Return type: simple
+  return _retval;
+}
+
+CefStorageChanges::CefStorageType CefStorageChangesCToCpp::GetStorageType(
+    int index) {
+  if (CEF_MEMBER_MISSING(struct_, get_storage_type))
+    return ST_LOCALSTORAGE;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_storage_type_t _retval = struct_->get_storage_type(struct_,
+      index);
+
+  // Return type: simple
+  return _retval;
+}
+
+CefStorageChanges::CefStorageChangeType CefStorageChangesCToCpp::GetChangeType(
+    int index) {
+  if (CEF_MEMBER_MISSING(struct_, get_change_type))
+    return SCT_SET;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_storage_change_type_t _retval = struct_->get_change_type(struct_,
+      index);
+
+  // Return type: simple
+  return _retval;
+}
+
+CefString CefStorageChangesCToCpp::GetOrigin(int index) {
+  if (CEF_MEMBER_MISSING(struct_, get_origin))
+    return CefString();
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_string_userfree_t _retval = struct_->get_origin(struct_,
+      index);
+
+  // Return type: string
+  CefString _retvalStr;
+  _retvalStr.AttachToUserFree(_retval);
+  return _retvalStr;
+}
+
+CefString CefStorageChangesCToCpp::GetKey(int index) {
+  if (CEF_MEMBER_MISSING(struct_, get_key))
+    return CefString();
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_string_userfree_t _retval = struct_->get_key(struct_,
+      index);
+
+  // Return type: string
+  CefString _retvalStr;
+  _retvalStr.AttachToUserFree(_retval);
+  return _retvalStr;
+}
+
+CefString CefStorageChangesCToCpp::GetOldValue(int index) {
+  if (CEF_MEMBER_MISSING(struct_, get_old_value))
+    return CefString();
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_string_userfree_t _retval = struct_->get_old_value(struct_,
+      index);
+
+  // Return type: string
+  CefString _retvalStr;
+  _retvalStr.AttachToUserFree(_retval);
+  return _retvalStr;
+}
+
+CefString CefStorageChangesCToCpp::GetNewValue(int index) {
+  if (CEF_MEMBER_MISSING(struct_, get_new_value))
+    return CefString();
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_string_userfree_t _retval = struct_->get_new_value(struct_,
+      index);
+
+  // Return type: string
+  CefString _retvalStr;
+  _retvalStr.AttachToUserFree(_retval);
+  return _retvalStr;
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefStorageChangesCToCpp, CefStorageChanges,
+    cef_storage_changes_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,48 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_STORAGE_CHANGES_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_STORAGE_CHANGES_CTOCPP_H_
+#pragma once
+
+#ifndef USING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed wrapper-side only")
+#else  // USING_CEF_SHARED
+
+#include "include/cef_storage.h"
+#include "include/capi/cef_storage_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed wrapper-side only.
+class CefStorageChangesCToCpp
+    : public CefCToCpp<CefStorageChangesCToCpp, CefStorageChanges,
+        cef_storage_changes_t> {
+ public:
+  explicit CefStorageChangesCToCpp(cef_storage_changes_t* str)
+      : CefCToCpp<CefStorageChangesCToCpp, CefStorageChanges,
+          cef_storage_changes_t>(str) {}
+  virtual ~CefStorageChangesCToCpp() {}
+
+  // CefStorageChanges methods
+  virtual int GetCount() OVERRIDE;
+  virtual CefStorageType GetStorageType(int index) OVERRIDE;
+  virtual CefStorageChangeType GetChangeType(int index) OVERRIDE;
+  virtual CefString GetOrigin(int index) OVERRIDE;
+  virtual CefString GetKey(int index) OVERRIDE;
+  virtual CefString GetOldValue(int index) OVERRIDE;
+  virtual CefString GetNewValue(int index) OVERRIDE;
+};
+
+#endif  // USING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_STORAGE_CHANGES_CTOCPP_H_
+
@@ -0,0 +1,41 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/storage_changes_cpptoc.h"
+#include "libcef_dll/ctocpp/storage_observer_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefStorageObserverCToCpp::OnStorageChanged(
+    CefRefPtr<CefStorageChanges> changes) {
+  if (CEF_MEMBER_MISSING(struct_, on_storage_changed))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: changes; type: refptr_diff
+  DCHECK(changes.get());
+  if (!changes.get())
+    return;
+
+  // Execute
+  struct_->on_storage_changed(struct_,
+      CefStorageChangesCppToC::Wrap(changes));
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefStorageObserverCToCpp, CefStorageObserver,
+    cef_storage_observer_t>::DebugObjCt = 0;
+#endif
+
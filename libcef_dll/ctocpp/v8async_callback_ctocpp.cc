@@ -0,0 +1,53 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/list_value_ctocpp.h"
+#include "libcef_dll/ctocpp/v8async_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefV8AsyncCallbackCToCpp::Success(CefRefPtr<CefListValue> results) {
+  if (CEF_MEMBER_MISSING(struct_, success))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: results
+
+  // Execute
+  struct_->success(struct_,
+      CefListValueCToCpp::Unwrap(results));
+}
+
+void CefV8AsyncCallbackCToCpp::Failure(const CefString& exception) {
+  if (CEF_MEMBER_MISSING(struct_, failure))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: exception; type: string_byref_const
+  DCHECK(!exception.empty());
+  if (exception.empty())
+    return;
+
+  // Execute
+  struct_->failure(struct_,
+      exception.GetStruct());
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefV8AsyncCallbackCToCpp, CefV8AsyncCallback,
+    cef_v8async_callback_t>::DebugObjCt = 0;
+#endif
+
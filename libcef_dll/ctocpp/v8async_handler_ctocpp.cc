@@ -0,0 +1,53 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/list_value_cpptoc.h"
+#include "libcef_dll/cpptoc/v8async_callback_cpptoc.h"
+#include "libcef_dll/ctocpp/v8async_handler_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefV8AsyncHandlerCToCpp::Execute(const CefString& name,
+    CefRefPtr<CefListValue> arguments,
+    CefRefPtr<CefV8AsyncCallback> callback) {
+  if (CEF_MEMBER_MISSING(struct_, execute))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(!name.empty());
+  if (name.empty())
+    return;
+  // Verify param: arguments; type: refptr_diff
+  DCHECK(arguments.get());
+  if (!arguments.get())
+    return;
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback.get());
+  if (!callback.get())
+    return;
+
+  // Execute
+  struct_->execute(struct_,
+      name.GetStruct(),
+      CefListValueCppToC::Wrap(arguments),
+      CefV8AsyncCallbackCppToC::Wrap(callback));
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefV8AsyncHandlerCToCpp, CefV8AsyncHandler,
+    cef_v8async_handler_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,40 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/v8byte_array_release_handler_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefV8ByteArrayReleaseHandlerCToCpp::ReleaseBuffer(void* buffer) {
+  if (CEF_MEMBER_MISSING(struct_, release_buffer))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: buffer; type: simple_byaddr
+  DCHECK(buffer);
+  if (!buffer)
+    return;
+
+  // Execute
+  struct_->release_buffer(struct_,
+      buffer);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefV8ByteArrayReleaseHandlerCToCpp,
+    CefV8ByteArrayReleaseHandler,
+    cef_v8byte_array_release_handler_t>::DebugObjCt = 0;
+#endif
+
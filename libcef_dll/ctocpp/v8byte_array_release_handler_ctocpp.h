@@ -0,0 +1,44 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_V8BYTE_ARRAY_RELEASE_HANDLER_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_V8BYTE_ARRAY_RELEASE_HANDLER_CTOCPP_H_
+#pragma once
+
+#ifndef BUILDING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed DLL-side only")
+#else  // BUILDING_CEF_SHARED
+
+#include "include/cef_v8.h"
+#include "include/capi/cef_v8_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed DLL-side only.
+class CefV8ByteArrayReleaseHandlerCToCpp
+    : public CefCToCpp<CefV8ByteArrayReleaseHandlerCToCpp,
+        CefV8ByteArrayReleaseHandler, cef_v8byte_array_release_handler_t> {
+ public:
+  explicit CefV8ByteArrayReleaseHandlerCToCpp(
+      cef_v8byte_array_release_handler_t* str)
+      : CefCToCpp<CefV8ByteArrayReleaseHandlerCToCpp,
+          CefV8ByteArrayReleaseHandler, cef_v8byte_array_release_handler_t>(
+          str) {}
+  virtual ~CefV8ByteArrayReleaseHandlerCToCpp() {}
+
+  // CefV8ByteArrayReleaseHandler methods
+  virtual void ReleaseBuffer(void* buffer) OVERRIDE;
+};
+
+#endif  // BUILDING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_V8BYTE_ARRAY_RELEASE_HANDLER_CTOCPP_H_
+
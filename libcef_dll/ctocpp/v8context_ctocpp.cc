@@ -135,6 +135,32 @@ bool CefV8ContextCToCpp::IsSame(CefRefPtr<CefV8Context> that) {
   return _retval?true:false;
 }
 
+int CefV8ContextCToCpp::GetTrackedObjectCount() {
+  if (CEF_MEMBER_MISSING(struct_, get_tracked_object_count))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_tracked_object_count(struct_);
+
+  // Return type: simple
+  return _retval;
+}
+
+int CefV8ContextCToCpp::GetExternallyAllocatedMemory() {
+  if (CEF_MEMBER_MISSING(struct_, get_externally_allocated_memory))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_externally_allocated_memory(struct_);
+
+  // Return type: simple
+  return _retval;
+}
+
 
 #ifndef NDEBUG
 template<> long CefCToCpp<CefV8ContextCToCpp, CefV8Context,
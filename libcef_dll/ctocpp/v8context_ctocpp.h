@@ -38,6 +38,8 @@ class CefV8ContextCToCpp
   virtual bool Enter() OVERRIDE;
   virtual bool Exit() OVERRIDE;
   virtual bool IsSame(CefRefPtr<CefV8Context> that) OVERRIDE;
+  virtual int GetTrackedObjectCount() OVERRIDE;
+  virtual int GetExternallyAllocatedMemory() OVERRIDE;
 };
 
 #endif  // USING_CEF_SHARED
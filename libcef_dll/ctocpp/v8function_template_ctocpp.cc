@@ -0,0 +1,91 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/v8handler_cpptoc.h"
+#include "libcef_dll/ctocpp/v8function_template_ctocpp.h"
+#include "libcef_dll/ctocpp/v8value_ctocpp.h"
+
+
+// STATIC METHODS - Body may be edited by hand.
+
+CefRefPtr<CefV8FunctionTemplate> CefV8FunctionTemplate::Create(
+    const CefString& name, CefRefPtr<CefV8Handler> handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(!name.empty());
+  if (name.empty())
+    return NULL;
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler.get());
+  if (!handler.get())
+    return NULL;
+
+  // Execute
+  cef_v8function_template_t* _retval = cef_v8function_template_create(
+      name.GetStruct(),
+      CefV8HandlerCppToC::Wrap(handler));
+
+  // Return type: refptr_same
+  return CefV8FunctionTemplateCToCpp::Wrap(_retval);
+}
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+CefString CefV8FunctionTemplateCToCpp::GetName() {
+  if (CEF_MEMBER_MISSING(struct_, get_name))
+    return CefString();
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_string_userfree_t _retval = struct_->get_name(struct_);
+
+  // Return type: string
+  CefString _retvalStr;
+  _retvalStr.AttachToUserFree(_retval);
+  return _retvalStr;
+}
+
+CefRefPtr<CefV8Handler> CefV8FunctionTemplateCToCpp::GetHandler() {
+  if (CEF_MEMBER_MISSING(struct_, get_handler))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_v8handler_t* _retval = struct_->get_handler(struct_);
+
+  // Return type: refptr_diff
+  return CefV8HandlerCppToC::Unwrap(_retval);
+}
+
+CefRefPtr<CefV8Value> CefV8FunctionTemplateCToCpp::GetFunction() {
+  if (CEF_MEMBER_MISSING(struct_, get_function))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_v8value_t* _retval = struct_->get_function(struct_);
+
+  // Return type: refptr_same
+  return CefV8ValueCToCpp::Wrap(_retval);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefV8FunctionTemplateCToCpp, CefV8FunctionTemplate,
+    cef_v8function_template_t>::DebugObjCt = 0;
+#endif
+
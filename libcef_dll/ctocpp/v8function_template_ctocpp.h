@@ -0,0 +1,44 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_V8FUNCTION_TEMPLATE_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_V8FUNCTION_TEMPLATE_CTOCPP_H_
+#pragma once
+
+#ifndef USING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed wrapper-side only")
+#else  // USING_CEF_SHARED
+
+#include "include/cef_v8.h"
+#include "include/capi/cef_v8_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed wrapper-side only.
+class CefV8FunctionTemplateCToCpp
+    : public CefCToCpp<CefV8FunctionTemplateCToCpp, CefV8FunctionTemplate,
+        cef_v8function_template_t> {
+ public:
+  explicit CefV8FunctionTemplateCToCpp(cef_v8function_template_t* str)
+      : CefCToCpp<CefV8FunctionTemplateCToCpp, CefV8FunctionTemplate,
+          cef_v8function_template_t>(str) {}
+  virtual ~CefV8FunctionTemplateCToCpp() {}
+
+  // CefV8FunctionTemplate methods
+  virtual CefString GetName() OVERRIDE;
+  virtual CefRefPtr<CefV8Handler> GetHandler() OVERRIDE;
+  virtual CefRefPtr<CefV8Value> GetFunction() OVERRIDE;
+};
+
+#endif  // USING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_V8FUNCTION_TEMPLATE_CTOCPP_H_
+
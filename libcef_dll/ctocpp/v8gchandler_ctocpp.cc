@@ -0,0 +1,37 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/v8gchandler_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefV8GCHandlerCToCpp::OnGarbageCollection(bool full, double pause_time,
+    const CefV8HeapStatistics& statistics) {
+  if (CEF_MEMBER_MISSING(struct_, on_garbage_collection))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->on_garbage_collection(struct_,
+      full,
+      pause_time,
+      &statistics);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefV8GCHandlerCToCpp, CefV8GCHandler,
+    cef_v8gchandler_t>::DebugObjCt = 0;
+#endif
+
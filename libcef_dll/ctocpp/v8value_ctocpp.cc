@@ -12,9 +12,14 @@
 
 #include "libcef_dll/cpptoc/base_cpptoc.h"
 #include "libcef_dll/cpptoc/v8accessor_cpptoc.h"
+#include "libcef_dll/cpptoc/v8async_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/v8byte_array_release_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/v8handler_cpptoc.h"
+#include "libcef_dll/ctocpp/dictionary_value_ctocpp.h"
+#include "libcef_dll/ctocpp/list_value_ctocpp.h"
 #include "libcef_dll/ctocpp/v8context_ctocpp.h"
 #include "libcef_dll/ctocpp/v8exception_ctocpp.h"
+#include "libcef_dll/ctocpp/v8property_name_ctocpp.h"
 #include "libcef_dll/ctocpp/v8value_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
 
@@ -123,6 +128,22 @@ CefRefPtr<CefV8Value> CefV8Value::CreateArray() {
   return CefV8ValueCToCpp::Wrap(_retval);
 }
 
+CefRefPtr<CefV8Value> CefV8Value::CreateByteArray(void* buffer, int length,
+    CefRefPtr<CefV8ByteArrayReleaseHandler> release_handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: buffer, release_handler
+
+  // Execute
+  cef_v8value_t* _retval = cef_v8value_create_byte_array(
+      buffer,
+      length,
+      CefV8ByteArrayReleaseHandlerCppToC::Wrap(release_handler));
+
+  // Return type: refptr_same
+  return CefV8ValueCToCpp::Wrap(_retval);
+}
+
 CefRefPtr<CefV8Value> CefV8Value::CreateFunction(const CefString& name,
     CefRefPtr<CefV8Handler> handler) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -145,6 +166,62 @@ CefRefPtr<CefV8Value> CefV8Value::CreateFunction(const CefString& name,
   return CefV8ValueCToCpp::Wrap(_retval);
 }
 
+CefRefPtr<CefV8Value> CefV8Value::CreateAsyncFunction(const CefString& name,
+    CefRefPtr<CefV8AsyncHandler> handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(!name.empty());
+  if (name.empty())
+    return NULL;
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler.get());
+  if (!handler.get())
+    return NULL;
+
+  // Execute
+  cef_v8value_t* _retval = cef_v8value_create_async_function(
+      name.GetStruct(),
+      CefV8AsyncHandlerCppToC::Wrap(handler));
+
+  // Return type: refptr_same
+  return CefV8ValueCToCpp::Wrap(_retval);
+}
+
+CefRefPtr<CefV8Value> CefV8Value::CreateFromDictionary(
+    CefRefPtr<CefDictionaryValue> value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: value; type: refptr_same
+  DCHECK(value.get());
+  if (!value.get())
+    return NULL;
+
+  // Execute
+  cef_v8value_t* _retval = cef_v8value_create_from_dictionary(
+      CefDictionaryValueCToCpp::Unwrap(value));
+
+  // Return type: refptr_same
+  return CefV8ValueCToCpp::Wrap(_retval);
+}
+
+CefRefPtr<CefV8Value> CefV8Value::CreateFromList(
+    CefRefPtr<CefListValue> value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: value; type: refptr_same
+  DCHECK(value.get());
+  if (!value.get())
+    return NULL;
+
+  // Execute
+  cef_v8value_t* _retval = cef_v8value_create_from_list(
+      CefListValueCToCpp::Unwrap(value));
+
+  // Return type: refptr_same
+  return CefV8ValueCToCpp::Wrap(_retval);
+}
+
 
 // VIRTUAL METHODS - Body may be edited by hand.
 
@@ -265,6 +342,19 @@ bool CefV8ValueCToCpp::IsArray() {
   return _retval?true:false;
 }
 
+bool CefV8ValueCToCpp::IsByteArray() {
+  if (CEF_MEMBER_MISSING(struct_, is_byte_array))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->is_byte_array(struct_);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefV8ValueCToCpp::IsFunction() {
   if (CEF_MEMBER_MISSING(struct_, is_function))
     return false;
@@ -402,6 +492,25 @@ bool CefV8ValueCToCpp::HasValue(int index) {
   return _retval?true:false;
 }
 
+bool CefV8ValueCToCpp::HasValue(CefRefPtr<CefV8PropertyName> name) {
+  if (CEF_MEMBER_MISSING(struct_, has_value_byname))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: refptr_same
+  DCHECK(name.get());
+  if (!name.get())
+    return false;
+
+  // Execute
+  int _retval = struct_->has_value_byname(struct_,
+      CefV8PropertyNameCToCpp::Unwrap(name));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefV8ValueCToCpp::DeleteValue(const CefString& key) {
   if (CEF_MEMBER_MISSING(struct_, delete_value_bykey))
     return false;
@@ -478,6 +587,26 @@ CefRefPtr<CefV8Value> CefV8ValueCToCpp::GetValue(int index) {
   return CefV8ValueCToCpp::Wrap(_retval);
 }
 
+CefRefPtr<CefV8Value> CefV8ValueCToCpp::GetValue(
+    CefRefPtr<CefV8PropertyName> name) {
+  if (CEF_MEMBER_MISSING(struct_, get_value_byname))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: refptr_same
+  DCHECK(name.get());
+  if (!name.get())
+    return NULL;
+
+  // Execute
+  cef_v8value_t* _retval = struct_->get_value_byname(struct_,
+      CefV8PropertyNameCToCpp::Unwrap(name));
+
+  // Return type: refptr_same
+  return CefV8ValueCToCpp::Wrap(_retval);
+}
+
 bool CefV8ValueCToCpp::SetValue(const CefString& key,
     CefRefPtr<CefV8Value> value, PropertyAttribute attribute) {
   if (CEF_MEMBER_MISSING(struct_, set_value_bykey))
@@ -528,6 +657,32 @@ bool CefV8ValueCToCpp::SetValue(int index, CefRefPtr<CefV8Value> value) {
   return _retval?true:false;
 }
 
+bool CefV8ValueCToCpp::SetValue(CefRefPtr<CefV8PropertyName> name,
+    CefRefPtr<CefV8Value> value, PropertyAttribute attribute) {
+  if (CEF_MEMBER_MISSING(struct_, set_value_byname))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: refptr_same
+  DCHECK(name.get());
+  if (!name.get())
+    return false;
+  // Verify param: value; type: refptr_same
+  DCHECK(value.get());
+  if (!value.get())
+    return false;
+
+  // Execute
+  int _retval = struct_->set_value_byname(struct_,
+      CefV8PropertyNameCToCpp::Unwrap(name),
+      CefV8ValueCToCpp::Unwrap(value),
+      attribute);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefV8ValueCToCpp::SetValue(const CefString& key, AccessControl settings,
     PropertyAttribute attribute) {
   if (CEF_MEMBER_MISSING(struct_, set_value_byaccessor))
@@ -617,6 +772,19 @@ int CefV8ValueCToCpp::AdjustExternallyAllocatedMemory(int change_in_bytes) {
   return _retval;
 }
 
+CefRefPtr<CefDictionaryValue> CefV8ValueCToCpp::GetDictionaryValue() {
+  if (CEF_MEMBER_MISSING(struct_, get_dictionary_value))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_dictionary_value_t* _retval = struct_->get_dictionary_value(struct_);
+
+  // Return type: refptr_same
+  return CefDictionaryValueCToCpp::Wrap(_retval);
+}
+
 int CefV8ValueCToCpp::GetArrayLength() {
   if (CEF_MEMBER_MISSING(struct_, get_array_length))
     return 0;
@@ -630,6 +798,45 @@ int CefV8ValueCToCpp::GetArrayLength() {
   return _retval;
 }
 
+CefRefPtr<CefListValue> CefV8ValueCToCpp::GetListValue() {
+  if (CEF_MEMBER_MISSING(struct_, get_list_value))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_list_value_t* _retval = struct_->get_list_value(struct_);
+
+  // Return type: refptr_same
+  return CefListValueCToCpp::Wrap(_retval);
+}
+
+void* CefV8ValueCToCpp::GetByteArrayData() {
+  if (CEF_MEMBER_MISSING(struct_, get_byte_array_data))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  void* _retval = struct_->get_byte_array_data(struct_);
+
+  // Return type: simple
+  return _retval;
+}
+
+int CefV8ValueCToCpp::GetByteArrayLength() {
+  if (CEF_MEMBER_MISSING(struct_, get_byte_array_length))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->get_byte_array_length(struct_);
+
+  // Return type: simple
+  return _retval;
+}
+
 CefString CefV8ValueCToCpp::GetFunctionName() {
   if (CEF_MEMBER_MISSING(struct_, get_function_name))
     return CefString();
@@ -42,6 +42,7 @@ class CefV8ValueCToCpp
   virtual bool IsString() OVERRIDE;
   virtual bool IsObject() OVERRIDE;
   virtual bool IsArray() OVERRIDE;
+  virtual bool IsByteArray() OVERRIDE;
   virtual bool IsFunction() OVERRIDE;
   virtual bool IsSame(CefRefPtr<CefV8Value> that) OVERRIDE;
   virtual bool GetBoolValue() OVERRIDE;
@@ -51,20 +52,29 @@ class CefV8ValueCToCpp
   virtual CefString GetStringValue() OVERRIDE;
   virtual bool HasValue(const CefString& key) OVERRIDE;
   virtual bool HasValue(int index) OVERRIDE;
+  virtual bool HasValue(CefRefPtr<CefV8PropertyName> name) OVERRIDE;
   virtual bool DeleteValue(const CefString& key) OVERRIDE;
   virtual bool DeleteValue(int index) OVERRIDE;
   virtual CefRefPtr<CefV8Value> GetValue(const CefString& key) OVERRIDE;
   virtual CefRefPtr<CefV8Value> GetValue(int index) OVERRIDE;
+  virtual CefRefPtr<CefV8Value> GetValue(
+      CefRefPtr<CefV8PropertyName> name) OVERRIDE;
   virtual bool SetValue(const CefString& key, CefRefPtr<CefV8Value> value,
       PropertyAttribute attribute) OVERRIDE;
   virtual bool SetValue(int index, CefRefPtr<CefV8Value> value) OVERRIDE;
+  virtual bool SetValue(CefRefPtr<CefV8PropertyName> name,
+      CefRefPtr<CefV8Value> value, PropertyAttribute attribute) OVERRIDE;
   virtual bool SetValue(const CefString& key, AccessControl settings,
       PropertyAttribute attribute) OVERRIDE;
   virtual bool GetKeys(std::vector<CefString>& keys) OVERRIDE;
   virtual CefRefPtr<CefBase> GetUserData() OVERRIDE;
   virtual int GetExternallyAllocatedMemory() OVERRIDE;
   virtual int AdjustExternallyAllocatedMemory(int change_in_bytes) OVERRIDE;
+  virtual CefRefPtr<CefDictionaryValue> GetDictionaryValue() OVERRIDE;
   virtual int GetArrayLength() OVERRIDE;
+  virtual CefRefPtr<CefListValue> GetListValue() OVERRIDE;
+  virtual void* GetByteArrayData() OVERRIDE;
+  virtual int GetByteArrayLength() OVERRIDE;
   virtual CefString GetFunctionName() OVERRIDE;
   virtual CefRefPtr<CefV8Handler> GetFunctionHandler() OVERRIDE;
   virtual bool ExecuteFunction(CefRefPtr<CefV8Value> object,
@@ -26,26 +26,35 @@
 #include "include/capi/cef_v8_capi.h"
 #include "libcef_dll/cpptoc/browser_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_manager_cpptoc.h"
+#include "libcef_dll/cpptoc/cookie_page_cpptoc.h"
 #include "libcef_dll/cpptoc/domdocument_cpptoc.h"
 #include "libcef_dll/cpptoc/domevent_cpptoc.h"
 #include "libcef_dll/cpptoc/domnode_cpptoc.h"
+#include "libcef_dll/cpptoc/dictionary_value_cpptoc.h"
 #include "libcef_dll/cpptoc/drag_data_cpptoc.h"
 #include "libcef_dll/cpptoc/frame_cpptoc.h"
+#include "libcef_dll/cpptoc/list_value_cpptoc.h"
 #include "libcef_dll/cpptoc/post_data_cpptoc.h"
 #include "libcef_dll/cpptoc/post_data_element_cpptoc.h"
 #include "libcef_dll/cpptoc/request_cpptoc.h"
 #include "libcef_dll/cpptoc/response_cpptoc.h"
 #include "libcef_dll/cpptoc/scheme_handler_callback_cpptoc.h"
+#include "libcef_dll/cpptoc/storage_changes_cpptoc.h"
 #include "libcef_dll/cpptoc/stream_reader_cpptoc.h"
 #include "libcef_dll/cpptoc/stream_writer_cpptoc.h"
+#include "libcef_dll/cpptoc/v8async_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/v8context_cpptoc.h"
 #include "libcef_dll/cpptoc/v8exception_cpptoc.h"
+#include "libcef_dll/cpptoc/v8function_template_cpptoc.h"
+#include "libcef_dll/cpptoc/v8property_name_cpptoc.h"
 #include "libcef_dll/cpptoc/v8value_cpptoc.h"
 #include "libcef_dll/cpptoc/web_urlrequest_cpptoc.h"
 #include "libcef_dll/cpptoc/xml_reader_cpptoc.h"
 #include "libcef_dll/cpptoc/zip_reader_cpptoc.h"
 #include "libcef_dll/ctocpp/app_ctocpp.h"
 #include "libcef_dll/ctocpp/content_filter_ctocpp.h"
+#include "libcef_dll/ctocpp/cookie_export_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/cookie_page_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/domevent_listener_ctocpp.h"
 #include "libcef_dll/ctocpp/domvisitor_ctocpp.h"
@@ -55,6 +64,7 @@
 #include "libcef_dll/ctocpp/find_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/focus_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/jsdialog_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/java_script_result_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/keyboard_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/life_span_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/load_handler_ctocpp.h"
@@ -68,13 +78,19 @@
 #include "libcef_dll/ctocpp/resource_bundle_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/scheme_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/scheme_handler_factory_ctocpp.h"
+#include "libcef_dll/ctocpp/storage_batch_visitor_ctocpp.h"
+#include "libcef_dll/ctocpp/storage_observer_ctocpp.h"
 #include "libcef_dll/ctocpp/storage_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/task_ctocpp.h"
 #include "libcef_dll/ctocpp/v8accessor_ctocpp.h"
+#include "libcef_dll/ctocpp/v8async_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/v8byte_array_release_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/v8context_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/v8gchandler_ctocpp.h"
 #include "libcef_dll/ctocpp/v8handler_ctocpp.h"
 #include "libcef_dll/ctocpp/web_urlrequest_client_ctocpp.h"
 #include "libcef_dll/ctocpp/write_handler_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
 
 
 // GLOBAL FUNCTIONS - Body may be edited by hand.
@@ -113,13 +129,17 @@ CEF_EXPORT void cef_shutdown() {
   // Check that all wrapper objects have been destroyed
   DCHECK_EQ(CefBrowserCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefContentFilterCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefCookieExportHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefCookieManagerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefCookiePageCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefCookiePageVisitorCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefCookieVisitorCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDOMDocumentCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDOMEventCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDOMEventListenerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDOMNodeCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDOMVisitorCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefDictionaryValueCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDisplayHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDownloadHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDragDataCppToC::DebugObjCt, 0);
@@ -128,8 +148,10 @@ CEF_EXPORT void cef_shutdown() {
   DCHECK_EQ(CefFocusHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefFrameCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefJSDialogHandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefJavaScriptResultCallbackCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefKeyboardHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefLifeSpanHandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefListValueCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefLoadHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefMenuHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefPermissionHandlerCToCpp::DebugObjCt, 0);
@@ -146,15 +168,24 @@ CEF_EXPORT void cef_shutdown() {
   DCHECK_EQ(CefSchemeHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeHandlerCallbackCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeHandlerFactoryCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefStorageBatchVisitorCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefStorageChangesCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefStorageObserverCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefStorageVisitorCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefStreamReaderCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefStreamWriterCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefTaskCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefV8AccessorCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefV8AsyncCallbackCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefV8AsyncHandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefV8ByteArrayReleaseHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefV8ContextCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefV8ContextHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefV8ExceptionCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefV8FunctionTemplateCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefV8GCHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefV8HandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefV8PropertyNameCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefV8ValueCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefWebURLRequestClientCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefWebURLRequestCppToC::DebugObjCt, 0);
@@ -304,6 +335,42 @@ CEF_EXPORT int cef_clear_scheme_handler_factories() {
   return _retval;
 }
 
+CEF_EXPORT int cef_set_scheme_cookies_enabled(const cef_string_t* scheme_name,
+    int enabled) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: scheme_name; type: string_byref_const
+  DCHECK(scheme_name);
+  if (!scheme_name)
+    return 0;
+
+  // Execute
+  bool _retval = CefSetSchemeCookiesEnabled(
+      CefString(scheme_name),
+      enabled?true:false);
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int cef_set_scheme_cache_enabled(const cef_string_t* scheme_name,
+    int enabled) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: scheme_name; type: string_byref_const
+  DCHECK(scheme_name);
+  if (!scheme_name)
+    return 0;
+
+  // Execute
+  bool _retval = CefSetSchemeCacheEnabled(
+      CefString(scheme_name),
+      enabled?true:false);
+
+  // Return type: bool
+  return _retval;
+}
+
 CEF_EXPORT int cef_visit_storage(enum cef_storage_type_t type,
     const cef_string_t* origin, const cef_string_t* key,
     struct _cef_storage_visitor_t* visitor) {
@@ -326,6 +393,28 @@ CEF_EXPORT int cef_visit_storage(enum cef_storage_type_t type,
   return _retval;
 }
 
+CEF_EXPORT int cef_visit_storage_batches(enum cef_storage_type_t type,
+    const cef_string_t* origin, int batch_size,
+    struct _cef_storage_batch_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return 0;
+  // Unverified params: origin
+
+  // Execute
+  bool _retval = CefVisitStorageBatches(
+      type,
+      CefString(origin),
+      batch_size,
+      CefStorageBatchVisitorCToCpp::Wrap(visitor));
+
+  // Return type: bool
+  return _retval;
+}
+
 CEF_EXPORT int cef_set_storage(enum cef_storage_type_t type,
     const cef_string_t* origin, const cef_string_t* key,
     const cef_string_t* value) {
@@ -371,6 +460,102 @@ CEF_EXPORT int cef_delete_storage(enum cef_storage_type_t type,
   return _retval;
 }
 
+CEF_EXPORT int cef_set_storage_items(enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys,
+    cef_string_list_t values) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(origin);
+  if (!origin)
+    return 0;
+  // Verify param: keys; type: string_vec_byref_const
+  DCHECK(keys);
+  if (!keys)
+    return 0;
+  // Verify param: values; type: string_vec_byref_const
+  DCHECK(values);
+  if (!values)
+    return 0;
+
+  // Translate param: keys; type: string_vec_byref_const
+  std::vector<CefString> keysList;
+  transfer_string_list_contents(keys, keysList);
+  // Translate param: values; type: string_vec_byref_const
+  std::vector<CefString> valuesList;
+  transfer_string_list_contents(values, valuesList);
+
+  // Execute
+  bool _retval = CefSetStorageItems(
+      type,
+      CefString(origin),
+      keysList,
+      valuesList);
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int cef_get_storage_items(enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys,
+    struct _cef_storage_batch_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(origin);
+  if (!origin)
+    return 0;
+  // Verify param: keys; type: string_vec_byref_const
+  DCHECK(keys);
+  if (!keys)
+    return 0;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return 0;
+
+  // Translate param: keys; type: string_vec_byref_const
+  std::vector<CefString> keysList;
+  transfer_string_list_contents(keys, keysList);
+
+  // Execute
+  bool _retval = CefGetStorageItems(
+      type,
+      CefString(origin),
+      keysList,
+      CefStorageBatchVisitorCToCpp::Wrap(visitor));
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int cef_delete_storage_items(enum cef_storage_type_t type,
+    const cef_string_t* origin, cef_string_list_t keys) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(origin);
+  if (!origin)
+    return 0;
+  // Verify param: keys; type: string_vec_byref_const
+  DCHECK(keys);
+  if (!keys)
+    return 0;
+
+  // Translate param: keys; type: string_vec_byref_const
+  std::vector<CefString> keysList;
+  transfer_string_list_contents(keys, keysList);
+
+  // Execute
+  bool _retval = CefDeleteStorageItems(
+      type,
+      CefString(origin),
+      keysList);
+
+  // Return type: bool
+  return _retval;
+}
+
 CEF_EXPORT int cef_set_storage_path(enum cef_storage_type_t type,
     const cef_string_t* path) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -386,6 +571,60 @@ CEF_EXPORT int cef_set_storage_path(enum cef_storage_type_t type,
   return _retval;
 }
 
+CEF_EXPORT int cef_add_storage_observer(
+    struct _cef_storage_observer_t* observer) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: observer; type: refptr_diff
+  DCHECK(observer);
+  if (!observer)
+    return 0;
+
+  // Execute
+  int _retval = CefAddStorageObserver(
+      CefStorageObserverCToCpp::Wrap(observer));
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_EXPORT int cef_remove_storage_observer(int observer_id) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  bool _retval = CefRemoveStorageObserver(
+      observer_id);
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int64 cef_get_storage_memory_usage(enum cef_storage_type_t type) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int64 _retval = CefGetStorageMemoryUsage(
+      type);
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_EXPORT int cef_flush_storage(enum cef_storage_type_t type,
+    struct _cef_task_t* task) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: task
+
+  // Execute
+  bool _retval = CefFlushStorage(
+      type,
+      CefTaskCToCpp::Wrap(task));
+
+  // Return type: bool
+  return _retval;
+}
+
 CEF_EXPORT int cef_currently_on(cef_thread_id_t threadId) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -518,3 +757,97 @@ CEF_EXPORT int cef_register_extension(const cef_string_t* extension_name,
   return _retval;
 }
 
+CEF_EXPORT int cef_get_v8heap_statistics(cef_v8heap_statistics_t* statistics) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: statistics; type: simple_byref
+  DCHECK(statistics);
+  if (!statistics)
+    return 0;
+
+  // Translate param: statistics; type: simple_byref
+  CefV8HeapStatistics statisticsVal =
+      statistics?*statistics:CefV8HeapStatistics();
+
+  // Execute
+  bool _retval = CefGetV8HeapStatistics(
+      statisticsVal);
+
+  // Restore param: statistics; type: simple_byref
+  if (statistics)
+    *statistics = statisticsVal;
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int cef_add_v8gchandler(struct _cef_v8gchandler_t* handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler);
+  if (!handler)
+    return 0;
+
+  // Execute
+  int _retval = CefAddV8GCHandler(
+      CefV8GCHandlerCToCpp::Wrap(handler));
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_EXPORT int cef_remove_v8gchandler(int handler_id) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  bool _retval = CefRemoveV8GCHandler(
+      handler_id);
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int cef_v8idle_notification(int hint) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  bool _retval = CefV8IdleNotification(
+      hint);
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT void cef_v8low_memory_notification() {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  CefV8LowMemoryNotification();
+}
+
+CEF_EXPORT int cef_get_v8script_cache_statistics(
+    cef_v8script_cache_statistics_t* statistics) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: statistics; type: simple_byref
+  DCHECK(statistics);
+  if (!statistics)
+    return 0;
+
+  // Translate param: statistics; type: simple_byref
+  CefV8ScriptCacheStatistics statisticsVal =
+      statistics?*statistics:CefV8ScriptCacheStatistics();
+
+  // Execute
+  bool _retval = CefGetV8ScriptCacheStatistics(
+      statisticsVal);
+
+  // Restore param: statistics; type: simple_byref
+  if (statistics)
+    *statistics = statisticsVal;
+
+  // Return type: bool
+  return _retval;
+}
+
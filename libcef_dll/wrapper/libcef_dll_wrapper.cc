@@ -27,6 +27,8 @@
 #include "include/cef_version.h"
 #include "libcef_dll/cpptoc/app_cpptoc.h"
 #include "libcef_dll/cpptoc/content_filter_cpptoc.h"
+#include "libcef_dll/cpptoc/cookie_export_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/cookie_page_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/domevent_listener_cpptoc.h"
 #include "libcef_dll/cpptoc/domvisitor_cpptoc.h"
@@ -36,6 +38,7 @@
 #include "libcef_dll/cpptoc/find_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/focus_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/jsdialog_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/java_script_result_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/keyboard_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/life_span_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/load_handler_cpptoc.h"
@@ -49,33 +52,46 @@
 #include "libcef_dll/cpptoc/resource_bundle_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/scheme_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/scheme_handler_factory_cpptoc.h"
+#include "libcef_dll/cpptoc/storage_batch_visitor_cpptoc.h"
+#include "libcef_dll/cpptoc/storage_observer_cpptoc.h"
 #include "libcef_dll/cpptoc/storage_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/task_cpptoc.h"
 #include "libcef_dll/cpptoc/v8accessor_cpptoc.h"
+#include "libcef_dll/cpptoc/v8async_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/v8byte_array_release_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/v8context_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/v8gchandler_cpptoc.h"
 #include "libcef_dll/cpptoc/v8handler_cpptoc.h"
 #include "libcef_dll/cpptoc/web_urlrequest_client_cpptoc.h"
 #include "libcef_dll/cpptoc/write_handler_cpptoc.h"
 #include "libcef_dll/ctocpp/browser_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_manager_ctocpp.h"
+#include "libcef_dll/ctocpp/cookie_page_ctocpp.h"
 #include "libcef_dll/ctocpp/domdocument_ctocpp.h"
 #include "libcef_dll/ctocpp/domevent_ctocpp.h"
 #include "libcef_dll/ctocpp/domnode_ctocpp.h"
+#include "libcef_dll/ctocpp/dictionary_value_ctocpp.h"
 #include "libcef_dll/ctocpp/drag_data_ctocpp.h"
 #include "libcef_dll/ctocpp/frame_ctocpp.h"
+#include "libcef_dll/ctocpp/list_value_ctocpp.h"
 #include "libcef_dll/ctocpp/post_data_ctocpp.h"
 #include "libcef_dll/ctocpp/post_data_element_ctocpp.h"
 #include "libcef_dll/ctocpp/request_ctocpp.h"
 #include "libcef_dll/ctocpp/response_ctocpp.h"
 #include "libcef_dll/ctocpp/scheme_handler_callback_ctocpp.h"
+#include "libcef_dll/ctocpp/storage_changes_ctocpp.h"
 #include "libcef_dll/ctocpp/stream_reader_ctocpp.h"
 #include "libcef_dll/ctocpp/stream_writer_ctocpp.h"
+#include "libcef_dll/ctocpp/v8async_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/v8context_ctocpp.h"
 #include "libcef_dll/ctocpp/v8exception_ctocpp.h"
+#include "libcef_dll/ctocpp/v8function_template_ctocpp.h"
+#include "libcef_dll/ctocpp/v8property_name_ctocpp.h"
 #include "libcef_dll/ctocpp/v8value_ctocpp.h"
 #include "libcef_dll/ctocpp/web_urlrequest_ctocpp.h"
 #include "libcef_dll/ctocpp/xml_reader_ctocpp.h"
 #include "libcef_dll/ctocpp/zip_reader_ctocpp.h"
+#include "libcef_dll/transfer_util.h"
 
 // Define used to facilitate parsing.
 #define CEF_GLOBAL
@@ -115,13 +131,17 @@ CEF_GLOBAL void CefShutdown() {
   // Check that all wrapper objects have been destroyed
   DCHECK_EQ(CefBrowserCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefContentFilterCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefCookieExportHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefCookieManagerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefCookiePageCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefCookiePageVisitorCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefCookieVisitorCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDOMDocumentCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDOMEventCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDOMEventListenerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDOMNodeCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDOMVisitorCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefDictionaryValueCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDisplayHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDownloadHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDragDataCToCpp::DebugObjCt, 0);
@@ -130,8 +150,10 @@ CEF_GLOBAL void CefShutdown() {
   DCHECK_EQ(CefFocusHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefFrameCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefJSDialogHandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefJavaScriptResultCallbackCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefKeyboardHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefLifeSpanHandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefListValueCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefLoadHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefMenuHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefPermissionHandlerCppToC::DebugObjCt, 0);
@@ -148,15 +170,24 @@ CEF_GLOBAL void CefShutdown() {
   DCHECK_EQ(CefSchemeHandlerCallbackCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeHandlerFactoryCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefStorageBatchVisitorCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefStorageChangesCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefStorageObserverCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefStorageVisitorCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefStreamReaderCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefStreamWriterCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefTaskCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefV8AccessorCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefV8AsyncCallbackCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefV8AsyncHandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefV8ByteArrayReleaseHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefV8ContextCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefV8ContextHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefV8ExceptionCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefV8FunctionTemplateCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefV8GCHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefV8HandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefV8PropertyNameCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefV8ValueCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefWebURLRequestCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefWebURLRequestClientCppToC::DebugObjCt, 0);
@@ -306,6 +337,42 @@ CEF_GLOBAL bool CefClearSchemeHandlerFactories() {
   return _retval?true:false;
 }
 
+CEF_GLOBAL bool CefSetSchemeCookiesEnabled(const CefString& scheme_name,
+    bool enabled) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: scheme_name; type: string_byref_const
+  DCHECK(!scheme_name.empty());
+  if (scheme_name.empty())
+    return false;
+
+  // Execute
+  int _retval = cef_set_scheme_cookies_enabled(
+      scheme_name.GetStruct(),
+      enabled);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL bool CefSetSchemeCacheEnabled(const CefString& scheme_name,
+    bool enabled) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: scheme_name; type: string_byref_const
+  DCHECK(!scheme_name.empty());
+  if (scheme_name.empty())
+    return false;
+
+  // Execute
+  int _retval = cef_set_scheme_cache_enabled(
+      scheme_name.GetStruct(),
+      enabled);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 CEF_GLOBAL bool CefVisitStorage(CefStorageType type, const CefString& origin,
     const CefString& key, CefRefPtr<CefStorageVisitor> visitor) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -327,6 +394,28 @@ CEF_GLOBAL bool CefVisitStorage(CefStorageType type, const CefString& origin,
   return _retval?true:false;
 }
 
+CEF_GLOBAL bool CefVisitStorageBatches(CefStorageType type,
+    const CefString& origin, int batch_size,
+    CefRefPtr<CefStorageBatchVisitor> visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return false;
+  // Unverified params: origin
+
+  // Execute
+  int _retval = cef_visit_storage_batches(
+      type,
+      origin.GetStruct(),
+      batch_size,
+      CefStorageBatchVisitorCppToC::Wrap(visitor));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 CEF_GLOBAL bool CefSetStorage(CefStorageType type, const CefString& origin,
     const CefString& key, const CefString& value) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -371,6 +460,109 @@ CEF_GLOBAL bool CefDeleteStorage(CefStorageType type, const CefString& origin,
   return _retval?true:false;
 }
 
+CEF_GLOBAL bool CefSetStorageItems(CefStorageType type, const CefString& origin,
+    const std::vector<CefString>& keys,
+    const std::vector<CefString>& values) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(!origin.empty());
+  if (origin.empty())
+    return false;
+
+  // Translate param: keys; type: string_vec_byref_const
+  cef_string_list_t keysList = cef_string_list_alloc();
+  DCHECK(keysList);
+  if (keysList)
+    transfer_string_list_contents(keys, keysList);
+  // Translate param: values; type: string_vec_byref_const
+  cef_string_list_t valuesList = cef_string_list_alloc();
+  DCHECK(valuesList);
+  if (valuesList)
+    transfer_string_list_contents(values, valuesList);
+
+  // Execute
+  int _retval = cef_set_storage_items(
+      type,
+      origin.GetStruct(),
+      keysList,
+      valuesList);
+
+  // Restore param:keys; type: string_vec_byref_const
+  if (keysList)
+    cef_string_list_free(keysList);
+  // Restore param:values; type: string_vec_byref_const
+  if (valuesList)
+    cef_string_list_free(valuesList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL bool CefGetStorageItems(CefStorageType type, const CefString& origin,
+    const std::vector<CefString>& keys,
+    CefRefPtr<CefStorageBatchVisitor> visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(!origin.empty());
+  if (origin.empty())
+    return false;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return false;
+
+  // Translate param: keys; type: string_vec_byref_const
+  cef_string_list_t keysList = cef_string_list_alloc();
+  DCHECK(keysList);
+  if (keysList)
+    transfer_string_list_contents(keys, keysList);
+
+  // Execute
+  int _retval = cef_get_storage_items(
+      type,
+      origin.GetStruct(),
+      keysList,
+      CefStorageBatchVisitorCppToC::Wrap(visitor));
+
+  // Restore param:keys; type: string_vec_byref_const
+  if (keysList)
+    cef_string_list_free(keysList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL bool CefDeleteStorageItems(CefStorageType type,
+    const CefString& origin, const std::vector<CefString>& keys) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: origin; type: string_byref_const
+  DCHECK(!origin.empty());
+  if (origin.empty())
+    return false;
+
+  // Translate param: keys; type: string_vec_byref_const
+  cef_string_list_t keysList = cef_string_list_alloc();
+  DCHECK(keysList);
+  if (keysList)
+    transfer_string_list_contents(keys, keysList);
+
+  // Execute
+  int _retval = cef_delete_storage_items(
+      type,
+      origin.GetStruct(),
+      keysList);
+
+  // Restore param:keys; type: string_vec_byref_const
+  if (keysList)
+    cef_string_list_free(keysList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 CEF_GLOBAL bool CefSetStoragePath(CefStorageType type, const CefString& path) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -385,6 +577,58 @@ CEF_GLOBAL bool CefSetStoragePath(CefStorageType type, const CefString& path) {
   return _retval?true:false;
 }
 
+CEF_GLOBAL int CefAddStorageObserver(CefRefPtr<CefStorageObserver> observer) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: observer; type: refptr_diff
+  DCHECK(observer.get());
+  if (!observer.get())
+    return 0;
+
+  // Execute
+  int _retval = cef_add_storage_observer(
+      CefStorageObserverCppToC::Wrap(observer));
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_GLOBAL bool CefRemoveStorageObserver(int observer_id) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_remove_storage_observer(
+      observer_id);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL int64 CefGetStorageMemoryUsage(CefStorageType type) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int64 _retval = cef_get_storage_memory_usage(
+      type);
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_GLOBAL bool CefFlushStorage(CefStorageType type, CefRefPtr<CefTask> task) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: task
+
+  // Execute
+  int _retval = cef_flush_storage(
+      type,
+      CefTaskCppToC::Wrap(task));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 CEF_GLOBAL bool CefCurrentlyOn(CefThreadId threadId) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -485,3 +729,71 @@ CEF_GLOBAL bool CefRegisterExtension(const CefString& extension_name,
   return _retval?true:false;
 }
 
+CEF_GLOBAL bool CefGetV8HeapStatistics(CefV8HeapStatistics& statistics) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_get_v8heap_statistics(
+      &statistics);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL int CefAddV8GCHandler(CefRefPtr<CefV8GCHandler> handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: handler; type: refptr_diff
+  DCHECK(handler.get());
+  if (!handler.get())
+    return 0;
+
+  // Execute
+  int _retval = cef_add_v8gchandler(
+      CefV8GCHandlerCppToC::Wrap(handler));
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_GLOBAL bool CefRemoveV8GCHandler(int handler_id) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_remove_v8gchandler(
+      handler_id);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL bool CefV8IdleNotification(int hint) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_v8idle_notification(
+      hint);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL void CefV8LowMemoryNotification() {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_v8low_memory_notification();
+}
+
+CEF_GLOBAL bool CefGetV8ScriptCacheStatistics(
+    CefV8ScriptCacheStatistics& statistics) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_get_v8script_cache_statistics(
+      &statistics);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
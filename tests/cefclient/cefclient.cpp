@@ -205,6 +205,12 @@ void AppGetSettings(CefSettings& settings, CefRefPtr<CefApp>& app) {
       g_command_line->GetSwitchValue(cefclient::kLocalStorageQuota));
   settings.session_storage_quota = GetIntValue(
       g_command_line->GetSwitchValue(cefclient::kSessionStorageQuota));
+  settings.consolidated_local_storage =
+      g_command_line->HasSwitch(cefclient::kConsolidatedLocalStorage);
+  settings.local_storage_memory_limit = GetIntValue(
+      g_command_line->GetSwitchValue(cefclient::kLocalStorageMemoryLimit));
+  settings.cookie_commit_batch_size = GetIntValue(
+      g_command_line->GetSwitchValue(cefclient::kCookieCommitBatchSize));
 
   CefString(&settings.javascript_flags) =
       g_command_line->GetSwitchValue(cefclient::kJavascriptFlags);
@@ -29,6 +29,9 @@ const char kGraphicsImpl_Desktop[] = "desktop";
 const char kGraphicsImpl_DesktopCmdBuffer[] = "desktop-command-buffer";
 const char kLocalStorageQuota[] = "local-storage-quota";
 const char kSessionStorageQuota[] = "session-storage-quota";
+const char kConsolidatedLocalStorage[] = "consolidated-local-storage";
+const char kLocalStorageMemoryLimit[] = "local-storage-memory-limit";
+const char kCookieCommitBatchSize[] = "cookie-commit-batch-size";
 const char kJavascriptFlags[] = "javascript-flags";
 const char kPackFilePath[] = "pack-file-path";
 const char kLocalesDirPath[] = "locales-dir-path";
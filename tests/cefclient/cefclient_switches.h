@@ -31,6 +31,9 @@ extern const char kGraphicsImpl_Desktop[];
 extern const char kGraphicsImpl_DesktopCmdBuffer[];
 extern const char kLocalStorageQuota[];
 extern const char kSessionStorageQuota[];
+extern const char kConsolidatedLocalStorage[];
+extern const char kLocalStorageMemoryLimit[];
+extern const char kCookieCommitBatchSize[];
 extern const char kJavascriptFlags[];
 extern const char kPackFilePath[];
 extern const char kLocalesDirPath[];
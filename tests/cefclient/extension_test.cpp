@@ -4,12 +4,24 @@
 
 #include "cefclient/extension_test.h"
 #include <string>
+#include <vector>
 #include "include/cef_browser.h"
 #include "include/cef_frame.h"
 #include "include/cef_stream.h"
 #include "include/cef_v8.h"
 #include "cefclient/resource_util.h"
 
+namespace {
+
+// Property names assigned by the SetProperties performance tests.
+const char* kPerfPropertyNames[] = {
+  "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel"
+};
+const int kPerfPropertyCount =
+    sizeof(kPerfPropertyNames) / sizeof(kPerfPropertyNames[0]);
+
+}  // namespace
+
 // Implementation of the V8 handler class for the "cef.test" extension.
 class ClientV8ExtensionHandler : public CefV8Handler {
  public:
@@ -26,6 +38,32 @@ class ClientV8ExtensionHandler : public CefV8Handler {
     if (name == "Dummy") {
       // Used for performance testing.
       return true;
+    } else if (name == "SetProperties" || name == "SetPropertiesInterned") {
+      // Used for performance testing of property access by name.
+      if (arguments.size() != 1 || !arguments[0]->IsObject())
+        return false;
+
+      CefRefPtr<CefV8Value> object = arguments[0];
+      CefRefPtr<CefV8Value> value = CefV8Value::CreateInt(1);
+      if (name == "SetProperties") {
+        for (int i = 0; i < kPerfPropertyCount; ++i) {
+          object->SetValue(kPerfPropertyNames[i], value,
+                           V8_PROPERTY_ATTRIBUTE_NONE);
+        }
+      } else {
+        // Create the property names once and reuse them for every call.
+        if (perf_property_names_.empty()) {
+          for (int i = 0; i < kPerfPropertyCount; ++i) {
+            perf_property_names_.push_back(
+                CefV8PropertyName::Create(kPerfPropertyNames[i]));
+          }
+        }
+        for (int i = 0; i < kPerfPropertyCount; ++i) {
+          object->SetValue(perf_property_names_[i], value,
+                           V8_PROPERTY_ATTRIBUTE_NONE);
+        }
+      }
+      return true;
     } else if (name == "SetTestParam") {
       // Handle the SetTestParam native function by saving the string argument
       // into the local member.
@@ -63,6 +101,7 @@ class ClientV8ExtensionHandler : public CefV8Handler {
 
  private:
   CefString test_param_;
+  std::vector<CefRefPtr<CefV8PropertyName> > perf_property_names_;
 
   IMPLEMENT_REFCOUNTING(ClientV8ExtensionHandler);
 };
@@ -93,6 +132,14 @@ void InitExtensionTest() {
     "    native function Dummy();"
     "    return Dummy();"
     "  };"
+    "  cef.test.setProperties = function(obj) {"
+    "    native function SetProperties();"
+    "    return SetProperties(obj);"
+    "  };"
+    "  cef.test.setPropertiesInterned = function(obj) {"
+    "    native function SetPropertiesInterned();"
+    "    return SetPropertiesInterned(obj);"
+    "  };"
     "})();";
   CefRegisterExtension("v8/test", code, new ClientV8ExtensionHandler());
 }
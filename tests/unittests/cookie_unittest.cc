@@ -2,14 +2,19 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include <stdio.h>
+#include <string>
 #include <vector>
 #include "include/cef_cookie.h"
 #include "include/cef_runnable.h"
 #include "include/cef_scheme.h"
 #include "tests/unittests/test_handler.h"
 #include "tests/unittests/test_suite.h"
+#include "base/file_util.h"
 #include "base/scoped_temp_dir.h"
+#include "base/stringprintf.h"
 #include "base/synchronization/waitable_event.h"
+#include "base/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace {
@@ -36,6 +41,14 @@ void IOT_Delete(CefRefPtr<CefCookieManager> manager,
   event->Signal();
 }
 
+void IOT_GetLoadMetrics(CefRefPtr<CefCookieManager> manager,
+                        bool expected_result,
+                        CefCookieLoadMetrics* metrics,
+                        base::WaitableEvent* event) {
+  EXPECT_EQ(expected_result, manager->GetLoadMetrics(*metrics));
+  event->Signal();
+}
+
 class TestVisitor : public CefCookieVisitor {
  public:
   TestVisitor(CookieVector* cookies, bool deleteCookies,
@@ -431,6 +444,97 @@ void TestChangeDirectory(CefRefPtr<CefCookieManager> manager,
   WaitForIOThread();
 }
 
+class TestExportHandler : public CefCookieExportHandler {
+ public:
+  TestExportHandler(std::string* data, int* count, base::WaitableEvent* event)
+    : data_(data),
+      count_(count),
+      event_(event) {
+  }
+
+  virtual void OnCookiesExported(const CefString& data, int count) OVERRIDE {
+    *data_ = data;
+    *count_ = count;
+    event_->Signal();
+  }
+
+ private:
+  std::string* data_;
+  int* count_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestExportHandler);
+};
+
+class TestPageVisitor : public CefCookiePageVisitor {
+ public:
+  TestPageVisitor(CookieVector* cookies, std::vector<int>* page_sizes,
+                  CefString* next_cursor, int max_pages,
+                  base::WaitableEvent* event)
+    : cookies_(cookies),
+      page_sizes_(page_sizes),
+      next_cursor_(next_cursor),
+      max_pages_(max_pages),
+      event_(event) {
+  }
+  virtual ~TestPageVisitor() {
+    event_->Signal();
+  }
+
+  virtual bool Visit(CefRefPtr<CefCookiePage> page,
+                     const CefString& next_cursor,
+                     int total) OVERRIDE {
+    int count = page->GetCount();
+    for (int i = 0; i < count; ++i) {
+      CefCookie cookie;
+      EXPECT_TRUE(page->GetCookie(i, cookie));
+      cookies_->push_back(cookie);
+    }
+    CefCookie cookie;
+    EXPECT_FALSE(page->GetCookie(count, cookie));
+
+    page_sizes_->push_back(count);
+    *next_cursor_ = next_cursor;
+    return (static_cast<int>(page_sizes_->size()) < max_pages_);
+  }
+
+ private:
+  CookieVector* cookies_;
+  std::vector<int>* page_sizes_;
+  CefString* next_cursor_;
+  int max_pages_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestPageVisitor);
+};
+
+// Visit pages of cookies. Visiting stops after |max_pages| pages.
+void VisitCookiePages(CefRefPtr<CefCookieManager> manager,
+                      const CefString& domain,
+                      const CefString& name,
+                      int page_size,
+                      const CefString& cursor,
+                      int max_pages,
+                      CookieVector& cookies,
+                      std::vector<int>& page_sizes,
+                      CefString& next_cursor,
+                      base::WaitableEvent& event) {
+  EXPECT_TRUE(manager->VisitCookiePages(domain, name, page_size, cursor,
+      new TestPageVisitor(&cookies, &page_sizes, &next_cursor, max_pages,
+                          &event)));
+  event.Wait();
+}
+
+// Export all cookies.
+void ExportCookies(CefRefPtr<CefCookieManager> manager,
+                   std::string& data,
+                   int& count,
+                   base::WaitableEvent& event) {
+  EXPECT_TRUE(manager->ExportCookies(
+      new TestExportHandler(&data, &count, &event)));
+  event.Wait();
+}
+
 }  // namespace
 
 // Test creation of a domain cookie.
@@ -572,6 +676,390 @@ TEST(CookieTest, ChangeDirectoryCreated) {
   TestChangeDirectory(manager, CefString());
 }
 
+// Test partitioned cookie managers that share a database.
+TEST(CookieTest, PartitionedManagersOnDisk) {
+  base::WaitableEvent event(false, false);
+  CefCookie cookie;
+  ScopedTempDir temp_dir;
+
+  // Create a new temporary directory.
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  CefRefPtr<CefCookieManager> manager1 =
+      CefCookieManager::CreatePartitionedManager(temp_dir.path().value(),
+                                                 "partition1");
+  EXPECT_TRUE(manager1.get());
+  CefRefPtr<CefCookieManager> manager2 =
+      CefCookieManager::CreatePartitionedManager(temp_dir.path().value(),
+                                                 "partition2");
+  EXPECT_TRUE(manager2.get());
+
+  // Create a domain cookie in the first partition only.
+  CreateCookie(manager1, cookie, true, event);
+  GetCookie(manager1, cookie, true, event, false);
+  VerifyNoCookies(manager2, event, true);
+
+  // Create a domain cookie in the second partition.
+  CreateCookie(manager2, cookie, true, event);
+
+  // Deleting from the first partition does not affect the second.
+  DeleteAllCookies(manager1, event);
+  VerifyNoCookies(manager1, event, true);
+  GetCookie(manager2, cookie, true, event, false);
+
+  // Reload the second partition from the shared database.
+  EXPECT_TRUE(manager2->SetStoragePath(CefString()));
+  WaitForIOThread();
+  VerifyNoCookies(manager2, event, true);
+  EXPECT_TRUE(manager2->SetStoragePath(temp_dir.path().value()));
+  WaitForIOThread();
+  GetCookie(manager2, cookie, true, event, false);
+
+  // Reload the first partition from the shared database.
+  EXPECT_TRUE(manager1->SetStoragePath(CefString()));
+  WaitForIOThread();
+  EXPECT_TRUE(manager1->SetStoragePath(temp_dir.path().value()));
+  WaitForIOThread();
+  VerifyNoCookies(manager1, event, true);
+}
+
+// Test load metrics for a manager that reloads cookies from disk.
+TEST(CookieTest, LoadMetricsOnDisk) {
+  base::WaitableEvent event(false, false);
+  CefCookie cookie;
+  CefCookieLoadMetrics metrics;
+  CookieVector cookies;
+  ScopedTempDir temp_dir;
+
+  // Create a new temporary directory.
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager.get());
+
+  // In-memory managers have no load metrics.
+  CefPostTask(TID_IO, NewCefRunnableFunction(IOT_GetLoadMetrics, manager,
+                                             false, &metrics, &event));
+  event.Wait();
+
+  // Write a cookie to disk and then reload it.
+  EXPECT_TRUE(manager->SetStoragePath(temp_dir.path().value()));
+  WaitForIOThread();
+  CreateCookie(manager, cookie, true, event);
+  EXPECT_TRUE(manager->SetStoragePath(CefString()));
+  WaitForIOThread();
+  EXPECT_TRUE(manager->SetStoragePath(temp_dir.path().value()));
+  WaitForIOThread();
+
+  // Visiting all cookies waits for the load to complete.
+  VisitAllCookies(manager, cookies, false, event);
+  EXPECT_EQ((CookieVector::size_type)1, cookies.size());
+
+  CefPostTask(TID_IO, NewCefRunnableFunction(IOT_GetLoadMetrics, manager,
+                                             true, &metrics, &event));
+  event.Wait();
+
+  EXPECT_TRUE(metrics.load_complete);
+  EXPECT_EQ(1, metrics.cookie_count);
+  EXPECT_EQ(1, metrics.priority_key_count + metrics.background_key_count);
+  EXPECT_LE(0, metrics.database_open_time);
+  EXPECT_LE(0, metrics.total_load_time);
+}
+
+// Test that a full batch of cookie changes is committed to the database
+// immediately and that pending changes are flushed when the store is closed.
+// Run with --cookie-commit-batch-size=1 to test that every change is committed
+// immediately.
+TEST(CookieTest, CommitBatchOnDisk) {
+  CefSettings settings;
+  CefTestSuite::GetSettings(settings);
+  // 512 is the default value of CefSettings.cookie_commit_batch_size.
+  const int kBatchSize = settings.cookie_commit_batch_size > 0 ?
+      static_cast<int>(settings.cookie_commit_batch_size) : 512;
+
+  base::WaitableEvent event(false, false);
+  CookieVector cookies;
+  ScopedTempDir temp_dir;
+  ScopedTempDir copy_dir;
+
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(copy_dir.CreateUniqueTempDir());
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(temp_dir.path().value());
+  EXPECT_TRUE(manager.get());
+
+  // Persistent cookies on separate hosts so that none are evicted.
+  std::vector<CefString> cookie_lines;
+  cookie_lines.push_back("batch_cookie=value; max-age=3600");
+  for (int i = 0; i < kBatchSize; ++i) {
+    EXPECT_TRUE(manager->SetCookies(
+        base::StringPrintf("http://batch%d.test.com/", i), cookie_lines));
+  }
+
+  // Visiting all cookies runs after the queued changes have been applied.
+  VisitAllCookies(manager, cookies, false, event);
+  EXPECT_EQ((CookieVector::size_type)kBatchSize, cookies.size());
+
+  // The batch commit does not wait for the commit interval.
+  WaitForThread(TID_FILE);
+  EXPECT_TRUE(file_util::CopyFile(temp_dir.path().AppendASCII("Cookies"),
+                                  copy_dir.path().AppendASCII("Cookies")));
+
+  CefRefPtr<CefCookieManager> copy_manager =
+      CefCookieManager::CreateManager(copy_dir.path().value());
+  EXPECT_TRUE(copy_manager.get());
+  cookies.clear();
+  VisitAllCookies(copy_manager, cookies, false, event);
+  EXPECT_EQ((CookieVector::size_type)kBatchSize, cookies.size());
+
+  // A partial batch is written when the store is closed.
+  EXPECT_TRUE(manager->SetCookies("http://batch-flush.test.com/",
+                                  cookie_lines));
+
+  if (kBatchSize == 1) {
+    // Every change is a full batch so it is committed without waiting for the
+    // store to close.
+    WaitForIOThread();
+    WaitForThread(TID_FILE);
+
+    ScopedTempDir copy_dir2;
+    EXPECT_TRUE(copy_dir2.CreateUniqueTempDir());
+    EXPECT_TRUE(file_util::CopyFile(temp_dir.path().AppendASCII("Cookies"),
+                                    copy_dir2.path().AppendASCII("Cookies")));
+
+    CefRefPtr<CefCookieManager> copy_manager2 =
+        CefCookieManager::CreateManager(copy_dir2.path().value());
+    EXPECT_TRUE(copy_manager2.get());
+    cookies.clear();
+    VisitAllCookies(copy_manager2, cookies, false, event);
+    EXPECT_EQ((CookieVector::size_type)kBatchSize + 1, cookies.size());
+
+    EXPECT_TRUE(copy_manager2->SetStoragePath(CefString()));
+    WaitForIOThread();
+  }
+
+  EXPECT_TRUE(manager->SetStoragePath(CefString()));
+  WaitForIOThread();
+  EXPECT_TRUE(manager->SetStoragePath(temp_dir.path().value()));
+  WaitForIOThread();
+
+  cookies.clear();
+  VisitAllCookies(manager, cookies, false, event);
+  EXPECT_EQ((CookieVector::size_type)kBatchSize + 1, cookies.size());
+
+  EXPECT_TRUE(copy_manager->SetStoragePath(CefString()));
+  EXPECT_TRUE(manager->SetStoragePath(CefString()));
+  WaitForIOThread();
+}
+
+// Test setting and deleting multiple cookies with a single call.
+TEST(CookieTest, SetAndDeleteMultipleCookies) {
+  base::WaitableEvent event(false, false);
+  CookieVector cookies;
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager.get());
+
+  std::vector<CefString> cookie_lines;
+  cookie_lines.push_back("my_cookie1=My Value 1");
+  cookie_lines.push_back("my_cookie2=My Value 2; HttpOnly");
+  cookie_lines.push_back("my_cookie3=My Value 3; path=/");
+  EXPECT_TRUE(manager->SetCookies(kTestUrl, cookie_lines));
+
+  // Verify that all cookies were set.
+  VisitUrlCookies(manager, kTestUrl, true, cookies, false, event);
+  EXPECT_EQ((CookieVector::size_type)3, cookies.size());
+
+  std::vector<CefString> urls;
+  urls.push_back(kTestUrl);
+  urls.push_back("http://www.other.com");
+  EXPECT_TRUE(manager->DeleteUrlCookies(urls, CefString()));
+
+  // Verify that all cookies were deleted.
+  VerifyNoCookies(manager, event, false);
+}
+
+// Test visiting cookies in pages.
+TEST(CookieTest, VisitCookiePages) {
+  base::WaitableEvent event(false, false);
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager.get());
+
+  std::vector<CefString> cookie_lines;
+  cookie_lines.push_back("my_cookie1=My Value 1");
+  cookie_lines.push_back("my_cookie2=My Value 2");
+  cookie_lines.push_back("my_cookie3=My Value 3");
+  cookie_lines.push_back("my_cookie4=My Value 4");
+  cookie_lines.push_back("my_cookie5=My Value 5");
+  EXPECT_TRUE(manager->SetCookies(kTestUrl, cookie_lines));
+  cookie_lines.clear();
+  cookie_lines.push_back("my_cookie1=Other Value");
+  EXPECT_TRUE(manager->SetCookies("http://www.other.com", cookie_lines));
+
+  // Visit all pages. Cookies are ordered by domain and then by name.
+  CookieVector cookies;
+  std::vector<int> page_sizes;
+  CefString next_cursor;
+  VisitCookiePages(manager, CefString(), CefString(), 2, CefString(), 10,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)6, cookies.size());
+  EXPECT_EQ((std::vector<int>::size_type)3, page_sizes.size());
+  EXPECT_TRUE(next_cursor.empty());
+  EXPECT_EQ(CefString(&cookies[0].value), "Other Value");
+  EXPECT_EQ(CefString(&cookies[5].name), "my_cookie5");
+
+  // Visit the first page only.
+  cookies.clear();
+  page_sizes.clear();
+  VisitCookiePages(manager, CefString(), CefString(), 4, CefString(), 1,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)4, cookies.size());
+  EXPECT_EQ(CefString(&cookies[3].name), "my_cookie3");
+  EXPECT_FALSE(next_cursor.empty());
+
+  // Resume at the cursor without changing any cookies.
+  CookieVector remaining;
+  CefString resumed_cursor;
+  VisitCookiePages(manager, CefString(), CefString(), 4, next_cursor, 10,
+                   remaining, page_sizes, resumed_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)2, remaining.size());
+  EXPECT_EQ(CefString(&remaining[0].name), "my_cookie4");
+  EXPECT_EQ(CefString(&remaining[1].name), "my_cookie5");
+  EXPECT_TRUE(resumed_cursor.empty());
+
+  // Delete a cookie that was already visited and add a new cookie before
+  // resuming at the cursor. No cookies are skipped or repeated.
+  DeleteCookies(manager, kTestUrl, "my_cookie1", event);
+  cookie_lines.clear();
+  cookie_lines.push_back("my_cookie6=My Value 6");
+  EXPECT_TRUE(manager->SetCookies(kTestUrl, cookie_lines));
+
+  cookies.clear();
+  page_sizes.clear();
+  VisitCookiePages(manager, CefString(), CefString(), 4, next_cursor, 10,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)3, cookies.size());
+  EXPECT_EQ(CefString(&cookies[0].name), "my_cookie4");
+  EXPECT_EQ(CefString(&cookies[1].name), "my_cookie5");
+  EXPECT_EQ(CefString(&cookies[2].name), "my_cookie6");
+  EXPECT_TRUE(next_cursor.empty());
+
+  // Invalid cursors are rejected.
+  EXPECT_FALSE(manager->VisitCookiePages(CefString(), CefString(), 4,
+      "invalid", new TestPageVisitor(&cookies, &page_sizes, &next_cursor, 1,
+                                     &event)));
+  event.Wait();
+
+  // Filter by domain.
+  cookies.clear();
+  page_sizes.clear();
+  VisitCookiePages(manager, "test.com", CefString(), 10, CefString(), 10,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)5, cookies.size());
+
+  // Filter by name.
+  cookies.clear();
+  page_sizes.clear();
+  VisitCookiePages(manager, CefString(), "my_cookie2", 10, CefString(), 10,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)1, cookies.size());
+
+  // Filter by domain and name.
+  cookies.clear();
+  page_sizes.clear();
+  VisitCookiePages(manager, "www.other.com", "my_cookie1", 10, CefString(), 10,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((CookieVector::size_type)1, cookies.size());
+  EXPECT_EQ(CefString(&cookies[0].value), "Other Value");
+
+  // Filters that match nothing still deliver an empty page.
+  cookies.clear();
+  page_sizes.clear();
+  VisitCookiePages(manager, "www.none.com", CefString(), 10, CefString(), 10,
+                   cookies, page_sizes, next_cursor, event);
+  EXPECT_EQ((std::vector<int>::size_type)1, page_sizes.size());
+  EXPECT_EQ(0, page_sizes[0]);
+  EXPECT_TRUE(next_cursor.empty());
+}
+
+// Test export and import of 10,000 cookies and record the time taken to
+// restore them.
+TEST(CookieTest, ExportAndImportCookies) {
+  static const int kCookieCount = 10000;
+  base::WaitableEvent event(false, false);
+
+  CefRefPtr<CefCookieManager> manager1 =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager1.get());
+  CefRefPtr<CefCookieManager> manager2 =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager2.get());
+
+  // Invalid data should be rejected.
+  EXPECT_FALSE(manager1->ImportCookies("invalid"));
+
+  std::string data = "CEFCOOKIES 1\n";
+  for (int i = 0; i < kCookieCount; ++i) {
+    // Domain, path, name, value, expiration and flags.
+    data += base::StringPrintf("www.test%d.com\t/\tname%d\tvalue%d\t0\t%d\n",
+                               i, i, i, i % 4);
+  }
+
+  base::TimeTicks start_time = base::TimeTicks::Now();
+  EXPECT_TRUE(manager1->ImportCookies(data));
+
+  // Visiting the cookies will wait for the import to complete.
+  CookieVector cookies;
+  VisitAllCookies(manager1, cookies, false, event);
+
+  // Reported in the test output XML as a property of this test.
+  base::TimeDelta restore_time = base::TimeTicks::Now() - start_time;
+  RecordProperty("RestoreTimeMs",
+                 static_cast<int>(restore_time.InMilliseconds()));
+
+  // Each cookie has a separate domain so the per-domain limit does not apply
+  // and the cookies were accessed too recently to be purged by the global
+  // limit.
+  EXPECT_EQ((CookieVector::size_type)kCookieCount, cookies.size());
+
+  // Export the cookies and import them into the second manager.
+  std::string exported_data;
+  int exported_count = 0;
+  ExportCookies(manager1, exported_data, exported_count, event);
+  EXPECT_EQ(kCookieCount, exported_count);
+  EXPECT_TRUE(manager2->ImportCookies(exported_data));
+
+  CookieVector cookies2;
+  VisitAllCookies(manager2, cookies2, false, event);
+  ASSERT_EQ((CookieVector::size_type)kCookieCount, cookies2.size());
+
+  // Every cookie survives the round trip unchanged.
+  std::vector<bool> found(kCookieCount, false);
+  CookieVector::const_iterator it = cookies2.begin();
+  for (; it != cookies2.end(); ++it) {
+    const CefCookie& cookie = *it;
+    std::string name = CefString(&cookie.name);
+    int i = -1;
+    ASSERT_EQ(1, sscanf(name.c_str(), "name%d", &i));
+    ASSERT_TRUE(i >= 0 && i < kCookieCount);
+    EXPECT_FALSE(found[i]);
+    found[i] = true;
+
+    EXPECT_EQ(base::StringPrintf("value%d", i),
+              CefString(&cookie.value).ToString());
+    EXPECT_EQ(base::StringPrintf("www.test%d.com", i),
+              CefString(&cookie.domain).ToString());
+    EXPECT_EQ("/", CefString(&cookie.path).ToString());
+    EXPECT_EQ((i & 1) != 0, cookie.secure ? true : false);
+    EXPECT_EQ((i & 2) != 0, cookie.httponly ? true : false);
+    EXPECT_FALSE(cookie.has_expires);
+  }
+}
 
 namespace {
 
@@ -684,6 +1172,189 @@ TEST(CookieTest, GetCookieManagerJS) {
 }
 
 
+namespace {
+
+const char* kCookieCachedUrl = "http://tests/cookie_cached.html";
+
+class CookieTestCachedManagerHandler : public TestHandler {
+ public:
+  CookieTestCachedManagerHandler() : cookie_manager_count_(0) {}
+
+  virtual void RunTest() OVERRIDE {
+    // Create a new in-memory manager.
+    manager_ = CefCookieManager::CreateManager(CefString());
+
+    std::string page =
+        "<html><head>"
+        "<script>"
+        "document.cookie='name1=value1';"
+        "document.cookie='name2=value2';"
+        "document.cookie='name3=value3';"
+        "</script>"
+        "</head><body>COOKIE TEST</body></html>";
+    AddResource(kCookieCachedUrl, page, "text/html");
+
+    // Create the browser
+    CreateBrowser(kCookieCachedUrl);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    base::WaitableEvent event(false, false);
+
+    // Get the cookies.
+    VisitUrlCookies(manager_, kCookieCachedUrl, false, cookies_, false,
+                    event);
+
+    DestroyTest();
+  }
+
+  virtual CefRefPtr<CefCookieManager> GetCookieManager(
+      CefRefPtr<CefBrowser> browser,
+      const CefString& main_url) OVERRIDE {
+    if (main_url == kCookieCachedUrl)
+      cookie_manager_count_++;
+    return manager_;
+  }
+
+  CefRefPtr<CefCookieManager> manager_;
+  int cookie_manager_count_;
+  CookieVector cookies_;
+};
+
+}  // namespace
+
+// Verify that the cookie manager is only requested once per main URL.
+TEST(CookieTest, GetCookieManagerCached) {
+  CefRefPtr<CookieTestCachedManagerHandler> handler =
+      new CookieTestCachedManagerHandler();
+  handler->ExecuteTest();
+
+  EXPECT_EQ(1, handler->cookie_manager_count_);
+  EXPECT_EQ((CookieVector::size_type)3, handler->cookies_.size());
+}
+
+
+namespace {
+
+const char* kCookieSnapshotUrl = "http://tests/cookie_snapshot.html";
+
+class CookieTestSnapshotHandler : public TestHandler {
+ public:
+  // Reads document.cookie and advances to the next step.
+  class ReadCallback : public CefJavaScriptResultCallback {
+   public:
+    explicit ReadCallback(CookieTestSnapshotHandler* handler)
+      : handler_(handler) {
+    }
+
+    virtual void OnComplete(CefRefPtr<CefListValue> results,
+                            CefRefPtr<CefListValue> exceptions) OVERRIDE {
+      handler_->OnRead(results->GetString(0));
+    }
+
+   private:
+    CookieTestSnapshotHandler* handler_;
+
+    IMPLEMENT_REFCOUNTING(ReadCallback);
+  };
+
+  CookieTestSnapshotHandler() : use_manager2_(false) {}
+
+  virtual void RunTest() OVERRIDE {
+    base::WaitableEvent event(false, false);
+
+    // Create new in-memory managers with different cookies for the same URL.
+    manager1_ = CefCookieManager::CreateManager(CefString());
+    manager2_ = CefCookieManager::CreateManager(CefString());
+    SetCookie(manager1_, "name1", "value1", event);
+    SetCookie(manager2_, "name3", "value3", event);
+
+    AddResource(kCookieSnapshotUrl, "<html><body>COOKIE TEST</body></html>",
+                "text/html");
+
+    // Create the browser
+    CreateBrowser(kCookieSnapshotUrl);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (frame->IsMain())
+      Read();
+  }
+
+  virtual CefRefPtr<CefCookieManager> GetCookieManager(
+      CefRefPtr<CefBrowser> browser,
+      const CefString& main_url) OVERRIDE {
+    return use_manager2_ ? manager2_ : manager1_;
+  }
+
+  void Read() {
+    GetBrowser()->GetMainFrame()->EvaluateJavaScript("document.cookie", "", 1,
+        new ReadCallback(this));
+  }
+
+  void OnRead(const std::string& cookie_line) {
+    base::WaitableEvent event(false, false);
+
+    cookie_lines_.push_back(cookie_line);
+    if (cookie_lines_.size() == 1) {
+      // Change a cookie outside of the renderer. The change notification is
+      // delivered to the UI thread before the next read.
+      SetCookie(manager1_, "name2", "value2", event);
+    } else if (cookie_lines_.size() == 2) {
+      // Select a different cookie manager for the same URL.
+      use_manager2_ = true;
+      GetBrowser()->InvalidateCookieManager();
+    } else {
+      DestroyTest();
+      return;
+    }
+
+    CefPostTask(TID_UI,
+        NewCefRunnableMethod(this, &CookieTestSnapshotHandler::Read));
+  }
+
+  void SetCookie(CefRefPtr<CefCookieManager> manager,
+                 const std::string& name,
+                 const std::string& value,
+                 base::WaitableEvent& event) {
+    CookieVector cookies;
+    CefCookie cookie;
+    CefString(&cookie.name).FromASCII(name.c_str());
+    CefString(&cookie.value).FromASCII(value.c_str());
+    CefString(&cookie.path).FromASCII("/");
+    cookies.push_back(cookie);
+    SetCookies(manager, kCookieSnapshotUrl, cookies, event);
+  }
+
+  CefRefPtr<CefCookieManager> manager1_;
+  CefRefPtr<CefCookieManager> manager2_;
+  bool use_manager2_;
+  std::vector<std::string> cookie_lines_;
+};
+
+}  // namespace
+
+// Verify that document.cookie reads reflect cookie changes and the cookie
+// manager selected for the browser.
+TEST(CookieTest, DocumentCookieSnapshot) {
+  CefRefPtr<CookieTestSnapshotHandler> handler =
+      new CookieTestSnapshotHandler();
+  handler->ExecuteTest();
+
+  ASSERT_EQ((size_t)3, handler->cookie_lines_.size());
+  EXPECT_EQ("name1=value1", handler->cookie_lines_[0]);
+  EXPECT_EQ("name1=value1; name2=value2", handler->cookie_lines_[1]);
+  EXPECT_EQ("name3=value3", handler->cookie_lines_[2]);
+}
+
+
 namespace {
 
 const char* kCookieHttpUrl1 = "http://cookie-tests/cookie1.html";
@@ -2,10 +2,12 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include "include/cef_cookie.h"
 #include "include/cef_origin_whitelist.h"
 #include "include/cef_runnable.h"
 #include "include/cef_scheme.h"
 #include "tests/unittests/test_handler.h"
+#include "base/synchronization/waitable_event.h"
 
 namespace {
 
@@ -21,6 +23,10 @@ class TestResults {
     url.clear();
     html.clear();
     status_code = 0;
+    cache_control.clear();
+    etag.clear();
+    set_cookie.clear();
+    request_cookie.clear();
     redirect_url.clear();
     sub_url.clear();
     sub_html.clear();
@@ -33,6 +39,7 @@ class TestResults {
     got_output.reset();
     got_redirect.reset();
     got_error.reset();
+    got_validation.reset();
     got_sub_request.reset();
     got_sub_read.reset();
     got_sub_success.reset();
@@ -42,6 +49,15 @@ class TestResults {
   std::string html;
   int status_code;
 
+  // Used for testing cached responses. If |etag| is set a request that
+  // contains a matching If-None-Match header receives a 304 response.
+  std::string cache_control;
+  std::string etag;
+
+  // Used for testing cookies
+  std::string set_cookie;
+  std::string request_cookie;
+
   // Used for testing redirects
   std::string redirect_url;
 
@@ -61,6 +77,7 @@ class TestResults {
       got_output,
       got_redirect,
       got_error,
+      got_validation,
       got_sub_request,
       got_sub_read,
       got_sub_success;
@@ -161,6 +178,7 @@ class ClientSchemeHandler : public CefSchemeHandler {
     : test_results_(tr),
       offset_(0),
       is_sub_(false),
+      is_not_modified_(false),
       has_delayed_(false) {
   }
 
@@ -185,6 +203,20 @@ class ClientSchemeHandler : public CefSchemeHandler {
 
       test_results_->got_request.yes();
 
+      CefRequest::HeaderMap headers;
+      request->GetHeaderMap(headers);
+      CefRequest::HeaderMap::const_iterator it = headers.find("Cookie");
+      if (it != headers.end())
+        test_results_->request_cookie = it->second;
+
+      if (!test_results_->etag.empty()) {
+        it = headers.find("If-None-Match");
+        if (it != headers.end() && it->second == test_results_->etag) {
+          test_results_->got_validation.yes();
+          is_not_modified_ = true;
+        }
+      }
+
       if (!test_results_->html.empty())
         handled = true;
     }
@@ -229,9 +261,25 @@ class ClientSchemeHandler : public CefSchemeHandler {
     } else if (!test_results_->redirect_url.empty()) {
       redirectUrl = test_results_->redirect_url;
     } else {
-      response->SetStatus(test_results_->status_code);
+      response->SetStatus(is_not_modified_ ? 304 : test_results_->status_code);
+
+      CefResponse::HeaderMap headers;
+      if (!test_results_->cache_control.empty()) {
+        headers.insert(std::make_pair("Cache-Control",
+                                      test_results_->cache_control));
+      }
+      if (!test_results_->etag.empty())
+        headers.insert(std::make_pair("ETag", test_results_->etag));
+      if (!test_results_->set_cookie.empty()) {
+        headers.insert(std::make_pair("Set-Cookie",
+                                      test_results_->set_cookie));
+      }
+      if (!headers.empty())
+        response->SetHeaderMap(headers);
 
-      if (!test_results_->html.empty()) {
+      if (is_not_modified_) {
+        response_length = 0;
+      } else if (!test_results_->html.empty()) {
         response->SetMimeType("text/html");
         response_length = test_results_->html.size();
       }
@@ -263,6 +311,12 @@ class ClientSchemeHandler : public CefSchemeHandler {
       has_delayed_ = false;
     }
 
+    // A 304 response has no body.
+    if (is_not_modified_) {
+      bytes_read = 0;
+      return false;
+    }
+
     std::string* data;
 
     if (is_sub_) {
@@ -301,6 +355,7 @@ class ClientSchemeHandler : public CefSchemeHandler {
   TestResults* test_results_;
   size_t offset_;
   bool is_sub_;
+  bool is_not_modified_;
   bool has_delayed_;
 
   IMPLEMENT_REFCOUNTING(ClientSchemeHandler);
@@ -329,6 +384,69 @@ class ClientSchemeHandlerFactory : public CefSchemeHandlerFactory {
 // Global test results object.
 TestResults g_TestResults;
 
+void IOT_SetCookie(const std::string& url, const std::string& name,
+                   const std::string& value, base::WaitableEvent* event) {
+  CefCookie cookie;
+  CefString(&cookie.name).FromASCII(name.c_str());
+  CefString(&cookie.value).FromASCII(value.c_str());
+  CefString(&cookie.path).FromASCII("/");
+  EXPECT_TRUE(CefCookieManager::GetGlobalManager()->SetCookie(url, cookie));
+  event->Signal();
+}
+
+void IOT_DeleteCookies(const std::string& url, base::WaitableEvent* event) {
+  EXPECT_TRUE(CefCookieManager::GetGlobalManager()->DeleteCookies(url,
+                                                                  CefString()));
+  event->Signal();
+}
+
+// Collects the names of the visited cookies.
+class CookieNameVisitor : public CefCookieVisitor {
+ public:
+  CookieNameVisitor(std::set<std::string>* names, base::WaitableEvent* event)
+    : names_(names),
+      event_(event) {
+  }
+  virtual ~CookieNameVisitor() {
+    event_->Signal();
+  }
+
+  virtual bool Visit(const CefCookie& cookie, int count, int total,
+                     bool& deleteCookie) OVERRIDE {
+    names_->insert(CefString(&cookie.name));
+    return true;
+  }
+
+ private:
+  std::set<std::string>* names_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(CookieNameVisitor);
+};
+
+void SetCookie(const std::string& url, const std::string& name,
+               const std::string& value) {
+  base::WaitableEvent event(false, false);
+  CefPostTask(TID_IO, NewCefRunnableFunction(IOT_SetCookie, url, name, value,
+                                             &event));
+  event.Wait();
+}
+
+void DeleteCookies(const std::string& url) {
+  base::WaitableEvent event(false, false);
+  CefPostTask(TID_IO, NewCefRunnableFunction(IOT_DeleteCookies, url, &event));
+  event.Wait();
+}
+
+std::set<std::string> GetCookieNames(const std::string& url) {
+  std::set<std::string> names;
+  base::WaitableEvent event(false, false);
+  EXPECT_TRUE(CefCookieManager::GetGlobalManager()->VisitUrlCookies(url, false,
+      new CookieNameVisitor(&names, &event)));
+  event.Wait();
+  return names;
+}
+
 // If |domain| is empty the scheme will be registered as non-standard.
 void RegisterTestScheme(const std::string& scheme, const std::string& domain) {
   g_TestResults.reset();
@@ -524,6 +642,147 @@ TEST(SchemeHandlerTest, CustomStandardNormalResponseDelayed) {
   ClearTestSchemes();
 }
 
+// Test that a scheme handler can return normal results with cookies disabled
+// and that cookies are neither sent nor saved.
+TEST(SchemeHandlerTest, CustomStandardNormalResponseNoCookies) {
+  const std::string cookie_url = "http://cookietest/";
+
+  RegisterTestScheme("http", "cookietest");
+  EXPECT_TRUE(CefSetSchemeCookiesEnabled("http", false));
+  WaitForIOThread();
+
+  // A cookie that would be sent with the request.
+  SetCookie(cookie_url, "sent", "1");
+
+  g_TestResults.url = cookie_url + "run.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+  g_TestResults.set_cookie = "saved=1; path=/";
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  // The cookie was not sent and the response cookie was not stored.
+  EXPECT_TRUE(g_TestResults.request_cookie.empty());
+  std::set<std::string> names = GetCookieNames(cookie_url);
+  EXPECT_EQ(1U, names.size());
+  EXPECT_TRUE(names.find("sent") != names.end());
+  EXPECT_TRUE(names.find("saved") == names.end());
+
+  EXPECT_TRUE(CefSetSchemeCookiesEnabled("http", true));
+  WaitForIOThread();
+
+  // With cookies enabled the cookie is sent and the response cookie is stored.
+  g_TestResults.got_request.reset();
+  g_TestResults.got_read.reset();
+  g_TestResults.got_output.reset();
+  g_TestResults.request_cookie.clear();
+  handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_EQ("sent=1", g_TestResults.request_cookie);
+  names = GetCookieNames(cookie_url);
+  EXPECT_TRUE(names.find("saved") != names.end());
+
+  DeleteCookies(cookie_url);
+  ClearTestSchemes();
+}
+
+// Test that a custom standard scheme response can be returned from the cache.
+TEST(SchemeHandlerTest, CustomStandardCachedResponse) {
+  RegisterTestScheme("customstd", "test");
+  EXPECT_TRUE(CefSetSchemeCacheEnabled("customstd", true));
+  WaitForIOThread();
+
+  g_TestResults.url = "customstd://test/cached.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+  g_TestResults.cache_control = "max-age=3600";
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  // The second request should not reach the handler.
+  g_TestResults.got_request.reset();
+  g_TestResults.got_read.reset();
+  g_TestResults.got_output.reset();
+  handler->ExecuteTest();
+
+  EXPECT_FALSE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  EXPECT_TRUE(CefSetSchemeCacheEnabled("customstd", false));
+  WaitForIOThread();
+
+  ClearTestSchemes();
+}
+
+// Test that a stale cached response is revalidated and returned from the cache
+// when the handler responds with a 304 status.
+TEST(SchemeHandlerTest, CustomStandardRevalidatedResponse) {
+  RegisterTestScheme("customstd", "test");
+  EXPECT_TRUE(CefSetSchemeCacheEnabled("customstd", true));
+  WaitForIOThread();
+
+  // The response is stale as soon as it is cached.
+  g_TestResults.url = "customstd://test/revalidated.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+  g_TestResults.cache_control = "max-age=0";
+  g_TestResults.etag = "\"v1\"";
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_validation);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  // The handler receives the validator and responds with a 304 that extends
+  // the freshness lifetime. The cached body is returned.
+  g_TestResults.cache_control = "max-age=3600";
+  g_TestResults.got_request.reset();
+  g_TestResults.got_read.reset();
+  g_TestResults.got_output.reset();
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_validation);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+  EXPECT_FALSE(g_TestResults.got_error);
+
+  // The updated entry is fresh so the handler is not called.
+  g_TestResults.got_request.reset();
+  g_TestResults.got_validation.reset();
+  g_TestResults.got_output.reset();
+  handler->ExecuteTest();
+
+  EXPECT_FALSE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_validation);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  EXPECT_TRUE(CefSetSchemeCacheEnabled("customstd", false));
+  WaitForIOThread();
+
+  ClearTestSchemes();
+}
+
 // Test that a custom nonstandard scheme can return normal results.
 TEST(SchemeHandlerTest, CustomNonStandardNormalResponse) {
   RegisterTestScheme("customnonstd", std::string());
@@ -626,6 +885,175 @@ TEST(SchemeHandlerTest, CustomStandardDomainNotHandled) {
   ClearTestSchemes();
 }
 
+// Test that custom standard scheme handling matches wildcard domain names.
+TEST(SchemeHandlerTest, CustomStandardWildcardDomain) {
+  RegisterTestScheme("customstd", "*.test");
+  g_TestResults.url = "customstd://a.b.test/run.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  // The wildcard does not match the domain itself.
+  g_TestResults.reset();
+  g_TestResults.url = "customstd://test/run.html";
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_error);
+  EXPECT_FALSE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_FALSE(g_TestResults.got_output);
+
+  ClearTestSchemes();
+}
+
+// Test that custom standard scheme handling matches path prefixes.
+TEST(SchemeHandlerTest, CustomStandardPathPrefix) {
+  RegisterTestScheme("customstd", "test/assets");
+  g_TestResults.url = "customstd://test/assets/run.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  // Paths outside of the prefix are not matched.
+  g_TestResults.reset();
+  g_TestResults.url = "customstd://test/assetsfoo/run.html";
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_error);
+  EXPECT_FALSE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_FALSE(g_TestResults.got_output);
+
+  ClearTestSchemes();
+}
+
+// Test that host names are matched case-insensitively and path prefixes are
+// matched case-sensitively.
+TEST(SchemeHandlerTest, CustomStandardPathPrefixCase) {
+  RegisterTestScheme("customstd", "TEST/Assets");
+  g_TestResults.url = "customstd://test/Assets/run.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  // A path that differs only in case is not matched.
+  g_TestResults.reset();
+  g_TestResults.url = "customstd://test/assets/run.html";
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_error);
+  EXPECT_FALSE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_FALSE(g_TestResults.got_output);
+
+  // Unregistering with a different host case removes the factory.
+  EXPECT_TRUE(CefRegisterSchemeHandlerFactory("customstd", "Test/Assets",
+                                              NULL));
+  WaitForIOThread();
+
+  g_TestResults.reset();
+  g_TestResults.url = "customstd://test/Assets/run.html";
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_error);
+  EXPECT_FALSE(g_TestResults.got_request);
+
+  ClearTestSchemes();
+}
+
+// Test that unregistering factories releases all routing table entries.
+TEST(SchemeHandlerTest, RegistrationCleanup) {
+  // Register the scheme and a factory that will be used for every route.
+  RegisterTestScheme("customstd", "test");
+  EXPECT_TRUE(CefRegisterSchemeHandlerFactory("customstd", "test", NULL));
+  WaitForIOThread();
+
+  CefRefPtr<ClientSchemeHandlerFactory> factory =
+      new ClientSchemeHandlerFactory(&g_TestResults);
+
+  static const char* kDomains[] = {
+    "test",
+    "a.test",
+    "*.test",
+    "b.c.test",
+    "*.c.test",
+    "example.com",
+    "test/assets",
+    "test/assets/img",
+    "a.test/assets/img/logo",
+    "*.test/assets",
+    "",
+  };
+  const size_t kDomainsCount = arraysize(kDomains);
+
+  // Register and unregister the routes multiple times.
+  for (int i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < kDomainsCount; ++j) {
+      EXPECT_TRUE(CefRegisterSchemeHandlerFactory("customstd", kDomains[j],
+                                                  factory.get()));
+    }
+    WaitForIOThread();
+
+    // Remove in reverse order so that parent nodes are removed last.
+    for (size_t j = kDomainsCount; j > 0; --j) {
+      EXPECT_TRUE(CefRegisterSchemeHandlerFactory("customstd",
+                                                  kDomains[j - 1], NULL));
+    }
+    WaitForIOThread();
+  }
+
+  // No routing table entries reference the factory.
+  factory->AddRef();
+  EXPECT_EQ(1, factory->Release());
+
+  // No factory matches after all routes are removed.
+  g_TestResults.url = "customstd://a.test/assets/img/logo/run.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_error);
+  EXPECT_FALSE(g_TestResults.got_request);
+
+  // The table can be rebuilt after it has been emptied.
+  EXPECT_TRUE(CefRegisterSchemeHandlerFactory("customstd", "*.test",
+                                              factory.get()));
+  WaitForIOThread();
+
+  g_TestResults.got_error.reset();
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  ClearTestSchemes();
+}
+
 // Test that a custom standard scheme can return no response.
 TEST(SchemeHandlerTest, CustomStandardNoResponse) {
   RegisterTestScheme("customstd", "test");
@@ -2,11 +2,16 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include "include/cef_runnable.h"
 #include "include/cef_storage.h"
 #include "include/cef_v8.h"
 #include "tests/unittests/test_handler.h"
 #include "tests/unittests/test_suite.h"
+#include "base/file_util.h"
 #include "base/scoped_temp_dir.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/threading/platform_thread.h"
+#include "base/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace {
@@ -107,11 +112,95 @@ class StorageTestHandler : public TestHandler {
     IMPLEMENT_REFCOUNTING(StorageVisitor);
   };
 
+  class StorageBatchVisitor : public CefStorageBatchVisitor {
+   public:
+    StorageBatchVisitor(CefRefPtr<StorageTestHandler> tester,
+                        TrackCallback* callback1, TrackCallback* callback2,
+                        int expected_total)
+      : tester_(tester), callback1_(callback1), callback2_(callback2),
+        expected_total_(expected_total), actual_total_(0) {
+    }
+    virtual ~StorageBatchVisitor() {
+      EXPECT_EQ(expected_total_, actual_total_);
+    }
+
+    virtual bool Visit(CefStorageType type, const CefString& origin,
+                       const std::vector<CefString>& keys,
+                       const std::vector<CefString>& values, int count,
+                       int total) OVERRIDE {
+      EXPECT_EQ(type, tester_->type_);
+      std::string originStr = origin;
+      EXPECT_EQ(originStr, kOrigin);
+      EXPECT_EQ(keys.size(), values.size());
+      EXPECT_EQ(actual_total_, count);
+      EXPECT_EQ(expected_total_, total);
+
+      for (size_t i = 0; i < keys.size(); ++i) {
+        std::string keyStr = keys[i];
+        std::string valueStr = values[i];
+        if (keyStr == kKey1 && valueStr == kVal1)
+          callback1_->yes();
+        else if (keyStr == kKey2 && valueStr == kVal2)
+          callback2_->yes();
+      }
+
+      actual_total_ += static_cast<int>(keys.size());
+      return true;
+    }
+
+    CefRefPtr<StorageTestHandler> tester_;
+    TrackCallback* callback1_;
+    TrackCallback* callback2_;
+    int expected_total_;
+    int actual_total_;
+
+    IMPLEMENT_REFCOUNTING(StorageBatchVisitor);
+  };
+
+  class StorageObserver : public CefStorageObserver {
+   public:
+    explicit StorageObserver(CefRefPtr<StorageTestHandler> tester)
+      : tester_(tester) {
+    }
+
+    virtual void OnStorageChanged(CefRefPtr<CefStorageChanges> changes)
+        OVERRIDE {
+      EXPECT_LT(0, changes->GetCount());
+
+      for (int i = 0; i < changes->GetCount(); ++i) {
+        if (changes->GetStorageType(i) != tester_->type_)
+          continue;
+        std::string originStr = changes->GetOrigin(i);
+        EXPECT_EQ(originStr, kOrigin);
+
+        std::string keyStr = changes->GetKey(i);
+        std::string newValueStr = changes->GetNewValue(i);
+        if (changes->GetChangeType(i) == SCT_SET) {
+          if (keyStr == kKey1 && newValueStr == kVal1)
+            tester_->got_cpp_observe_set1_.yes();
+          else if (keyStr == kKey2 && newValueStr == kVal2)
+            tester_->got_cpp_observe_set2_.yes();
+        } else if (changes->GetChangeType(i) == SCT_REMOVE) {
+          std::string oldValueStr = changes->GetOldValue(i);
+          if (keyStr == kKey1 && oldValueStr == kVal1)
+            tester_->got_cpp_observe_remove1_.yes();
+          else if (keyStr == kKey2 && oldValueStr == kVal2)
+            tester_->got_cpp_observe_remove2_.yes();
+        }
+      }
+    }
+
+    CefRefPtr<StorageTestHandler> tester_;
+
+    IMPLEMENT_REFCOUNTING(StorageObserver);
+  };
+
   StorageTestHandler(CefStorageType type, bool expectKeysSet, bool leaveKeysSet)
     : type_(type),
       expect_keys_set_(expectKeysSet),
       leave_keys_set_(leaveKeysSet),
-      nav_(0) {}
+      nav_(0),
+      observer_id_(0) {}
 
   virtual void RunTest() OVERRIDE {
     // Verify the key status.
@@ -122,6 +211,10 @@ class StorageTestHandler : public TestHandler {
                             &got_cpp_startupvisit_fail_,
                             expect_keys_set_?2:0));
 
+    // Observe changes made by JS and by the storage functions.
+    observer_id_ = CefAddStorageObserver(new StorageObserver(this));
+    EXPECT_LT(0, observer_id_);
+
     std::stringstream ss;
 
     std::string func =
@@ -295,6 +388,38 @@ class StorageTestHandler : public TestHandler {
                              &got_cpp_all_reset1d_,
                              &got_cpp_all_reset2d_, 2));
 
+      // The loaded values are counted as memory usage.
+      EXPECT_LT(0, CefGetStorageMemoryUsage(type_));
+
+      // Verify batched read with one pair per batch.
+      CefVisitStorageBatches(type_, kOrigin, 1,
+          new StorageBatchVisitor(this, &got_cpp_batch_read1_,
+                                  &got_cpp_batch_read2_, 2));
+
+      std::vector<CefString> keys, values;
+      keys.push_back(kKey1);
+      keys.push_back(kKey2);
+      values.push_back(kVal1);
+      values.push_back(kVal2);
+
+      // Delete multiple values.
+      EXPECT_TRUE(CefDeleteStorageItems(type_, kOrigin, keys));
+
+      // Verify that all values have been deleted.
+      CefVisitStorage(type_, "", "",
+          new StorageVisitor(this, "delete_items_verify",
+                             StorageVisitor::VisitKey,
+                             &got_cpp_afterdeleteitems_fail_,
+                             &got_cpp_afterdeleteitems_fail_, 0));
+
+      // Set multiple values.
+      EXPECT_TRUE(CefSetStorageItems(type_, kOrigin, keys, values));
+
+      // Verify that all values have been set.
+      CefGetStorageItems(type_, kOrigin, keys,
+          new StorageBatchVisitor(this, &got_cpp_get_items1_,
+                                  &got_cpp_get_items2_, 2));
+
       nav_++;
       // Verify JS read after navigation.
       frame->LoadURL(kNav2);
@@ -312,6 +437,9 @@ class StorageTestHandler : public TestHandler {
                               &got_cpp_shutdownvisit_fail_,
                               leave_keys_set_?2:0));
 
+      EXPECT_TRUE(CefRemoveStorageObserver(observer_id_));
+      observer_id_ = 0;
+
       DestroyTest();
     }
   }
@@ -333,6 +461,7 @@ class StorageTestHandler : public TestHandler {
   bool expect_keys_set_;
   bool leave_keys_set_;
   int nav_;
+  int observer_id_;
 
   TrackCallback got_cpp_startupvisit_fail_;
   TrackCallback got_cpp_all_read1_;
@@ -363,6 +492,15 @@ class StorageTestHandler : public TestHandler {
   TrackCallback got_cpp_afterdeletekey2_fail_;
   TrackCallback got_cpp_all_reset1d_;
   TrackCallback got_cpp_all_reset2d_;
+  TrackCallback got_cpp_batch_read1_;
+  TrackCallback got_cpp_batch_read2_;
+  TrackCallback got_cpp_afterdeleteitems_fail_;
+  TrackCallback got_cpp_get_items1_;
+  TrackCallback got_cpp_get_items2_;
+  TrackCallback got_cpp_observe_set1_;
+  TrackCallback got_cpp_observe_set2_;
+  TrackCallback got_cpp_observe_remove1_;
+  TrackCallback got_cpp_observe_remove2_;
   TrackCallback got_js_read1_;
   TrackCallback got_js_read2_;
   TrackCallback got_cpp_shutdownvisit_fail_;
@@ -406,6 +544,15 @@ void StorageTest(CefStorageType type, bool expectKeysSet, bool leaveKeysSet) {
   EXPECT_FALSE(handler->got_cpp_afterdeletekey2_fail_);
   EXPECT_TRUE(handler->got_cpp_all_reset1d_);
   EXPECT_TRUE(handler->got_cpp_all_reset2d_);
+  EXPECT_TRUE(handler->got_cpp_batch_read1_);
+  EXPECT_TRUE(handler->got_cpp_batch_read2_);
+  EXPECT_FALSE(handler->got_cpp_afterdeleteitems_fail_);
+  EXPECT_TRUE(handler->got_cpp_get_items1_);
+  EXPECT_TRUE(handler->got_cpp_get_items2_);
+  EXPECT_TRUE(handler->got_cpp_observe_set1_);
+  EXPECT_TRUE(handler->got_cpp_observe_set2_);
+  EXPECT_TRUE(handler->got_cpp_observe_remove1_);
+  EXPECT_TRUE(handler->got_cpp_observe_remove2_);
   EXPECT_TRUE(handler->got_js_read1_);
   EXPECT_TRUE(handler->got_js_read2_);
 
@@ -415,6 +562,175 @@ void StorageTest(CefStorageType type, bool expectKeysSet, bool leaveKeysSet) {
     EXPECT_FALSE(handler->got_cpp_shutdownvisit_fail_);
 }
 
+class FlushTask : public CefTask {
+ public:
+  explicit FlushTask(base::WaitableEvent* event) : event_(event) {}
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    EXPECT_EQ(TID_FILE, threadId);
+    event_->Signal();
+  }
+
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(FlushTask);
+};
+
+// Counts the notifications that it receives.
+class CountingStorageObserver : public CefStorageObserver {
+ public:
+  CountingStorageObserver() : count_(0) {}
+
+  virtual void OnStorageChanged(CefRefPtr<CefStorageChanges> changes)
+      OVERRIDE {
+    count_++;
+  }
+
+  int count_;
+
+  IMPLEMENT_REFCOUNTING(CountingStorageObserver);
+};
+
+void UIT_ChangeStorageAfterRemovingObserver(
+    CefRefPtr<CountingStorageObserver> removed_observer,
+    CefRefPtr<CountingStorageObserver> observer,
+    int* observer_id) {
+  int removed_id = CefAddStorageObserver(removed_observer);
+  EXPECT_LT(0, removed_id);
+  *observer_id = CefAddStorageObserver(observer);
+  EXPECT_LT(0, *observer_id);
+  EXPECT_NE(removed_id, *observer_id);
+
+  // Notifications for the changes are delivered from a later task so removing
+  // the observer now must prevent delivery.
+  EXPECT_TRUE(CefSetStorage(ST_LOCALSTORAGE, kOrigin, kKey1, kVal1));
+  EXPECT_TRUE(CefRemoveStorageObserver(removed_id));
+  EXPECT_TRUE(CefDeleteStorage(ST_LOCALSTORAGE, kOrigin, kKey1));
+}
+
+// Records the type and origin of each change that it receives.
+class RecordingStorageObserver : public CefStorageObserver {
+ public:
+  virtual void OnStorageChanged(CefRefPtr<CefStorageChanges> changes)
+      OVERRIDE {
+    for (int i = 0; i < changes->GetCount(); ++i) {
+      change_types_.push_back(changes->GetChangeType(i));
+      origins_.push_back(changes->GetOrigin(i));
+    }
+  }
+
+  std::vector<CefStorageChangeType> change_types_;
+  std::vector<std::string> origins_;
+
+  IMPLEMENT_REFCOUNTING(RecordingStorageObserver);
+};
+
+void UIT_AddStorageObserver(CefRefPtr<CefStorageObserver> observer,
+                            int* observer_id) {
+  *observer_id = CefAddStorageObserver(observer);
+  EXPECT_LT(0, *observer_id);
+}
+
+void UIT_SetLocalStorage(const std::string& origin, const std::string& key,
+                         const std::string& value) {
+  EXPECT_TRUE(CefSetStorage(ST_LOCALSTORAGE, origin, key, value));
+}
+
+void UIT_DeleteLocalStorage(const std::string& origin) {
+  EXPECT_TRUE(CefDeleteStorage(ST_LOCALSTORAGE, origin, CefString()));
+}
+
+// Run |task| on the UI thread and wait for the resulting notifications to be
+// delivered from a later UI thread task.
+void RunOnUIThreadAndNotify(CefRefPtr<CefTask> task) {
+  CefPostTask(TID_UI, task);
+  WaitForThread(TID_UI);
+  WaitForThread(TID_UI);
+}
+
+// Default value for CefSettings.local_storage_quota in bytes.
+const size_t kLocalStorageQuota = 5 * 1024 * 1024;
+
+// Value for CefSettings.local_storage_memory_limit set by CefTestSuite.
+const int64 kLocalStorageMemoryLimit = 1024 * 1024;
+
+// Signals |event| when the last reference is released, which happens after
+// CefGetStorageItems() has finished on the UI thread.
+class GetItemVisitor : public CefStorageBatchVisitor {
+ public:
+  GetItemVisitor(std::string* value, base::WaitableEvent* event)
+    : value_(value), event_(event) {}
+  virtual ~GetItemVisitor() {
+    event_->Signal();
+  }
+
+  virtual bool Visit(CefStorageType type, const CefString& origin,
+                     const std::vector<CefString>& keys,
+                     const std::vector<CefString>& values, int count,
+                     int total) OVERRIDE {
+    EXPECT_EQ(1U, values.size());
+    if (!values.empty())
+      *value_ = values[0];
+    return true;
+  }
+
+  std::string* value_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(GetItemVisitor);
+};
+
+void SetLocalStorageItem(const std::string& origin, const std::string& key,
+                         const std::string& value) {
+  std::vector<CefString> keys, values;
+  keys.push_back(key);
+  values.push_back(value);
+  EXPECT_TRUE(CefSetStorageItems(ST_LOCALSTORAGE, origin, keys, values));
+}
+
+// Returns an empty string if |key| does not exist.
+std::string GetLocalStorageItem(const std::string& origin,
+                                const std::string& key) {
+  std::string value;
+  base::WaitableEvent event(false, false);
+  std::vector<CefString> keys;
+  keys.push_back(key);
+  EXPECT_TRUE(CefGetStorageItems(ST_LOCALSTORAGE, origin, keys,
+                                 new GetItemVisitor(&value, &event)));
+  event.Wait();
+  return value;
+}
+
+void UIT_GetLocalStorageMemoryUsage(int64* usage, base::WaitableEvent* event) {
+  *usage = CefGetStorageMemoryUsage(ST_LOCALSTORAGE);
+  event->Signal();
+}
+
+int64 GetLocalStorageMemoryUsage() {
+  int64 usage = 0;
+  base::WaitableEvent event(false, false);
+  CefPostTask(TID_UI, NewCefRunnableFunction(&UIT_GetLocalStorageMemoryUsage,
+                                             &usage, &event));
+  event.Wait();
+  return usage;
+}
+
+// Wait for the memory limit checks, which are rate-limited, to bring the
+// localStorage memory usage down to |max_usage|. Returns the last usage.
+int64 WaitForLocalStorageMemoryUsage(int64 max_usage) {
+  int64 usage = GetLocalStorageMemoryUsage();
+  for (int i = 0; i < 100 && usage > max_usage; ++i) {
+    base::PlatformThread::Sleep(base::TimeDelta::FromMilliseconds(50));
+    usage = GetLocalStorageMemoryUsage();
+  }
+  return usage;
+}
+
+FilePath GetLocalStorageDatabasePath(const FilePath& storage_path) {
+  return storage_path.AppendASCII("Local Storage").AppendASCII(
+      "LocalStorage.db");
+}
+
 }  // namespace
 
 // Test localStorage.
@@ -460,3 +776,230 @@ TEST(StorageTest, LocalChangeDirectory) {
   // Restore the original storage directory.
   EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
 }
+
+// Test flushing localStorage.
+TEST(StorageTest, LocalFlush) {
+  base::WaitableEvent event(false, false);
+
+  EXPECT_TRUE(CefFlushStorage(ST_LOCALSTORAGE, new FlushTask(&event)));
+  event.Wait();
+
+  // Flushing without a task is allowed.
+  EXPECT_TRUE(CefFlushStorage(ST_LOCALSTORAGE, NULL));
+}
+
+// Test flushing localStorage to the consolidated database.
+TEST(StorageTest, LocalFlushDatabase) {
+  std::string cache_path;
+  CefTestSuite::GetCachePath(cache_path);
+
+  ScopedTempDir temp_dir;
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  SetLocalStorageItem(kOrigin, kKey1, kVal1);
+
+  base::WaitableEvent event(false, false);
+  EXPECT_TRUE(CefFlushStorage(ST_LOCALSTORAGE, new FlushTask(&event)));
+  event.Wait();
+
+  // The change has been written to the database.
+  int64 size = 0;
+  EXPECT_TRUE(file_util::GetFileSize(
+      GetLocalStorageDatabasePath(temp_dir.path()), &size));
+  EXPECT_GT(size, 0);
+
+  // Restore the original storage location.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+}
+
+// Test that localStorage changes are written when the database is closed.
+// Changing the storage path closes the database in the same way as shutdown.
+TEST(StorageTest, LocalCloseDatabase) {
+  std::string cache_path;
+  CefTestSuite::GetCachePath(cache_path);
+
+  ScopedTempDir temp_dir;
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  // Close the database before the commit timer fires.
+  SetLocalStorageItem(kOrigin, kKey1, kVal1);
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+
+  // Reading from the original location waits for the path change, and
+  // therefore the close, to complete on the UI thread.
+  EXPECT_EQ("", GetLocalStorageItem(kOrigin, kKey1));
+  EXPECT_TRUE(file_util::PathExists(
+      GetLocalStorageDatabasePath(temp_dir.path())));
+
+  // Reopen the database and read the value back.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+  EXPECT_EQ(kVal1, GetLocalStorageItem(kOrigin, kKey1));
+
+  // Restore the original storage location.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+}
+
+// Test that the localStorage quota is measured in bytes.
+TEST(StorageTest, LocalQuota) {
+  std::string cache_path;
+  CefTestSuite::GetCachePath(cache_path);
+
+  ScopedTempDir temp_dir;
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  // Each character uses 2 bytes so the key and value together are one
+  // character over the quota.
+  const size_t max_length = kLocalStorageQuota / 2;
+  SetLocalStorageItem(kOrigin, kKey1, std::string(max_length - 2, 'a'));
+  EXPECT_EQ("", GetLocalStorageItem(kOrigin, kKey1));
+
+  // Exactly at the quota.
+  const std::string value(max_length - 3, 'a');
+  SetLocalStorageItem(kOrigin, kKey1, value);
+  EXPECT_EQ(value, GetLocalStorageItem(kOrigin, kKey1));
+
+  // Restore the original storage location.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+}
+
+// Test that idle localStorage areas are unloaded when the memory limit is
+// exceeded and that their data is reloaded on demand.
+TEST(StorageTest, LocalMemoryLimit) {
+  std::string cache_path;
+  CefTestSuite::GetCachePath(cache_path);
+
+  ScopedTempDir temp_dir;
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  static const char* kOrigins[] = {
+    "http://tests-limit1", "http://tests-limit2", "http://tests-limit3"
+  };
+
+  // Each value uses a third of the limit so that all three exceed it.
+  const std::string value(kLocalStorageMemoryLimit / 3 / 2, 'a');
+  for (size_t i = 0; i < arraysize(kOrigins); ++i)
+    SetLocalStorageItem(kOrigins[i], kKey1, value);
+
+  // The least recently used area is unloaded and the limit holds.
+  int64 usage = WaitForLocalStorageMemoryUsage(kLocalStorageMemoryLimit);
+  EXPECT_LE(usage, kLocalStorageMemoryLimit);
+  EXPECT_GT(usage, 0);
+
+  // Unloaded data is read again on demand.
+  for (size_t i = 0; i < arraysize(kOrigins); ++i)
+    EXPECT_EQ(value, GetLocalStorageItem(kOrigins[i], kKey1));
+
+  // Restore the original storage location.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+}
+
+// Test that a single area that exceeds the memory limit is unloaded.
+TEST(StorageTest, LocalMemoryLimitSingleOrigin) {
+  std::string cache_path;
+  CefTestSuite::GetCachePath(cache_path);
+
+  ScopedTempDir temp_dir;
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  const std::string value(kLocalStorageMemoryLimit, 'a');
+  SetLocalStorageItem(kOrigin, kKey1, value);
+
+  EXPECT_EQ(0, WaitForLocalStorageMemoryUsage(0));
+  EXPECT_EQ(value, GetLocalStorageItem(kOrigin, kKey1));
+
+  // Restore the original storage location.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+}
+
+// Test that an observer is not notified after it has been removed.
+TEST(StorageTest, RemoveObserver) {
+  CefRefPtr<CountingStorageObserver> removed_observer =
+      new CountingStorageObserver();
+  CefRefPtr<CountingStorageObserver> observer = new CountingStorageObserver();
+  int observer_id = 0;
+
+  CefPostTask(TID_UI,
+      NewCefRunnableFunction(&UIT_ChangeStorageAfterRemovingObserver,
+                             removed_observer, observer, &observer_id));
+
+  // Wait for the notifications to be delivered. The first wait may complete
+  // before the delivery task, which is posted while the changes are made.
+  WaitForThread(TID_UI);
+  WaitForThread(TID_UI);
+
+  EXPECT_EQ(0, removed_observer->count_);
+  EXPECT_EQ(1, observer->count_);
+
+  EXPECT_TRUE(CefRemoveStorageObserver(observer_id));
+  WaitForThread(TID_UI);
+}
+
+// Test the notifications for changes that do not modify a value and for the
+// deletion of origins that have not been loaded.
+TEST(StorageTest, LocalObserveUnloadedOrigins) {
+  std::string cache_path;
+  CefTestSuite::GetCachePath(cache_path);
+
+  ScopedTempDir temp_dir;
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  static const char* kOrigin2 = "http://tests-unloaded";
+
+  CefRefPtr<RecordingStorageObserver> observer = new RecordingStorageObserver();
+  int observer_id = 0;
+  CefPostTask(TID_UI,
+      NewCefRunnableFunction(&UIT_AddStorageObserver,
+                             CefRefPtr<CefStorageObserver>(observer.get()),
+                             &observer_id));
+
+  // Setting the same value again is not a change.
+  RunOnUIThreadAndNotify(NewCefRunnableFunction(&UIT_SetLocalStorage,
+      std::string(kOrigin), std::string(kKey1), std::string(kVal1)));
+  RunOnUIThreadAndNotify(NewCefRunnableFunction(&UIT_SetLocalStorage,
+      std::string(kOrigin), std::string(kKey1), std::string(kVal1)));
+  ASSERT_EQ(1U, observer->change_types_.size());
+  EXPECT_EQ(SCT_SET, observer->change_types_[0]);
+
+  RunOnUIThreadAndNotify(NewCefRunnableFunction(&UIT_SetLocalStorage,
+      std::string(kOrigin2), std::string(kKey1), std::string(kVal1)));
+
+  // Changing the storage path twice discards the loaded areas while the data
+  // remains in the database.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, temp_dir.path().value()));
+
+  // Deleting a single origin that has not been loaded.
+  observer->change_types_.clear();
+  observer->origins_.clear();
+  RunOnUIThreadAndNotify(NewCefRunnableFunction(&UIT_DeleteLocalStorage,
+                                                std::string(kOrigin)));
+  ASSERT_EQ(1U, observer->change_types_.size());
+  EXPECT_EQ(SCT_CLEAR, observer->change_types_[0]);
+  EXPECT_EQ(kOrigin, observer->origins_[0]);
+
+  // Deleting an origin without data is not a change.
+  observer->change_types_.clear();
+  observer->origins_.clear();
+  RunOnUIThreadAndNotify(NewCefRunnableFunction(&UIT_DeleteLocalStorage,
+                                                std::string(kOrigin)));
+  EXPECT_TRUE(observer->change_types_.empty());
+
+  // Deleting all origins reports the origin that has not been loaded.
+  RunOnUIThreadAndNotify(NewCefRunnableFunction(&UIT_DeleteLocalStorage,
+                                                std::string()));
+  ASSERT_EQ(1U, observer->change_types_.size());
+  EXPECT_EQ(SCT_CLEAR, observer->change_types_[0]);
+  EXPECT_EQ(kOrigin2, observer->origins_[0]);
+
+  EXPECT_TRUE(CefRemoveStorageObserver(observer_id));
+  WaitForThread(TID_UI);
+
+  // Restore the original storage location.
+  EXPECT_TRUE(CefSetStoragePath(ST_LOCALSTORAGE, cache_path));
+}
@@ -107,6 +107,14 @@ void CefTestSuite::GetSettings(CefSettings& settings) {
       cefclient::kLocalStorageQuota).c_str());
   settings.session_storage_quota = atoi(commandline_->GetSwitchValueASCII(
       cefclient::kSessionStorageQuota).c_str());
+  // Always use the consolidated localStorage database so that it's exercised by
+  // the storage tests.
+  settings.consolidated_local_storage = true;
+  // Limit localStorage memory so that unloading is exercised by the storage
+  // tests. Must match kLocalStorageMemoryLimit in storage_unittest.cc.
+  settings.local_storage_memory_limit = 1024 * 1024;
+  settings.cookie_commit_batch_size = atoi(commandline_->GetSwitchValueASCII(
+      cefclient::kCookieCommitBatchSize).c_str());
 
   // Always expose the V8 gc() function to give tests finer-grained control over
   // memory management.
@@ -5,6 +5,8 @@
 #include "include/cef_runnable.h"
 #include "include/cef_v8.h"
 #include "tests/unittests/test_handler.h"
+#include "base/stringprintf.h"
+#include "base/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace {
@@ -102,3 +104,1094 @@ TEST(V8Test, ExternalMemoryAllocation) {
   ASSERT_TRUE(test->object_created_);
   ASSERT_TRUE(test->size_checked_);
 }
+
+TEST(V8Test, ByteArray) {
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function createByteArray() {"
+          "  native function createByteArray();"
+          "  return createByteArray();"
+          "}"
+          "function checkByteArray(array) {"
+          "  native function checkByteArray();"
+          "  return checkByteArray(array);"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      return "var array = createByteArray();"
+             "if (array.length == 4 && array[0] == 1 && array[3] == 4) {"
+             "  array[1] = 200;"
+             "  checkByteArray(array);"
+             "}";
+    }
+
+    Test()
+        : array_created_(false),
+          array_checked_(false) {
+      for (int i = 0; i < kBufferSize; ++i)
+        buffer_[i] = i + 1;
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "createByteArray") {
+        retval = CefV8Value::CreateByteArray(buffer_, kBufferSize,
+            CefRefPtr<CefV8ByteArrayReleaseHandler>());
+        array_created_ = (retval->IsByteArray() &&
+                          retval->GetExternallyAllocatedMemory() ==
+                              kBufferSize);
+        return true;
+      } else if (name == "checkByteArray") {
+        // The value written by JavaScript is visible in the native buffer.
+        array_checked_ =
+            (arguments[0]->IsByteArray() &&
+             arguments[0]->GetByteArrayData() == buffer_ &&
+             arguments[0]->GetByteArrayLength() == kBufferSize &&
+             buffer_[1] == 200);
+        return true;
+      }
+      return false;
+    }
+
+    enum { kBufferSize = 4 };
+    unsigned char buffer_[kBufferSize];
+    bool array_created_;
+    bool array_checked_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/byteArray", test->GetExtensionCode(), test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  ASSERT_TRUE(test->array_created_);
+  ASSERT_TRUE(test->array_checked_);
+}
+
+TEST(V8Test, ByteArrayReleaseHandler) {
+  class ReleaseHandler : public CefV8ByteArrayReleaseHandler {
+   public:
+    ReleaseHandler() : release_count_(0), buffer_released_(false),
+                       null_buffer_released_(false) {}
+
+    virtual void ReleaseBuffer(void* buffer) OVERRIDE {
+      release_count_++;
+      if (buffer)
+        buffer_released_ = true;
+      else
+        null_buffer_released_ = true;
+    }
+
+    int release_count_;
+    bool buffer_released_;
+    bool null_buffer_released_;
+
+    IMPLEMENT_REFCOUNTING(ReleaseHandler);
+  };
+
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function createByteArrays() {"
+          "  native function createByteArrays();"
+          "  return createByteArrays();"
+          "}"
+          "function checkReleased() {"
+          "  native function checkReleased();"
+          "  return checkReleased();"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      // The arrays are unreachable after the call so gc() will collect them.
+      return "createByteArrays();"
+             "gc();"
+             "checkReleased();";
+    }
+
+    explicit Test(CefRefPtr<ReleaseHandler> release_handler)
+        : release_handler_(release_handler),
+          arrays_created_(false),
+          released_on_gc_(false) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "createByteArrays") {
+        CefRefPtr<CefV8Value> array =
+            CefV8Value::CreateByteArray(buffer_, sizeof(buffer_),
+                                        release_handler_.get());
+        // A NULL buffer is allowed when the length is 0.
+        CefRefPtr<CefV8Value> empty_array =
+            CefV8Value::CreateByteArray(NULL, 0, release_handler_.get());
+        arrays_created_ =
+            (array.get() && array->IsByteArray() &&
+             empty_array.get() && empty_array->IsByteArray() &&
+             empty_array->GetByteArrayLength() == 0);
+        return true;
+      } else if (name == "checkReleased") {
+        released_on_gc_ = (release_handler_->release_count_ == 2);
+        return true;
+      }
+      return false;
+    }
+
+    CefRefPtr<ReleaseHandler> release_handler_;
+    unsigned char buffer_[4];
+    bool arrays_created_;
+    bool released_on_gc_;
+  };
+
+  CefRefPtr<ReleaseHandler> release_handler = new ReleaseHandler();
+  Test* test = new Test(release_handler);
+  CefRegisterExtension("v8/byteArrayReleaseHandler", test->GetExtensionCode(),
+                       test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  ASSERT_TRUE(test->arrays_created_);
+  ASSERT_TRUE(test->released_on_gc_);
+
+  // Each buffer is released exactly once.
+  EXPECT_EQ(2, release_handler->release_count_);
+  EXPECT_TRUE(release_handler->buffer_released_);
+  EXPECT_TRUE(release_handler->null_buffer_released_);
+}
+
+TEST(V8Test, ValueConversion) {
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function toNative(value) {"
+          "  native function toNative();"
+          "  return toNative(value);"
+          "}"
+          "function checkResult(value) {"
+          "  native function checkResult();"
+          "  return checkResult(value);"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      return "var cyclic = {};"
+             "cyclic.self = cyclic;"
+             "var result = toNative({"
+             "  'bool': true, 'int': 5, 'double': 1.5, 'string': 'foo',"
+             "  'null': null, 'func': function() {}, 'undef': undefined,"
+             "  'list': [1, 'two', [3], undefined], 'dict': {'a': 'b'},"
+             "  'cyclic': cyclic"
+             "});"
+             "if (result.bool === true && result.int === 5 &&"
+             "    result.double === 1.5 && result.string === 'foo' &&"
+             "    result.list.length == 4 && result.list[1] === 'two' &&"
+             "    result.list[2][0] === 3 && result.list[3] === null &&"
+             "    result.dict.a === 'b' && !('func' in result)) {"
+             "  checkResult(result);"
+             "}";
+    }
+
+    Test()
+        : converted_(false),
+          cycle_detected_(false),
+          result_checked_(false) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "toNative") {
+        // Objects containing a cycle cannot be converted.
+        cycle_detected_ =
+            !arguments[0]->GetValue("cyclic")->GetDictionaryValue().get();
+        arguments[0]->DeleteValue("cyclic");
+
+        CefRefPtr<CefDictionaryValue> dict =
+            arguments[0]->GetDictionaryValue();
+        if (!dict.get())
+          return false;
+
+        CefRefPtr<CefListValue> list = dict->GetList("list");
+        converted_ =
+            (dict->GetSize() == 7 &&
+             dict->GetBool("bool") &&
+             dict->GetInt("int") == 5 &&
+             dict->GetDouble("double") == 1.5 &&
+             dict->GetString("string") == "foo" &&
+             dict->GetType("null") == VTYPE_NULL &&
+             !dict->HasKey("func") &&
+             !dict->HasKey("undef") &&
+             list.get() && list->GetSize() == 4 &&
+             list->GetType(3) == VTYPE_NULL &&
+             list->GetList(2)->GetInt(0) == 3 &&
+             dict->GetDictionary("dict")->GetString("a") == "b");
+
+        retval = CefV8Value::CreateFromDictionary(dict);
+        return true;
+      } else if (name == "checkResult") {
+        result_checked_ = true;
+        return true;
+      }
+      return false;
+    }
+
+    bool converted_;
+    bool cycle_detected_;
+    bool result_checked_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/valueConversion", test->GetExtensionCode(), test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  ASSERT_TRUE(test->converted_);
+  ASSERT_TRUE(test->cycle_detected_);
+  ASSERT_TRUE(test->result_checked_);
+}
+
+TEST(V8Test, PropertyName) {
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function setName(object) {"
+          "  native function setName();"
+          "  return setName(object);"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      return "var obj = {'existing': 'value'};"
+             "setName(obj);"
+             "if (obj.name === 'test')"
+             "  setName(obj);";
+    }
+
+    Test()
+        : call_count_(0),
+          name_checked_(false) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "setName") {
+        // The same property names are reused for every call.
+        if (!name_.get()) {
+          name_ = CefV8PropertyName::Create("name");
+          existing_ = CefV8PropertyName::Create("existing");
+        }
+
+        CefRefPtr<CefV8Value> obj = arguments[0];
+        if (++call_count_ == 1) {
+          obj->SetValue(name_, CefV8Value::CreateString("test"),
+                        V8_PROPERTY_ATTRIBUTE_NONE);
+        } else {
+          name_checked_ =
+              (name_->GetName() == "name" &&
+               obj->HasValue(name_) &&
+               obj->GetValue(name_)->GetStringValue() == "test" &&
+               obj->GetValue(existing_)->GetStringValue() == "value");
+        }
+        return true;
+      }
+      return false;
+    }
+
+    CefRefPtr<CefV8PropertyName> name_;
+    CefRefPtr<CefV8PropertyName> existing_;
+    int call_count_;
+    bool name_checked_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/propertyName", test->GetExtensionCode(), test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  ASSERT_EQ(2, test->call_count_);
+  ASSERT_TRUE(test->name_checked_);
+}
+
+TEST(V8Test, FunctionTemplate) {
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function createRows() {"
+          "  native function createRows();"
+          "  return createRows();"
+          "}"
+          "function checkRows(same, shared) {"
+          "  native function checkRows();"
+          "  return checkRows(same, shared);"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      // Every row holds the same function object so a property set on the
+      // function for one row is visible from the others.
+      return "var rows = createRows();"
+             "rows[0].func.tag = 'row0';"
+             "checkRows(rows[0].func === rows[2].func,"
+             "          rows[2].func.tag === 'row0');"
+             "for (var i = 0; i < rows.length; ++i)"
+             "  rows[i].func();";
+    }
+
+    Test()
+        : rows_created_(false),
+          rows_checked_(false),
+          call_count_(0) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "createRows") {
+        CefRefPtr<CefV8FunctionTemplate> tmpl =
+            CefV8FunctionTemplate::Create("templateFunc", this);
+
+        retval = CefV8Value::CreateArray();
+        bool same = true;
+        CefRefPtr<CefV8Value> first = tmpl->GetFunction();
+        for (int i = 0; i < kRowCount; ++i) {
+          CefRefPtr<CefV8Value> func = tmpl->GetFunction();
+          if (!func->IsSame(first))
+            same = false;
+          CefRefPtr<CefV8Value> row = CefV8Value::CreateObject(
+              CefRefPtr<CefBase>(), CefRefPtr<CefV8Accessor>());
+          row->SetValue("func", func, V8_PROPERTY_ATTRIBUTE_NONE);
+          retval->SetValue(i, row);
+        }
+
+        rows_created_ =
+            (same && first->IsFunction() &&
+             first->GetFunctionName() == "templateFunc" &&
+             tmpl->GetName() == "templateFunc" &&
+             tmpl->GetHandler().get() == this);
+
+        // The template is released here while the function is still in use.
+        return true;
+      } else if (name == "checkRows") {
+        rows_checked_ = (arguments.size() == 2 &&
+                         arguments[0]->GetBoolValue() &&
+                         arguments[1]->GetBoolValue());
+        return true;
+      } else if (name == "templateFunc") {
+        call_count_++;
+        return true;
+      }
+      return false;
+    }
+
+    enum { kRowCount = 3 };
+    bool rows_created_;
+    bool rows_checked_;
+    int call_count_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/functionTemplate", test->GetExtensionCode(), test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  ASSERT_TRUE(test->rows_created_);
+  ASSERT_TRUE(test->rows_checked_);
+  ASSERT_EQ(static_cast<int>(Test::kRowCount), test->call_count_);
+}
+
+// Compare the time taken to create many functions with CreateFunction(), which
+// returns a new function object each time, and with a function template.
+TEST(V8Test, FunctionCreationPerformance) {
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function createFunctions() {"
+          "  native function createFunctions();"
+          "  return createFunctions();"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      return "var funcs = createFunctions();"
+             "funcs[0]();"
+             "funcs[1]();";
+    }
+
+    Test()
+        : functions_created_(false),
+          call_count_(0) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "createFunctions") {
+        base::TimeTicks start = base::TimeTicks::Now();
+        CefRefPtr<CefV8Value> created, first_created;
+        for (int i = 0; i < kFunctionCount; ++i) {
+          created = CefV8Value::CreateFunction("benchFunc", this);
+          if (i == 0)
+            first_created = created;
+        }
+        create_time_ = base::TimeTicks::Now() - start;
+
+        start = base::TimeTicks::Now();
+        CefRefPtr<CefV8FunctionTemplate> tmpl =
+            CefV8FunctionTemplate::Create("benchFunc", this);
+        CefRefPtr<CefV8Value> from_template, first_from_template;
+        for (int i = 0; i < kFunctionCount; ++i) {
+          from_template = tmpl->GetFunction();
+          if (i == 0)
+            first_from_template = from_template;
+        }
+        template_time_ = base::TimeTicks::Now() - start;
+
+        // CreateFunction() returns distinct objects while the template returns
+        // the same object for the context.
+        functions_created_ =
+            (created->IsFunction() && from_template->IsFunction() &&
+             !created->IsSame(first_created) &&
+             from_template->IsSame(first_from_template));
+
+        retval = CefV8Value::CreateArray();
+        retval->SetValue(0, created);
+        retval->SetValue(1, from_template);
+        return true;
+      } else if (name == "benchFunc") {
+        call_count_++;
+        return true;
+      }
+      return false;
+    }
+
+    enum { kFunctionCount = 100000 };
+    bool functions_created_;
+    int call_count_;
+    base::TimeDelta create_time_;
+    base::TimeDelta template_time_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/functionCreationPerformance",
+                       test->GetExtensionCode(), test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  ASSERT_TRUE(test->functions_created_);
+  ASSERT_EQ(2, test->call_count_);
+
+  // Reported in the test output XML as properties of this test.
+  RecordProperty("FunctionCount", static_cast<int>(Test::kFunctionCount));
+  RecordProperty("CreateFunctionMs",
+                 static_cast<int>(test->create_time_.InMilliseconds()));
+  RecordProperty("FunctionTemplateMs",
+                 static_cast<int>(test->template_time_.InMilliseconds()));
+}
+
+TEST(V8Test, ContextTracking) {
+  class UserData : public CefBase {
+   public:
+    explicit UserData(bool* released) : released_(released) {}
+    virtual ~UserData() { *released_ = true; }
+
+   private:
+    bool* released_;
+
+    IMPLEMENT_REFCOUNTING(UserData);
+  };
+
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function createObject() {"
+          "  native function createObject();"
+          "  return createObject();"
+          "}"
+          "function checkCounts() {"
+          "  native function checkCounts();"
+          "  return checkCounts();"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      // The object remains reachable until the context is released.
+      return "var obj = createObject();"
+             "checkCounts();";
+    }
+
+    Test()
+        : initial_count_(0),
+          initial_memory_(0),
+          counts_checked_(false),
+          user_data_released_(false) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      static const int kTestSize = 1000;
+      CefRefPtr<CefV8Context> context = CefV8Context::GetCurrentContext();
+      if (name == "createObject") {
+        initial_count_ = context->GetTrackedObjectCount();
+        initial_memory_ = context->GetExternallyAllocatedMemory();
+        retval = CefV8Value::CreateObject(new UserData(&user_data_released_),
+                                          CefRefPtr<CefV8Accessor>());
+        retval->AdjustExternallyAllocatedMemory(kTestSize);
+        return true;
+      } else if (name == "checkCounts") {
+        counts_checked_ =
+            (context->GetTrackedObjectCount() == initial_count_ + 1 &&
+             context->GetExternallyAllocatedMemory() ==
+                 initial_memory_ + kTestSize);
+        return true;
+      }
+      return false;
+    }
+
+    int initial_count_;
+    int initial_memory_;
+    bool counts_checked_;
+    bool user_data_released_;
+  };
+
+  // Navigates away from the test page so that its context is released.
+  class NavigationHandler : public TestHandler {
+   public:
+    NavigationHandler(const std::string& code, bool* user_data_released)
+        : test_url_("http://tests/run.html"),
+          next_url_("http://tests/next.html"),
+          user_data_released_(user_data_released) {
+      html_ = "<html><head><script language=\"JavaScript\">" +
+              code +
+              "</script></head><body></body></html>";
+    }
+
+    virtual void RunTest() OVERRIDE {
+      AddResource(test_url_, html_, "text/html");
+      AddResource(next_url_, "<html><body>Next</body></html>", "text/html");
+      CreateBrowser(test_url_);
+    }
+
+    virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                           CefRefPtr<CefFrame> frame,
+                           int httpStatusCode) OVERRIDE {
+      if (!browser->IsPopup() && frame->IsMain()) {
+        if (frame->GetURL() == test_url_) {
+          frame->LoadURL(next_url_);
+        } else {
+          // The context of the previous page has been released by the time
+          // the next page finishes loading.
+          if (*user_data_released_)
+            got_released_on_load_end_.yes();
+          DestroyTest();
+        }
+      }
+    }
+
+    TrackCallback got_released_on_load_end_;
+
+   private:
+    std::string test_url_;
+    std::string next_url_;
+    std::string html_;
+    bool* user_data_released_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/contextTracking", test->GetExtensionCode(), test);
+
+  CefRefPtr<NavigationHandler> test_handler =
+      new NavigationHandler(test->GetTestCode(), &test->user_data_released_);
+  test_handler->ExecuteTest();
+
+  ASSERT_TRUE(test->counts_checked_);
+  // The user data is released with the context without waiting for garbage
+  // collection.
+  ASSERT_TRUE(test_handler->got_released_on_load_end_);
+  ASSERT_TRUE(test->user_data_released_);
+}
+
+TEST(V8Test, AsyncFunction) {
+  // Adds the arguments on a worker thread.
+  class AsyncHandler : public CefV8AsyncHandler {
+   public:
+    AsyncHandler() : executed_on_worker_thread_(false) {}
+
+    virtual void Execute(const CefString& name,
+                         CefRefPtr<CefListValue> arguments,
+                         CefRefPtr<CefV8AsyncCallback> callback) OVERRIDE {
+      executed_on_worker_thread_ =
+          !CefCurrentlyOn(TID_UI) && !CefCurrentlyOn(TID_IO) &&
+          !CefCurrentlyOn(TID_FILE);
+      if (name != "asyncAdd" || arguments->GetSize() != 2) {
+        callback->Failure("Invalid arguments");
+        return;
+      }
+
+      CefRefPtr<CefListValue> results = CefListValue::Create();
+      results->SetInt(0, arguments->GetInt(0) + arguments->GetInt(1));
+      callback->Success(results);
+    }
+
+    bool executed_on_worker_thread_;
+
+    IMPLEMENT_REFCOUNTING(AsyncHandler);
+  };
+
+  // Destroys the browser once the asynchronous call has completed.
+  class AsyncTestHandler : public TestHandler {
+   public:
+    explicit AsyncTestHandler(const std::string& code) {
+      html_ = "<html><head><script language=\"JavaScript\">" +
+              code +
+              "</script></head><body></body></html>";
+    }
+
+    virtual void RunTest() OVERRIDE {
+      const std::string url = "http://tests/run.html";
+      AddResource(url, html_, "text/html");
+      CreateBrowser(url);
+    }
+
+    void Finish() { DestroyTest(); }
+
+   private:
+    std::string html_;
+  };
+
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function getAsyncAdd() {"
+          "  native function getAsyncAdd();"
+          "  return getAsyncAdd();"
+          "}"
+          "function checkResult(error, result) {"
+          "  native function checkResult();"
+          "  return checkResult(error, result);"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      return "var asyncAdd = getAsyncAdd();"
+             "asyncAdd(2, 3, checkResult);";
+    }
+
+    explicit Test(AsyncHandler* async_handler)
+        : async_handler_(async_handler),
+          result_checked_(false) {
+    }
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "getAsyncAdd") {
+        retval = CefV8Value::CreateAsyncFunction("asyncAdd", async_handler_);
+        return true;
+      } else if (name == "checkResult") {
+        result_checked_ =
+            (CefCurrentlyOn(TID_UI) &&
+             arguments.size() == 2 &&
+             arguments[0]->IsNull() &&
+             arguments[1]->GetIntValue() == 5);
+        test_handler_->Finish();
+        return true;
+      }
+      return false;
+    }
+
+    CefRefPtr<AsyncHandler> async_handler_;
+    CefRefPtr<AsyncTestHandler> test_handler_;
+    bool result_checked_;
+  };
+
+  CefRefPtr<AsyncHandler> async_handler = new AsyncHandler();
+  Test* test = new Test(async_handler);
+  CefRegisterExtension("v8/asyncFunction", test->GetExtensionCode(), test);
+
+  test->test_handler_ = new AsyncTestHandler(test->GetTestCode());
+  test->test_handler_->ExecuteTest();
+  test->test_handler_ = NULL;
+
+  ASSERT_TRUE(async_handler->executed_on_worker_thread_);
+  ASSERT_TRUE(test->result_checked_);
+}
+
+TEST(V8Test, HeapStatistics) {
+  class GCHandler : public CefV8GCHandler {
+   public:
+    GCHandler() : full_gc_notified_(false) {}
+
+    virtual void OnGarbageCollection(
+        bool full,
+        double pause_time,
+        const CefV8HeapStatistics& statistics) OVERRIDE {
+      if (full && CefCurrentlyOn(TID_UI) && pause_time >= 0 &&
+          statistics.full_gc_count > 0) {
+        full_gc_notified_ = true;
+      }
+    }
+
+    bool full_gc_notified_;
+
+    IMPLEMENT_REFCOUNTING(GCHandler);
+  };
+
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function checkHeap() {"
+          "  native function checkHeap();"
+          "  return checkHeap();"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      return "gc(); checkHeap();";
+    }
+
+    Test() : heap_checked_(false) {}
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "checkHeap") {
+        CefV8HeapStatistics statistics;
+        heap_checked_ =
+            (CefGetV8HeapStatistics(statistics) &&
+             statistics.used_heap_size > 0 &&
+             statistics.total_heap_size >= statistics.used_heap_size &&
+             statistics.heap_size_limit >= statistics.total_heap_size &&
+             statistics.full_gc_count > 0 &&
+             statistics.gc_count >= statistics.full_gc_count);
+        return true;
+      }
+      return false;
+    }
+
+    bool heap_checked_;
+  };
+
+  CefRefPtr<GCHandler> gc_handler = new GCHandler();
+  int gc_handler_id = CefAddV8GCHandler(gc_handler.get());
+  ASSERT_GT(gc_handler_id, 0);
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/heapStatistics", test->GetExtensionCode(), test);
+
+  V8TestHandler* test_handler = new V8TestHandler(test->GetTestCode());
+  test_handler->ExecuteTest();
+
+  // Wait for the pending GC notification to be delivered.
+  WaitForUIThread();
+
+  ASSERT_TRUE(CefRemoveV8GCHandler(gc_handler_id));
+
+  ASSERT_TRUE(test->heap_checked_);
+  ASSERT_TRUE(gc_handler->full_gc_notified_);
+}
+
+TEST(V8Test, RemoveGCHandler) {
+  class GCHandler : public CefV8GCHandler {
+   public:
+    GCHandler() : notify_count_(0) {}
+
+    virtual void OnGarbageCollection(
+        bool full,
+        double pause_time,
+        const CefV8HeapStatistics& statistics) OVERRIDE {
+      notify_count_++;
+    }
+
+    int notify_count_;
+
+    IMPLEMENT_REFCOUNTING(GCHandler);
+  };
+
+  // Register the same handler twice and remove one of the registrations.
+  CefRefPtr<GCHandler> handler1 = new GCHandler();
+  CefRefPtr<GCHandler> handler2 = new GCHandler();
+  int handler1_id1 = CefAddV8GCHandler(handler1.get());
+  int handler1_id2 = CefAddV8GCHandler(handler1.get());
+  int handler2_id = CefAddV8GCHandler(handler2.get());
+  ASSERT_GT(handler1_id1, 0);
+  ASSERT_GT(handler1_id2, 0);
+  ASSERT_GT(handler2_id, 0);
+  ASSERT_NE(handler1_id1, handler1_id2);
+  ASSERT_TRUE(CefRemoveV8GCHandler(handler1_id1));
+
+  CefRefPtr<V8TestHandler> test_handler = new V8TestHandler("gc();");
+  test_handler->ExecuteTest();
+  WaitForUIThread();
+
+  // The remaining registration is notified once per notification.
+  ASSERT_GT(handler2->notify_count_, 0);
+  ASSERT_EQ(handler2->notify_count_, handler1->notify_count_);
+
+  ASSERT_TRUE(CefRemoveV8GCHandler(handler1_id2));
+  ASSERT_TRUE(CefRemoveV8GCHandler(handler2_id));
+  WaitForUIThread();
+
+  int notify_count = handler2->notify_count_;
+
+  test_handler = new V8TestHandler("gc();");
+  test_handler->ExecuteTest();
+  WaitForUIThread();
+
+  // No notifications are delivered after removal.
+  ASSERT_EQ(notify_count, handler1->notify_count_);
+  ASSERT_EQ(notify_count, handler2->notify_count_);
+}
+
+TEST(V8Test, ScriptCache) {
+  // Executes the same script twice after the page has loaded.
+  class ScriptTestHandler : public TestHandler {
+   public:
+    explicit ScriptTestHandler(const std::string& code) : code_(code) {}
+
+    virtual void RunTest() OVERRIDE {
+      const std::string url = "http://tests/run.html";
+      AddResource(url, "<html><body></body></html>", "text/html");
+      CreateBrowser(url);
+    }
+
+    virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                           CefRefPtr<CefFrame> frame,
+                           int httpStatusCode) OVERRIDE {
+      if (!browser->IsPopup() && frame->IsMain()) {
+        frame->ExecuteJavaScript(code_, "http://tests/script.js", 1);
+        frame->ExecuteJavaScript(code_, "http://tests/script.js", 1);
+      }
+    }
+
+    void Finish() { DestroyTest(); }
+
+   private:
+    std::string code_;
+  };
+
+  class Test : public V8TestV8Handler {
+   public:
+    static std::string GetExtensionCode() {
+      std::string code =
+          "function scriptRan() {"
+          "  native function scriptRan();"
+          "  return scriptRan();"
+          "};";
+      return code;
+    }
+
+    static std::string GetTestCode() {
+      // The script must be large enough for V8 to use precompiled data.
+      std::string code = "(function() {";
+      for (int i = 0; i < 100; ++i) {
+        code += base::StringPrintf(
+            "function scriptCacheTest%d() { return %d; }", i, i);
+      }
+      code += "scriptRan();})();";
+      return code;
+    }
+
+    Test() : run_count_(0), cache_hit_(false) {}
+
+    virtual bool Execute(const CefString& name,
+                         CefRefPtr<CefV8Value> object,
+                         const CefV8ValueList& arguments,
+                         CefRefPtr<CefV8Value>& retval,
+                         CefString& exception) {
+      if (name == "scriptRan") {
+        CefV8ScriptCacheStatistics statistics;
+        CefGetV8ScriptCacheStatistics(statistics);
+
+        if (++run_count_ == 1) {
+          first_statistics_ = statistics;
+        } else {
+          cache_hit_ =
+              (statistics.hit_count == first_statistics_.hit_count + 1 &&
+               statistics.miss_count == first_statistics_.miss_count &&
+               statistics.entry_count > 0 &&
+               statistics.data_size > 0);
+          test_handler_->Finish();
+        }
+        return true;
+      }
+      return false;
+    }
+
+    int run_count_;
+    bool cache_hit_;
+    CefV8ScriptCacheStatistics first_statistics_;
+    CefRefPtr<ScriptTestHandler> test_handler_;
+  };
+
+  Test* test = new Test();
+  CefRegisterExtension("v8/scriptCache", test->GetExtensionCode(), test);
+
+  test->test_handler_ = new ScriptTestHandler(test->GetTestCode());
+  test->test_handler_->ExecuteTest();
+  test->test_handler_ = NULL;
+
+  ASSERT_EQ(2, test->run_count_);
+  ASSERT_TRUE(test->cache_hit_);
+}
+
+TEST(V8Test, EvaluateJavaScript) {
+  // Records the results of an evaluation.
+  class ResultCallback : public CefJavaScriptResultCallback {
+   public:
+    ResultCallback() : completed_(false) {}
+
+    virtual void OnComplete(CefRefPtr<CefListValue> results,
+                            CefRefPtr<CefListValue> exceptions) OVERRIDE {
+      completed_ = CefCurrentlyOn(TID_UI);
+      results_ = results;
+      exceptions_ = exceptions;
+    }
+
+    bool completed_;
+    CefRefPtr<CefListValue> results_;
+    CefRefPtr<CefListValue> exceptions_;
+
+    IMPLEMENT_REFCOUNTING(ResultCallback);
+  };
+
+  class EvaluateTestHandler : public TestHandler {
+   public:
+    virtual void RunTest() OVERRIDE {
+      const std::string url = "http://tests/run.html";
+      AddResource(url, "<html><body></body></html>", "text/html");
+      CreateBrowser(url);
+    }
+
+    virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                           CefRefPtr<CefFrame> frame,
+                           int httpStatusCode) OVERRIDE {
+      if (!browser->IsPopup() && frame->IsMain()) {
+        frame->EvaluateJavaScript("1 + 2", "", 1, evaluate_callback_.get());
+        frame->EvaluateJavaScript("", "", 1, empty_callback_.get());
+
+        // Scripts still execute when no callback is provided.
+        frame->ExecuteJavaScriptBatch(
+            std::vector<CefString>(1, "var noCallbackRan = true;"), "", NULL);
+
+        std::vector<CefString> scripts;
+        scripts.push_back("var obj = {list: [1, 'two']}; obj;");
+        scripts.push_back("throw new Error('batch error');");
+        scripts.push_back("obj.list.length;");
+        scripts.push_back("noCallbackRan;");
+        frame->ExecuteJavaScriptBatch(scripts, "", batch_callback_.get());
+      }
+    }
+
+    void Finish() { DestroyTest(); }
+
+    CefRefPtr<ResultCallback> evaluate_callback_;
+    CefRefPtr<ResultCallback> empty_callback_;
+    CefRefPtr<ResultCallback> batch_callback_;
+  };
+
+  // Destroys the browser after the batch has executed.
+  class BatchCallback : public ResultCallback {
+   public:
+    explicit BatchCallback(EvaluateTestHandler* handler) : handler_(handler) {}
+
+    virtual void OnComplete(CefRefPtr<CefListValue> results,
+                            CefRefPtr<CefListValue> exceptions) OVERRIDE {
+      ResultCallback::OnComplete(results, exceptions);
+      handler_->Finish();
+    }
+
+   private:
+    EvaluateTestHandler* handler_;
+  };
+
+  CefRefPtr<EvaluateTestHandler> handler = new EvaluateTestHandler();
+  handler->evaluate_callback_ = new ResultCallback();
+  handler->empty_callback_ = new ResultCallback();
+  handler->batch_callback_ = new BatchCallback(handler.get());
+  handler->ExecuteTest();
+
+  CefRefPtr<ResultCallback> callback = handler->evaluate_callback_;
+  ASSERT_TRUE(callback->completed_);
+  ASSERT_EQ(1, callback->results_->GetSize());
+  EXPECT_EQ(3, callback->results_->GetInt(0));
+  EXPECT_EQ("", callback->exceptions_->GetString(0).ToString());
+
+  // An empty script still completes the callback.
+  callback = handler->empty_callback_;
+  ASSERT_TRUE(callback->completed_);
+  ASSERT_EQ(1, callback->results_->GetSize());
+  EXPECT_EQ(VTYPE_NULL, callback->results_->GetType(0));
+  EXPECT_EQ("", callback->exceptions_->GetString(0).ToString());
+
+  callback = handler->batch_callback_;
+  ASSERT_TRUE(callback->completed_);
+  ASSERT_EQ(4, callback->results_->GetSize());
+  ASSERT_EQ(4, callback->exceptions_->GetSize());
+
+  // The object is converted to a dictionary.
+  CefRefPtr<CefDictionaryValue> obj = callback->results_->GetDictionary(0);
+  ASSERT_TRUE(obj.get());
+  CefRefPtr<CefListValue> list = obj->GetList("list");
+  ASSERT_TRUE(list.get());
+  EXPECT_EQ(1, list->GetInt(0));
+  EXPECT_EQ("two", list->GetString(1).ToString());
+  EXPECT_EQ("", callback->exceptions_->GetString(0).ToString());
+
+  // The exception does not prevent the remaining scripts from executing.
+  EXPECT_EQ(VTYPE_NULL, callback->results_->GetType(1));
+  EXPECT_NE(std::string::npos,
+      callback->exceptions_->GetString(1).ToString().find("batch error"));
+
+  EXPECT_EQ(2, callback->results_->GetInt(2));
+  EXPECT_EQ("", callback->exceptions_->GetString(2).ToString());
+
+  EXPECT_TRUE(callback->results_->GetBool(3));
+  EXPECT_EQ("", callback->exceptions_->GetString(3).ToString());
+}
@@ -374,6 +374,10 @@ _simpletypes = {
     'CefRect' : ['cef_rect_t', 'CefRect()'],
     'CefThreadId' : ['cef_thread_id_t', 'TID_UI'],
     'CefTime' : ['cef_time_t', 'CefTime()'],
+    'CefV8HeapStatistics' : ['cef_v8heap_statistics_t',
+                             'CefV8HeapStatistics()'],
+    'CefV8ScriptCacheStatistics' : ['cef_v8script_cache_statistics_t',
+                                    'CefV8ScriptCacheStatistics()'],
 }
 
 def get_function_impls(content, ident):
@@ -1316,6 +1320,11 @@ class obj_argument:
         if self.type.has_name():
             raise Exception('Cannot be called for argument types')
             
+        # void pointers are returned as simple types
+        if self.type.get_type() == 'void' and self.type.is_byaddr() and \
+            not self.type.is_const():
+            return 'simple'
+
         # unsupported modifiers
         if self.type.is_const() or self.type.is_byref() or \
             self.type.is_byaddr():
@@ -1598,6 +1607,8 @@ class obj_analysis:
     
     def get_result_simple_default(self):
         """ Return the default value fo the basic type. """
+        if self.is_byaddr():
+            return 'NULL'
         return self.result_default
     
     def is_result_refptr(self):